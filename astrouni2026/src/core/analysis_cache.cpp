@@ -0,0 +1,123 @@
+/**
+ * @file analysis_cache.cpp
+ * @brief Implementierung des Caches für die HTML-Textanalyse
+ */
+
+#include "analysis_cache.h"
+#include "astro_text_analyzer.h"
+#include "astro_text_store.h"
+#include "chart_pipeline.h"
+
+namespace astro {
+
+//==============================================================================
+// Schlüssel
+//==============================================================================
+
+size_t qHash(const AnalysisKey& key, size_t seed) {
+    return qHashMulti(seed, key.chart, key.lang, key.orben, key.revision);
+}
+
+static size_t hashRadixData(const Radix& radix, size_t seed) {
+    const RadixFix& f = radix.rFix;
+    seed = qHashMulti(seed, f.vorname, f.name, f.ort, f.tag, f.monat, f.jahr, f.zeit);
+    seed = qHashMulti(seed, radix.horoTyp, radix.hausSys, radix.anzahlPlanet,
+                      radix.asc, radix.mc);
+    seed = qHashRange(radix.planet.begin(), radix.planet.end(), seed);
+    seed = qHashRange(radix.haus.begin(), radix.haus.end(), seed);
+    seed = qHashRange(radix.stzPlanet.begin(), radix.stzPlanet.end(), seed);
+    seed = qHashRange(radix.stzHaus.begin(), radix.stzHaus.end(), seed);
+    seed = qHashRange(radix.aspPlanet.begin(), radix.aspPlanet.end(), seed);
+    seed = qHashRange(radix.aspHaus.begin(), radix.aspHaus.end(), seed);
+    seed = qHashRange(radix.planetTyp.begin(), radix.planetTyp.end(), seed);
+    return seed;
+}
+
+size_t AnalysisCache::chartHash(const Radix& radix) {
+    size_t seed = hashRadixData(radix, 0);
+    if (radix.synastrie) {
+        seed = hashRadixData(*radix.synastrie, seed);
+    }
+    return seed;
+}
+
+AnalysisKey AnalysisCache::makeKey(const Radix& radix, const AuInit& auinit) {
+    AnalysisKey key;
+    key.chart = chartHash(radix);
+    key.lang = AstroTextStore::systemLanguageCode();
+    key.orben = ChartPipeline::orbenHash(auinit);
+    key.revision = astroTextStore().revision();
+    return key;
+}
+
+//==============================================================================
+// Cache
+//==============================================================================
+
+AnalysisCache::AnalysisCache()
+    : m_entries(32) {
+}
+
+bool AnalysisCache::lookup(const AnalysisKey& key, QString& html) {
+    QMutexLocker locker(&m_mutex);
+
+    const QString* eintrag = m_entries.find(key);
+    if (eintrag == nullptr) {
+        return false;
+    }
+    html = *eintrag;
+    return true;
+}
+
+void AnalysisCache::insert(const AnalysisKey& key, const QString& html) {
+    QMutexLocker locker(&m_mutex);
+    m_entries.insert(key, html);
+}
+
+QString AnalysisCache::analyzeRadix(const Radix& radix, const AuInit& auinit) {
+    const AnalysisKey key = makeKey(radix, auinit);
+
+    QString html;
+    if (lookup(key, html)) {
+        return html;
+    }
+
+    // Außerhalb der Sperre rechnen - parallele Analysen blockieren sich nicht
+    AstroTextAnalyzer analyzer;
+    analyzer.setOrben(&auinit);
+    html = analyzer.analyzeRadix(radix);
+
+    insert(key, html);
+    return html;
+}
+
+void AnalysisCache::clear() {
+    QMutexLocker locker(&m_mutex);
+    m_entries.clear();
+}
+
+int AnalysisCache::count() const {
+    QMutexLocker locker(&m_mutex);
+    return m_entries.size();
+}
+
+int AnalysisCache::maxEntries() const {
+    QMutexLocker locker(&m_mutex);
+    return m_entries.maxEntries();
+}
+
+void AnalysisCache::setMaxEntries(int maxEntries) {
+    QMutexLocker locker(&m_mutex);
+    m_entries.setMaxEntries(maxEntries);
+}
+
+//==============================================================================
+// Globale Instanz
+//==============================================================================
+
+AnalysisCache& analysisCache() {
+    static AnalysisCache instance;
+    return instance;
+}
+
+} // namespace astro
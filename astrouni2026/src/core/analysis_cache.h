@@ -0,0 +1,99 @@
+#pragma once
+/**
+ * @file analysis_cache.h
+ * @brief Cache für die HTML-Textanalyse
+ *
+ * Die Radix-Textanalyse ist ein großer HTML-String, dessen Erzeugung
+ * spürbar dauert. Der Cache hält fertige Analysen je
+ * (Horoskop, Sprache, Orben, Text-Revision), damit das Umschalten zwischen
+ * Horoskopen oder Sprachen ohne Neuberechnung auskommt.
+ */
+
+#include "data_types.h"
+#include "lru_cache.h"
+#include <QHash>
+#include <QMutex>
+#include <QString>
+
+namespace astro {
+
+/**
+ * @brief Schlüssel einer gecachten Analyse
+ */
+struct AnalysisKey {
+    size_t  chart = 0;      // Prüfsumme über die Horoskop-Daten
+    QString lang;           // Sprache der Texte
+    size_t  orben = 0;      // Prüfsumme über Orben und Aspekt-Auswahl
+    int     revision = 0;   // AstroTextStore-Revision (bearbeitete Texte)
+
+    bool operator==(const AnalysisKey& other) const {
+        return chart == other.chart && orben == other.orben &&
+               revision == other.revision && lang == other.lang;
+    }
+    bool operator!=(const AnalysisKey& other) const { return !(*this == other); }
+};
+
+size_t qHash(const AnalysisKey& key, size_t seed = 0);
+
+/**
+ * @brief Prozessweiter, thread-sicherer Cache der Radix-Textanalyse
+ *
+ * Begrenzt auf maxEntries() Einträge; bei Überlauf fliegt die am
+ * längsten nicht benutzte Analyse heraus.
+ */
+class AnalysisCache {
+public:
+    AnalysisCache();
+
+    /**
+     * @brief Erzeugt den Schlüssel für einen berechneten Radix
+     * @param radix Berechneter Radix (inkl. Partner bei Synastrie/Transit)
+     * @param auinit Einstellungen (Orben)
+     */
+    static AnalysisKey makeKey(const Radix& radix, const AuInit& auinit);
+
+    /**
+     * @brief Prüfsumme über alle Daten, die in die Analyse einfließen
+     */
+    static size_t chartHash(const Radix& radix);
+
+    /**
+     * @brief Sucht eine fertige Analyse
+     * @param key Schlüssel
+     * @param html [out] Gefundenes HTML
+     * @return true wenn vorhanden
+     */
+    bool lookup(const AnalysisKey& key, QString& html);
+
+    /**
+     * @brief Legt eine Analyse ab
+     */
+    void insert(const AnalysisKey& key, const QString& html);
+
+    /**
+     * @brief Liefert die Radix-Textanalyse aus dem Cache oder berechnet sie
+     * @param radix Berechneter Radix
+     * @param auinit Einstellungen (Orben)
+     * @return HTML der Radix-Textanalyse
+     *
+     * Darf aus Worker-Threads aufgerufen werden.
+     */
+    QString analyzeRadix(const Radix& radix, const AuInit& auinit);
+
+    void clear();
+    int count() const;
+
+    int maxEntries() const;
+    void setMaxEntries(int maxEntries);
+
+private:
+    mutable QMutex m_mutex;
+    LruCache<AnalysisKey, QString> m_entries;
+};
+
+/**
+ * @brief Globale Analyse-Cache Instanz
+ */
+AnalysisCache& analysisCache();
+
+} // namespace astro
@@ -4,7 +4,9 @@
  */
 
 #include "astro_font_provider.h"
+#include "instrumentation.h"
 #include <QCoreApplication>
+#include <QDateTime>
 #include <QDebug>
 #include <QDir>
 #include <QFile>
@@ -12,117 +14,309 @@
 #include <QFontDatabase>
 #include <QFontInfo>
 #include <QFontMetrics>
+#include <QSettings>
+#include <QStandardPaths>
 #include <QTextStream>
+#include <QtConcurrent>
 
 namespace astro {
 
+namespace {
+
+// Mitgelieferte Fonts (in Suchreihenfolge)
+QStringList astroFontPfade(const QString &appPath) {
+  return {appPath + "/resources/fonts/asu_____.ttf",
+          appPath + "/fonts/asu_____.ttf",
+          appPath + "/../resources/fonts/asu_____.ttf",
+          appPath + "/../Resources/fonts/asu_____.ttf", // macOS Bundle:
+                                                        // Contents/Resources/fonts
+          ":/fonts/asu_____.ttf"};
+}
+
+QStringList dejaVuFontPfade(const QString &appPath) {
+  return {appPath + "/resources/fonts/DejaVuSans.ttf",
+          appPath + "/fonts/DejaVuSans.ttf",
+          appPath + "/../resources/fonts/DejaVuSans.ttf",
+          appPath + "/../Resources/fonts/DejaVuSans.ttf", // macOS Bundle:
+                                                          // Contents/Resources/fonts
+          ":/fonts/DejaVuSans.ttf",
+          "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
+          "/Library/Fonts/DejaVuSans.ttf",
+          "/System/Library/Fonts/DejaVuSans.ttf"};
+}
+
+QString cacheDatei() {
+  const QString dir =
+      QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+  return dir.isEmpty() ? QString() : dir + "/fonts.ini";
+}
+
+// Erste installierte Familie, die name enthält (leer = keine)
+QString systemFamilie(const QStringList &families, const QString &name) {
+  for (const QString &family : families) {
+    if (family.contains(name, Qt::CaseInsensitive)) {
+      return family;
+    }
+  }
+  return QString();
+}
+
+// Änderungszeit und Größe aller Kandidaten sowie die im System installierten
+// Familien - neue, geänderte oder deinstallierte Fonts machen den Cache
+// ungültig
+QString fontSchluessel(const QStringList &pfade, const QStringList &families) {
+  QString s = QCoreApplication::applicationVersion();
+  for (const QString &path : pfade) {
+    const QFileInfo fi(path);
+    s += '|';
+    if (fi.exists() && fi.isFile()) {
+      s += QString::number(fi.lastModified().toMSecsSinceEpoch()) + ':' +
+           QString::number(fi.size());
+    }
+  }
+  s += '|' + systemFamilie(families, "AstroUniverse");
+  s += '|' + systemFamilie(families, "DejaVu Sans");
+  return s;
+}
+
+// Lädt eine Font-Datei, liefert die erste Familie (leer bei Fehler)
+QString ladeFontDatei(const QString &path) {
+  const QFileInfo fi(path);
+  if (!fi.exists() || !fi.isFile()) {
+    return QString();
+  }
+  const int fontId = QFontDatabase::addApplicationFont(path);
+  if (fontId == -1) {
+    return QString();
+  }
+  const QStringList loadedFamilies =
+      QFontDatabase::applicationFontFamilies(fontId);
+  return loadedFamilies.isEmpty() ? QString() : loadedFamilies.first();
+}
+
+} // namespace
+
 AstroFontProvider &AstroFontProvider::instance() {
   static AstroFontProvider instance;
   return instance;
 }
 
-AstroFontProvider::AstroFontProvider()
-    : m_hasAstroFont(false), m_fontName("Sans Serif"), m_hasSymbolFont(false),
-      m_symbolFontName("Sans Serif"), m_hasDejaVuFont(false),
-      m_dejaVuFontName("Sans Serif") {
+AstroFontProvider::AstroFontProvider() {
   initSymbols();
-  detectFont();
+}
+
+void AstroFontProvider::startDetection() {
+  QMutexLocker locker(&m_startLock);
+  if (m_gestartet.load(std::memory_order_acquire)) {
+    return;
+  }
+  m_gestartet.store(true, std::memory_order_release);
+  m_erkennung = QtConcurrent::run([this] { detectFont(); });
+}
+
+void AstroFontProvider::waitForDetection() {
+  QFuture<void> erkennung;
+  {
+    QMutexLocker locker(&m_startLock);
+    if (!m_gestartet.load(std::memory_order_acquire)) {
+      // Nicht gestartet: im aufrufenden Thread suchen
+      m_gestartet.store(true, std::memory_order_release);
+      detectFont();
+      return;
+    }
+    erkennung = m_erkennung;
+  }
+  erkennung.waitForFinished();
+}
+
+QFuture<void> AstroFontProvider::detection() const {
+  QMutexLocker locker(&m_startLock);
+  return m_erkennung;
+}
+
+const AstroFontProvider::Aufloesung &AstroFontProvider::aufloesung() const {
+  if (const Aufloesung *a = m_aktiv.load(std::memory_order_acquire)) {
+    return *a;
+  }
+  if (!m_gestartet.load(std::memory_order_acquire)) {
+    // Ohne startDetection() (Tests, Werkzeuge): beim ersten Zugriff suchen
+    const_cast<AstroFontProvider *>(this)->waitForDetection();
+    if (const Aufloesung *a = m_aktiv.load(std::memory_order_acquire)) {
+      return *a;
+    }
+  }
+  // Suche läuft noch: Unicode-Symbole und System-Fonts
+  return m_standard;
 }
 
 void AstroFontProvider::detectFont() {
+  ASTRO_TIMER("AstroFontProvider::detectFont");
+  auto ergebnis = std::make_unique<Aufloesung>();
+
+  const QString appPath = QCoreApplication::applicationDirPath();
+  const QStringList families = QFontDatabase::families();
+  const QString schluessel = fontSchluessel(
+      astroFontPfade(appPath) + dejaVuFontPfade(appPath), families);
+  if (ausCache(schluessel, *ergebnis)) {
+    qInfo() << "AstroFontProvider: Fonts aus Cache:" << ergebnis->fontName
+            << ergebnis->planetFontName;
+  } else {
+    *ergebnis = Aufloesung();
+    aufloesen(*ergebnis, families);
+    inCache(schluessel, *ergebnis);
+  }
+
+  m_ergebnis = std::move(ergebnis);
+  m_aktiv.store(m_ergebnis.get(), std::memory_order_release);
+  emit fontsChanged();
+}
+
+bool AstroFontProvider::ausCache(const QString &schluessel,
+                                 Aufloesung &a) const {
+  const QString datei = cacheDatei();
+  if (datei.isEmpty() || !QFileInfo::exists(datei)) {
+    return false;
+  }
+  QSettings cache(datei, QSettings::IniFormat);
+  if (cache.value("schluessel").toString() != schluessel) {
+    return false;
+  }
+
+  a.hasAstroFont = cache.value("astro/vorhanden", false).toBool();
+  a.fontName = cache.value("astro/familie", a.fontName).toString();
+  a.astroFontDatei = cache.value("astro/datei").toString();
+  a.hasDejaVuFont = cache.value("dejavu/vorhanden", false).toBool();
+  a.dejaVuFontName = cache.value("dejavu/familie", a.dejaVuFontName).toString();
+  a.dejaVuFontDatei = cache.value("dejavu/datei").toString();
+  a.planetFontName = cache.value("planet/familie").toString();
+
+  // Mitgelieferte Fonts müssen trotzdem geladen werden; System-Familien
+  // sind über den Schlüssel abgedeckt
+  if (a.hasAstroFont && !a.astroFontDatei.isEmpty() &&
+      ladeFontDatei(a.astroFontDatei) != a.fontName) {
+    return false;
+  }
+  if (a.hasDejaVuFont && !a.dejaVuFontDatei.isEmpty() &&
+      ladeFontDatei(a.dejaVuFontDatei) != a.dejaVuFontName) {
+    return false;
+  }
+  return true;
+}
+
+void AstroFontProvider::inCache(const QString &schluessel,
+                                const Aufloesung &a) const {
+  const QString datei = cacheDatei();
+  if (datei.isEmpty()) {
+    return;
+  }
+  QSettings cache(datei, QSettings::IniFormat);
+  cache.setValue("schluessel", schluessel);
+  cache.setValue("astro/vorhanden", a.hasAstroFont);
+  cache.setValue("astro/familie", a.fontName);
+  cache.setValue("astro/datei", a.astroFontDatei);
+  cache.setValue("dejavu/vorhanden", a.hasDejaVuFont);
+  cache.setValue("dejavu/familie", a.dejaVuFontName);
+  cache.setValue("dejavu/datei", a.dejaVuFontDatei);
+  cache.setValue("planet/familie", a.planetFontName);
+}
+
+void AstroFontProvider::aufloesen(Aufloesung &a,
+                                  const QStringList &families) const {
   QString appPath = QCoreApplication::applicationDirPath();
-  QStringList families = QFontDatabase::families();
 
   // ========== 1. AstroUniverse-Font für Sternzeichen laden ==========
 
   // Prüfe ob der Font bereits im System installiert ist
-  for (const QString &family : families) {
-    if (family.compare("AstroUniverse", Qt::CaseInsensitive) == 0 ||
-        family.contains("AstroUniverse", Qt::CaseInsensitive)) {
-      m_fontName = family;
-      m_hasAstroFont = true;
-      qInfo() << "AstroFontProvider: AstroUniverse-Font im System gefunden:"
-              << family;
-      break;
-    }
+  const QString astroSystem = systemFamilie(families, "AstroUniverse");
+  if (!astroSystem.isEmpty()) {
+    a.fontName = astroSystem;
+    a.hasAstroFont = true;
+    qInfo() << "AstroFontProvider: AstroUniverse-Font im System gefunden:"
+            << astroSystem;
   }
 
   // Falls nicht im System, versuche aus Ressourcen zu laden
-  if (!m_hasAstroFont) {
-    QStringList fontPaths = {
-        appPath + "/resources/fonts/asu_____.ttf",
-        appPath + "/fonts/asu_____.ttf",
-        appPath + "/../resources/fonts/asu_____.ttf",
-        appPath +
-            "/../Resources/fonts/asu_____.ttf", // macOS Bundle:
-                                                // Contents/Resources/fonts
-        ":/fonts/asu_____.ttf"};
-
-    for (const QString &path : fontPaths) {
-      QFileInfo fi(path);
-      if (fi.exists() && fi.isFile()) {
-        int fontId = QFontDatabase::addApplicationFont(path);
-        if (fontId != -1) {
-          QStringList loadedFamilies =
-              QFontDatabase::applicationFontFamilies(fontId);
-          if (!loadedFamilies.isEmpty()) {
-            m_fontName = loadedFamilies.first();
-            m_hasAstroFont = true;
-            qInfo() << "AstroFontProvider: AstroUniverse-Font geladen aus:"
-                    << path;
-            break;
-          }
-        }
+  if (!a.hasAstroFont) {
+    for (const QString &path : astroFontPfade(appPath)) {
+      const QString family = ladeFontDatei(path);
+      if (!family.isEmpty()) {
+        a.fontName = family;
+        a.astroFontDatei = path;
+        a.hasAstroFont = true;
+        qInfo() << "AstroFontProvider: AstroUniverse-Font geladen aus:"
+                << path;
+        break;
       }
     }
   }
 
-  if (!m_hasAstroFont) {
+  if (!a.hasAstroFont) {
     qInfo() << "AstroFontProvider: AstroUniverse-Font nicht gefunden, verwende "
                "Unicode-Symbole für Sternzeichen";
   }
   // ========== 2. DejaVu Sans laden (enthält Asteroiden-Glyphen U+26B3-U+26B8)
   // ==========
-  QStringList dejaVuFontPaths = {
-      appPath + "/resources/fonts/DejaVuSans.ttf",
-      appPath + "/fonts/DejaVuSans.ttf",
-      appPath + "/../resources/fonts/DejaVuSans.ttf",
-      appPath +
-          "/../Resources/fonts/DejaVuSans.ttf", // macOS Bundle:
-                                                // Contents/Resources/fonts
-      ":/fonts/DejaVuSans.ttf",
-      "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
-      "/Library/Fonts/DejaVuSans.ttf", "/System/Library/Fonts/DejaVuSans.ttf"};
-  for (const QString &path : dejaVuFontPaths) {
-    QFileInfo fi(path);
-    if (fi.exists() && fi.isFile()) {
-      int fontId = QFontDatabase::addApplicationFont(path);
-      if (fontId != -1) {
-        QStringList loadedFamilies =
-            QFontDatabase::applicationFontFamilies(fontId);
-        if (!loadedFamilies.isEmpty()) {
-          m_dejaVuFontName = loadedFamilies.first();
-          m_hasDejaVuFont = true;
-          qInfo() << "AstroFontProvider: DejaVu Sans geladen aus:" << path;
-          break;
-        }
-      }
+  for (const QString &path : dejaVuFontPfade(appPath)) {
+    const QString family = ladeFontDatei(path);
+    if (!family.isEmpty()) {
+      a.dejaVuFontName = family;
+      a.dejaVuFontDatei = path;
+      a.hasDejaVuFont = true;
+      qInfo() << "AstroFontProvider: DejaVu Sans geladen aus:" << path;
+      break;
     }
   }
-  if (!m_hasDejaVuFont) {
-    for (const QString &family : families) {
-      if (family.contains("DejaVu Sans", Qt::CaseInsensitive)) {
-        m_dejaVuFontName = family;
-        m_hasDejaVuFont = true;
-        qInfo() << "AstroFontProvider: DejaVu Sans im System gefunden:"
-                << family;
-        break;
-      }
+  if (!a.hasDejaVuFont) {
+    const QString dejaVuSystem = systemFamilie(families, "DejaVu Sans");
+    if (!dejaVuSystem.isEmpty()) {
+      a.dejaVuFontName = dejaVuSystem;
+      a.hasDejaVuFont = true;
+      qInfo() << "AstroFontProvider: DejaVu Sans im System gefunden:"
+              << dejaVuSystem;
     }
   }
-  if (!m_hasDejaVuFont) {
+  if (!a.hasDejaVuFont) {
     qInfo() << "AstroFontProvider: DejaVu Sans nicht gefunden";
   }
+
+  // ========== 3. Font für Planeten/Asteroiden nach Glyph-Abdeckung ==========
+  // DejaVu Sans hat auch die Aspekt-Glyphen (U+26B9, U+26BA, U+26BB, U+260C,
+  // U+260D)
+  const QVector<uint> asteroidGlyphs = {
+      0x26B3, 0x26B4, 0x26B5, 0x26B6,
+      0x26B7, 0x26B8 // Asteroiden: Ceres, Pallas, Juno, Vesta, Chiron, Lilith
+  };
+
+  struct Candidate {
+    QString name;
+    bool available;
+  };
+  QList<Candidate> candidates;
+  candidates.append({a.dejaVuFontName, a.hasDejaVuFont});
+  candidates.append({a.symbolFontName, a.hasSymbolFont});
+  candidates.append({"DejaVu Sans", true});
+  candidates.append({"Apple Symbols", true});
+  candidates.append({"Segoe UI Symbol", true});
+
+  for (const Candidate &c : candidates) {
+    if (!c.available || c.name.isEmpty()) {
+      continue;
+    }
+    QFont font(c.name, 12);
+    font.setStyleStrategy(QFont::PreferMatch);
+    QFontMetrics fm(font);
+    bool ok = true;
+    for (uint cp : asteroidGlyphs) {
+      if (!fm.inFontUcs4(cp)) {
+        ok = false;
+        break;
+      }
+    }
+    if (ok) {
+      a.planetFontName = c.name;
+      break;
+    }
+  }
 }
 
 void AstroFontProvider::initSymbols() {
@@ -238,49 +432,21 @@ void AstroFontProvider::initSymbols() {
 }
 
 QFont AstroFontProvider::getSymbolFont(int pointSize) const {
+  const Aufloesung &a = aufloesung();
   // AstroUniverse-Font 4pt größer darstellen für bessere Lesbarkeit
-  int adjustedSize = m_hasAstroFont ? pointSize + 3 : pointSize;
-  QFont font(m_fontName, adjustedSize);
+  int adjustedSize = a.hasAstroFont ? pointSize + 3 : pointSize;
+  QFont font(a.fontName, adjustedSize);
   return font;
 }
 
 QFont AstroFontProvider::getPlanetSymbolFont(int pointSize) const {
-  // Prüfe Fonts nach Glyph-Abdeckung für Asteroiden (U+26B3 bis U+26B8)
-  // DejaVu Sans hat auch die Aspekt-Glyphen (U+26B9, U+26BA, U+26BB, U+260C,
-  // U+260D)
-  const QVector<uint> asteroidGlyphs = {
-      0x26B3, 0x26B4, 0x26B5, 0x26B6,
-      0x26B7, 0x26B8 // Asteroiden: Ceres, Pallas, Juno, Vesta, Chiron, Lilith
-  };
-
-  struct Candidate {
-    QString name;
-    bool available;
-  };
-  QList<Candidate> candidates;
-  candidates.append({m_dejaVuFontName, m_hasDejaVuFont});
-  candidates.append({m_symbolFontName, m_hasSymbolFont});
-  candidates.append({"DejaVu Sans", true});
-  candidates.append({"Apple Symbols", true});
-  candidates.append({"Segoe UI Symbol", true});
-
-  for (const Candidate &c : candidates) {
-    if (!c.available || c.name.isEmpty()) {
-      continue;
-    }
-    QFont font(c.name, pointSize);
+  // Font mit Asteroiden-Glyphen (U+26B3 bis U+26B8) wird bei der
+  // Font-Suche einmal ermittelt
+  const Aufloesung &a = aufloesung();
+  if (!a.planetFontName.isEmpty()) {
+    QFont font(a.planetFontName, pointSize);
     font.setStyleStrategy(QFont::PreferMatch);
-    QFontMetrics fm(font);
-    bool ok = true;
-    for (uint cp : asteroidGlyphs) {
-      if (!fm.inFontUcs4(cp)) {
-        ok = false;
-        break;
-      }
-    }
-    if (ok) {
-      return font;
-    }
+    return font;
   }
 
   return QFont("Sans Serif", pointSize);
@@ -303,7 +469,7 @@ QString AstroFontProvider::sternzeichenSymbol(int index) const {
     return "?";
 
   // User Request: Unbedingt AstroUniverse Font verwenden wenn verfügbar!
-  if (m_hasAstroFont) {
+  if (aufloesung().hasAstroFont) {
     return m_legacySternzeichenSymbols.value(index);
   } else {
     return m_unicodeSternzeichenSymbols.value(index);
@@ -12,6 +12,11 @@
 #include <QString>
 #include <QStringList>
 #include <QFont>
+#include <QFuture>
+#include <QMutex>
+#include <QObject>
+#include <atomic>
+#include <memory>
 
 namespace astro {
 
@@ -23,15 +28,43 @@ namespace astro {
  * mit speziellen Zeichen für Planeten und Sternzeichen.
  * Diese Klasse prüft ob der Font verfügbar ist und liefert
  * entweder die Legacy-Zeichen oder Unicode-Fallbacks.
+ *
+ * Die Font-Suche kann mit startDetection() im Hintergrund laufen; bis
+ * sie fertig ist, liefern alle Zugriffe Unicode-Symbole und System-Fonts.
+ * Ohne startDetection() wird beim ersten Zugriff synchron gesucht. Das
+ * Ergebnis wird im Cache-Verzeichnis gespeichert und beim nächsten Start
+ * übernommen, solange sich weder die mitgelieferten Font-Dateien noch die
+ * im System installierten AstroUniverse-/DejaVu-Familien ändern.
  */
-class AstroFontProvider {
+class AstroFontProvider : public QObject {
+    Q_OBJECT
 public:
     static AstroFontProvider& instance();
+
+    /**
+     * @brief Startet die Font-Suche im Hintergrund (einmalig)
+     */
+    void startDetection();
+
+    /**
+     * @brief Wartet auf das Ende der Font-Suche (startet sie bei Bedarf)
+     */
+    void waitForDetection();
+
+    /**
+     * @brief true, sobald die gefundenen Fonts gelten
+     */
+    bool isReady() const { return m_aktiv.load(std::memory_order_acquire) != nullptr; }
+
+    /**
+     * @brief Laufende Suche (z.B. für QFutureWatcher), leer ohne startDetection()
+     */
+    QFuture<void> detection() const;
     
     /**
      * @brief Prüft ob der AstroUniverse-Font verfügbar ist
      */
-    bool hasAstroFont() const { return m_hasAstroFont; }
+    bool hasAstroFont() const { return aufloesung().hasAstroFont; }
     
     /**
      * @brief Gibt den Font für Astrologie-Symbole zurück
@@ -43,7 +76,7 @@ public:
     /**
      * @brief Gibt den Font-Namen zurück
      */
-    QString fontName() const { return m_fontName; }
+    QString fontName() const { return aufloesung().fontName; }
     
     /**
      * @brief Gibt den Font für Planeten/Asteroiden-Symbole zurück (Noto Sans Symbols 2)
@@ -53,7 +86,7 @@ public:
     /**
      * @brief Prüft ob Noto Sans Symbols 2 verfügbar ist
      */
-    bool hasSymbolFont() const { return m_hasSymbolFont; }
+    bool hasSymbolFont() const { return aufloesung().hasSymbolFont; }
     
     // Planeten-Symbole (Index entspricht P_SONNE, P_MOND, etc.)
     QString planetSymbol(int planet) const;
@@ -79,20 +112,47 @@ public:
     // Grad-Symbol
     QString gradSymbol() const;
 
+signals:
+    /**
+     * @brief Die Font-Suche ist fertig, Symbole und Fonts gelten ab jetzt
+     *
+     * Kommt aus dem Such-Thread; Empfänger im GUI-Thread erhalten das
+     * Signal über die Ereignisschleife. Bereits erzeugte Texte mit den
+     * vorläufigen Symbolen müssen neu aufgebaut werden.
+     */
+    void fontsChanged();
+
 private:
     AstroFontProvider();
     ~AstroFontProvider() = default;
     
+    // Ergebnis der Font-Suche
+    struct Aufloesung {
+        bool hasAstroFont = false;
+        QString fontName = "Sans Serif";
+        QString astroFontDatei;         // Leer = im System installiert
+        bool hasSymbolFont = false;
+        QString symbolFontName = "Sans Serif";
+        bool hasDejaVuFont = false;
+        QString dejaVuFontName = "Sans Serif";
+        QString dejaVuFontDatei;
+        QString planetFontName;         // Font mit Asteroiden-Glyphen, leer = keiner
+    };
+
     void detectFont();
+    void aufloesen(Aufloesung& a, const QStringList& families) const;
+    bool ausCache(const QString& schluessel, Aufloesung& a) const;
+    void inCache(const QString& schluessel, const Aufloesung& a) const;
     void initSymbols();
-    
-    bool m_hasAstroFont;
-    QString m_fontName;
-    
-    bool m_hasSymbolFont;
-    QString m_symbolFontName;
-    bool m_hasDejaVuFont;
-    QString m_dejaVuFontName;
+
+    const Aufloesung& aufloesung() const;
+
+    Aufloesung m_standard;                          // Bis die Suche fertig ist
+    std::unique_ptr<Aufloesung> m_ergebnis;
+    std::atomic<const Aufloesung*> m_aktiv{ nullptr };
+    std::atomic<bool> m_gestartet{ false };
+    mutable QMutex m_startLock;
+    QFuture<void> m_erkennung;
     
     // Legacy-Font Zeichen (wenn AstroUniverse installiert)
     // Diese entsprechen den Zeichen aus legacy/auwurzel.h szLNANamen[]
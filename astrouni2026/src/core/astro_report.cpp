@@ -0,0 +1,358 @@
+/**
+ * @file astro_report.cpp
+ * @brief Implementierung von Report-Puffer und Ausgabe
+ */
+
+#include "astro_report.h"
+#include "astro_font_provider.h"
+
+namespace astro {
+
+namespace {
+
+QLatin1String rolleText(char rolle) {
+    switch (rolle) {
+        case 'T': return QLatin1String(" (T)");
+        case 'R': return QLatin1String(" (R)");
+        case 'A': return QLatin1String(" (A)");
+        case 'B': return QLatin1String(" (B)");
+        default:  return QLatin1String();
+    }
+}
+
+QString planetSymbol(int planet) {
+    return (planet >= 0 && planet < MAX_PLANET) ? QString::fromUtf8(PLANET_SYMBOLS[planet]) : QString();
+}
+
+/**
+ * Fließtext aus dem Katalog als reiner Text: Tags weglassen, Absätze und
+ * Zeilenumbrüche als Zeilenende, die üblichen Entities auflösen. Ein '<'
+ * ohne schließendes '>' bleibt als Zeichen stehen.
+ */
+void appendOhneTags(QString& out, QStringView html) {
+    static const struct { QLatin1String entity; QChar zeichen; } ENTITIES[] = {
+        { QLatin1String("&amp;"), QChar('&') },
+        { QLatin1String("&lt;"), QChar('<') },
+        { QLatin1String("&gt;"), QChar('>') },
+        { QLatin1String("&quot;"), QChar('"') },
+        { QLatin1String("&#39;"), QChar('\'') },
+        { QLatin1String("&nbsp;"), QChar(' ') },
+    };
+
+    qsizetype i = 0;
+    while (i < html.size()) {
+        const QChar c = html[i];
+        if (c == QChar('<')) {
+            const qsizetype ende = html.indexOf(QChar('>'), i);
+            if (ende < 0) {
+                out += c;
+                ++i;
+                continue;
+            }
+            const QStringView tag = html.sliced(i + 1, ende - i - 1);
+            if (tag.startsWith(QLatin1String("/p"), Qt::CaseInsensitive)
+                || tag.startsWith(QLatin1String("br"), Qt::CaseInsensitive)
+                || (tag.startsWith(QLatin1String("/h"), Qt::CaseInsensitive) && tag.size() == 3)) {
+                out += '\n';
+            }
+            i = ende + 1;
+        } else if (c == QChar('&')) {
+            bool ersetzt = false;
+            for (const auto& e : ENTITIES) {
+                if (html.sliced(i).startsWith(e.entity)) {
+                    out += e.zeichen;
+                    i += e.entity.size();
+                    ersetzt = true;
+                    break;
+                }
+            }
+            if (!ersetzt) {
+                out += c;
+                ++i;
+            }
+        } else {
+            out += c;
+            ++i;
+        }
+    }
+}
+
+void appendUnterstrichen(QString& out, QStringView text, QChar linie) {
+    out += text;
+    out += '\n';
+    out += QString(text.size(), linie);
+    out += '\n';
+}
+
+} // namespace
+
+//==============================================================================
+// AstroReport
+//==============================================================================
+
+void AstroReport::clear() {
+    // resize statt clear: Kapazität bleibt erhalten
+    m_eintraege.resize(0);
+    m_text.resize(0);
+}
+
+void AstroReport::reserve(int fragmente, int zeichen) {
+    m_eintraege.reserve(fragmente);
+    m_text.reserve(zeichen);
+}
+
+AstroReport::Bereich AstroReport::ablegen(QStringView s) {
+    Bereich b;
+    b.beginn = m_text.size();
+    b.laenge = s.size();
+    m_text += s;
+    return b;
+}
+
+QStringView AstroReport::sicht(const Bereich& b) const {
+    return QStringView(m_text).sliced(b.beginn, b.laenge);
+}
+
+void AstroReport::fragment(const ReportFragment& f) {
+    Eintrag e;
+    e.typ = f.typ;
+    e.planet1 = f.planet1;
+    e.planet2 = f.planet2;
+    e.zeichen = f.zeichen;
+    e.aspekt = f.aspekt;
+    e.rolle1 = f.rolle1;
+    e.rolle2 = f.rolle2;
+    e.text = ablegen(f.text);
+    e.name = ablegen(f.name);
+    e.zusatz = ablegen(f.zusatz);
+    m_eintraege.append(e);
+}
+
+ReportFragment AstroReport::at(int i) const {
+    const Eintrag& e = m_eintraege[i];
+    ReportFragment f;
+    f.typ = e.typ;
+    f.planet1 = e.planet1;
+    f.planet2 = e.planet2;
+    f.zeichen = e.zeichen;
+    f.aspekt = e.aspekt;
+    f.rolle1 = e.rolle1;
+    f.rolle2 = e.rolle2;
+    f.text = sicht(e.text);
+    f.name = sicht(e.name);
+    f.zusatz = sicht(e.zusatz);
+    return f;
+}
+
+void AstroReport::render(ReportSink& sink) const {
+    sink.beginReport();
+    for (int i = 0; i < m_eintraege.size(); ++i) {
+        sink.fragment(at(i));
+    }
+    sink.endReport();
+}
+
+QString AstroReport::toHtml(const QString& stil) const {
+    QString html;
+    html.reserve(m_text.size() + 64 * m_eintraege.size() + 1024);
+    HtmlReportSink sink(html, stil);
+    render(sink);
+    return html;
+}
+
+QString AstroReport::toPlainText() const {
+    QString text;
+    text.reserve(m_text.size() + 8 * m_eintraege.size());
+    PlainTextReportSink sink(text);
+    render(sink);
+    return text;
+}
+
+//==============================================================================
+// HtmlReportSink
+//==============================================================================
+
+HtmlReportSink::HtmlReportSink(QString& out, const QString& stil)
+    : m_out(out) {
+    // Font-Namen vom AstroFontProvider holen
+    const QString signFont = astroFont().fontName();  // AstroUniverse für Sternzeichen
+    const QString planetFont = astroFont().getPlanetSymbolFont().family();  // DejaVu Sans für Planeten/Asteroiden
+
+    m_kopf = "<html><head><style>";
+    m_kopf += "body { font-family: Arial, sans-serif; font-size: 11pt; }";
+    m_kopf += "h1 { color: #2c3e50; font-size: 16pt; margin-top: 20px; }";
+    m_kopf += "h2 { color: #34495e; font-size: 14pt; margin-top: 15px; }";
+    m_kopf += "h3 { color: #7f8c8d; font-size: 12pt; margin-top: 10px; }";
+    m_kopf += "p { margin: 8px 0; line-height: 1.5; }";
+    m_kopf += QString(".planet-symbol { font-family: '%1'; font-size: 14pt; color: #e74c3c; }").arg(planetFont);
+    m_kopf += QString(".sign-symbol { font-family: '%1'; font-size: 17pt; color: #3498db; }").arg(signFont);
+    m_kopf += QString(".aspect-symbol { font-family: '%1'; font-size: 12pt; color: #9b59b6; }").arg(planetFont);
+    m_kopf += "</style>";
+    if (!stil.isEmpty()) {
+        m_kopf += "<style>" + stil + "</style>";
+    }
+    m_kopf += "</head><body>";
+}
+
+QString HtmlReportSink::druckStil() {
+    return QStringLiteral(
+        "body { font-family: 'DejaVu Sans'; font-size: 9pt; } "
+        "h1 { font-size: 14pt; font-weight: bold; } "
+        "h2 { font-size: 10pt; font-weight: bold; } "
+        "h3 { font-size: 9pt; font-weight: bold; } "
+        "p { font-size: 9pt; margin-bottom: 10px; }");
+}
+
+void HtmlReportSink::beginReport() {
+    m_out += m_kopf;
+}
+
+void HtmlReportSink::endReport() {
+    m_out += "</body></html>";
+}
+
+void HtmlReportSink::fragment(const ReportFragment& f) {
+    QString& o = m_out;
+    switch (f.typ) {
+        case ReportTyp::Titel:
+            o += "<h1>";
+            o += f.text;
+            o += "</h1>";
+            break;
+        case ReportTyp::Abschnitt:
+            o += "<h2>";
+            o += f.text;
+            o += "</h2>";
+            break;
+        case ReportTyp::Zwischentitel:
+            o += "<h3>";
+            o += f.text;
+            o += "</h3>";
+            break;
+        case ReportTyp::Text:
+            o += f.text;
+            break;
+        case ReportTyp::Absatz:
+            o += "<p>";
+            o += f.text;
+            o += "</p>";
+            break;
+        case ReportTyp::Hinweis:
+            o += "<p><i>";
+            o += f.text;
+            o += "</i></p>";
+            break;
+        case ReportTyp::Trenner:
+            o += "<hr>";
+            break;
+        case ReportTyp::Stellung:
+            o += "<h2>";
+            if (f.planet1 >= 0) {
+                o += planetSymbol(f.planet1);
+            } else {
+                o += f.zusatz;
+            }
+            o += ' ';
+            o += f.text;
+            o += ": ";
+            o += f.name;
+            o += "</h2><p class='sign-symbol'>";
+            o += astroFont().sternzeichenSymbol(f.zeichen);
+            o += "</p>";
+            break;
+        case ReportTyp::Aspekt:
+            o += "<h3><span class='planet-symbol'>";
+            o += planetSymbol(f.planet1);
+            o += "</span> ";
+            o += f.text;
+            o += rolleText(f.rolle1);
+            o += " <span class='aspect-symbol'>";
+            o += f.name;
+            o += "</span> ";
+            if (f.planet2 >= 0) {
+                o += "<span class='planet-symbol'>";
+                o += planetSymbol(f.planet2);
+                o += "</span> ";
+                o += f.zusatz;
+                o += rolleText(f.rolle2);
+            } else {
+                o += f.zusatz;
+            }
+            o += "</h3>";
+            break;
+    }
+}
+
+//==============================================================================
+// PlainTextReportSink
+//==============================================================================
+
+void PlainTextReportSink::fragment(const ReportFragment& f) {
+    QString& o = m_out;
+    switch (f.typ) {
+        case ReportTyp::Titel:
+            appendUnterstrichen(o, f.text, QChar('='));
+            o += '\n';
+            break;
+        case ReportTyp::Abschnitt:
+            o += '\n';
+            appendUnterstrichen(o, f.text, QChar('-'));
+            break;
+        case ReportTyp::Zwischentitel:
+        case ReportTyp::Absatz:
+        case ReportTyp::Hinweis:
+            o += f.text;
+            o += '\n';
+            break;
+        case ReportTyp::Text:
+            appendOhneTags(o, f.text);
+            if (!o.endsWith(QChar('\n'))) {
+                o += '\n';
+            }
+            break;
+        case ReportTyp::Trenner:
+            o += '\n';
+            break;
+        case ReportTyp::Stellung:
+            if (f.planet1 >= 0) {
+                o += planetSymbol(f.planet1);
+            } else {
+                o += f.zusatz;
+            }
+            o += ' ';
+            o += f.text;
+            o += ": ";
+            o += f.name;
+            if (f.zeichen >= 0 && f.zeichen < 12) {
+                o += ' ';
+                o += QString::fromUtf8(STERNZEICHEN_SYMBOLS[f.zeichen]);
+            }
+            o += '\n';
+            break;
+        case ReportTyp::Aspekt:
+            o += '\n';
+            o += planetSymbol(f.planet1);
+            o += ' ';
+            o += f.text;
+            o += rolleText(f.rolle1);
+            o += ' ';
+            o += f.name;
+            o += ' ';
+            if (f.planet2 >= 0) {
+                o += planetSymbol(f.planet2);
+                o += ' ';
+                o += f.zusatz;
+                o += rolleText(f.rolle2);
+            } else {
+                o += f.zusatz;
+            }
+            o += '\n';
+            break;
+    }
+}
+
+void PlainTextReportSink::endReport() {
+    m_out += '\n';
+}
+
+} // namespace astro
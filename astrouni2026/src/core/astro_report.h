@@ -0,0 +1,159 @@
+#pragma once
+/**
+ * @file astro_report.h
+ * @brief Strukturierte Textanalyse: Fragmente, Puffer und Ausgabe
+ *
+ * AstroTextAnalyzer erzeugt eine Analyse als Folge typisierter Fragmente
+ * (Überschrift, Stellung, Aspekt, Fließtext) an einen ReportSink. Die
+ * Sinks schreiben daraus direkt HTML oder reinen Text; AstroReport
+ * sammelt die Fragmente in einem wiederverwendbaren Puffer, der beliebig
+ * oft ausgegeben werden kann.
+ */
+
+#include "constants.h"
+#include <QString>
+#include <QStringView>
+#include <QVector>
+
+namespace astro {
+
+/**
+ * @brief Art eines Fragments
+ */
+enum class ReportTyp : uint8_t {
+    Titel,          // Haupt-Überschrift
+    Abschnitt,      // Abschnitts-Überschrift
+    Zwischentitel,  // Kleine Überschrift
+    Text,           // Fließtext aus dem Textkatalog (HTML, unverändert)
+    Absatz,         // Reiner Text als Absatz
+    Hinweis,        // Reiner Text als kursiver Absatz
+    Trenner,        // Trennlinie
+    Stellung,       // Körper (oder Achse) im Zeichen
+    Aspekt          // Aspekt zwischen zwei Körpern oder Körper und Achse
+};
+
+/**
+ * @brief Ein Fragment der Analyse
+ *
+ * Die Texte sind Sichten - sie gelten nur während des Aufrufs von
+ * ReportSink::fragment().
+ *
+ * Stellung: planet1 (oder Achse in zusatz) in zeichen, text = Bezeichnung,
+ * name = Zeichen-Name.
+ * Aspekt: planet1 aspekt planet2 (oder Achse in zusatz), text = Name 1,
+ * name = Aspekt-Name, zusatz = Name 2; rolle1/rolle2 kennzeichnen die
+ * Horoskope (z.B. 'T'/'R' bei Transit), 0 = ohne.
+ */
+struct ReportFragment {
+    ReportTyp   typ = ReportTyp::Absatz;
+    int8_t      planet1 = -1;
+    int8_t      planet2 = -1;
+    int8_t      zeichen = -1;
+    int16_t     aspekt = KEIN_ASP;
+    char        rolle1 = 0;
+    char        rolle2 = 0;
+    QStringView text;
+    QStringView name;
+    QStringView zusatz;
+};
+
+/**
+ * @brief Empfänger der Fragmente einer oder mehrerer Analysen
+ */
+class ReportSink {
+public:
+    virtual ~ReportSink() = default;
+    virtual void beginReport() {}
+    virtual void fragment(const ReportFragment& f) = 0;
+    virtual void endReport() {}
+};
+
+/**
+ * @brief Fragmente im Puffer
+ *
+ * clear() behält den Speicher - ein AstroReport über viele Analysen
+ * hinweg wiederverwendet wächst nur bis zur größten.
+ */
+class AstroReport : public ReportSink {
+public:
+    void clear();
+    void reserve(int fragmente, int zeichen);
+
+    void fragment(const ReportFragment& f) override;
+
+    int size() const { return m_eintraege.size(); }
+    bool isEmpty() const { return m_eintraege.isEmpty(); }
+    ReportFragment at(int i) const;
+
+    /**
+     * @brief Gibt alle Fragmente an einen anderen Sink (mit begin/end)
+     */
+    void render(ReportSink& sink) const;
+
+    QString toHtml(const QString& stil = QString()) const;
+    QString toPlainText() const;
+
+private:
+    struct Bereich {
+        int beginn = 0;
+        int laenge = 0;
+    };
+    struct Eintrag {
+        ReportTyp typ;
+        int8_t    planet1;
+        int8_t    planet2;
+        int8_t    zeichen;
+        int16_t   aspekt;
+        char      rolle1;
+        char      rolle2;
+        Bereich   text;
+        Bereich   name;
+        Bereich   zusatz;
+    };
+
+    Bereich ablegen(QStringView s);
+    QStringView sicht(const Bereich& b) const;
+
+    QVector<Eintrag> m_eintraege;
+    QString m_text;     // Alle Texte hintereinander
+};
+
+/**
+ * @brief Schreibt HTML (Layout der Analyse-Ansicht)
+ *
+ * stil wird als zusätzlicher Style-Block in den Kopf geschrieben
+ * (z.B. Schriften für den PDF-Export).
+ */
+class HtmlReportSink : public ReportSink {
+public:
+    explicit HtmlReportSink(QString& out, const QString& stil = QString());
+
+    /**
+     * @brief Zusätzliche Styles für den Druck (DejaVu Sans 9pt)
+     */
+    static QString druckStil();
+
+    void beginReport() override;
+    void fragment(const ReportFragment& f) override;
+    void endReport() override;
+
+private:
+    QString& m_out;
+    QString m_kopf;     // <html>...<body>, einmal je Sink
+};
+
+/**
+ * @brief Schreibt reinen Text (Überschriften unterstrichen)
+ */
+class PlainTextReportSink : public ReportSink {
+public:
+    explicit PlainTextReportSink(QString& out) : m_out(out) {}
+
+    void fragment(const ReportFragment& f) override;
+    void endReport() override;
+
+private:
+    QString& m_out;
+};
+
+} // namespace astro
@@ -6,8 +6,10 @@
 #include "astro_text_analyzer.h"
 #include "constants.h"
 #include "astro_text_store.h"
+#include "instrumentation.h"
 #include "astro_font_provider.h"
 #include "calculations.h"
+#include "synastry.h"
 #include <QStringList>
 
 namespace astro {
@@ -75,28 +77,134 @@ bool AstroTextAnalyzer::checkAspektWithOrben(double pos1, double pos2, int p1, i
   return abweichung <= orb;
 }
 
+namespace {
+
+// Reservierung für den HTML-Text einer Analyse (Katalog-Texte je Aspekt)
+constexpr int HTML_RESERVE = 64 * 1024;
+
+void emitText(ReportSink &sink, ReportTyp typ, const QString &text) {
+  ReportFragment f;
+  f.typ = typ;
+  f.text = text;
+  sink.fragment(f);
+}
+
+void emitStellung(ReportSink &sink, int planet, const QString &achse,
+                  const QString &label, int8_t zeichen, const QString &zeichenName) {
+  ReportFragment f;
+  f.typ = ReportTyp::Stellung;
+  f.planet1 = static_cast<int8_t>(planet);
+  f.zeichen = zeichen;
+  f.text = label;
+  f.name = zeichenName;
+  f.zusatz = achse;
+  sink.fragment(f);
+}
+
+// planet2 < 0: Aspekt zur Achse (name2 = "ASC"/"MC")
+void emitAspekt(ReportSink &sink, int planet1, const QString &name1, char rolle1,
+                int16_t aspekt, const QString &aspektName,
+                int planet2, const QString &name2, char rolle2) {
+  ReportFragment f;
+  f.typ = ReportTyp::Aspekt;
+  f.planet1 = static_cast<int8_t>(planet1);
+  f.planet2 = static_cast<int8_t>(planet2);
+  f.aspekt = aspekt;
+  f.rolle1 = rolle1;
+  f.rolle2 = rolle2;
+  f.text = name1;
+  f.name = aspektName;
+  f.zusatz = name2;
+  sink.fragment(f);
+}
+
+} // namespace
+
 QString AstroTextAnalyzer::analyzeTransit(const Radix &radix) const {
+  ASTRO_TIMER("AstroTextAnalyzer::analyzeTransit");
+  astroTextStore().ensureLoaded();
   QString html;
+  html.reserve(HTML_RESERVE);
+  HtmlReportSink sink(html);
+  sink.beginReport();
+  buildTransitReport(radix, analyzerLang(), sink);
+  sink.endReport();
+  return html;
+}
+
+QString AstroTextAnalyzer::analyzeSynastry(const Radix &radix) const {
+  ASTRO_TIMER("AstroTextAnalyzer::analyzeSynastry");
+  astroTextStore().ensureLoaded();
+  QString html;
+  html.reserve(HTML_RESERVE);
+  HtmlReportSink sink(html);
+  sink.beginReport();
+  buildSynastryReport(radix, analyzerLang(), sink);
+  sink.endReport();
+  return html;
+}
+
+//==============================================================================
+// Hauptanalyse-Funktion
+//==============================================================================
+
+QString AstroTextAnalyzer::analyzeRadix(const Radix &radix) const {
+  ASTRO_TIMER("AstroTextAnalyzer::analyzeRadix");
+  QString html;
+  html.reserve(HTML_RESERVE);
+  HtmlReportSink sink(html);
+  buildReport(radix, sink);
+  return html;
+}
 
+void AstroTextAnalyzer::buildReport(const Radix &radix, ReportSink &sink) const {
   astroTextStore().ensureLoaded();
   const QString lang = analyzerLang();
 
-  // Font-Namen vom AstroFontProvider holen
-  QString signFont = astroFont().fontName();  // AstroUniverse für Sternzeichen
-  QString planetFont = astroFont().getPlanetSymbolFont().family();  // DejaVu Sans für Planeten/Asteroiden
-
-  // HTML-Header mit korrekten Font-Zuordnungen
-  html += "<html><head><style>";
-  html += "body { font-family: Arial, sans-serif; font-size: 11pt; }";
-  html += "h1 { color: #2c3e50; font-size: 16pt; margin-top: 20px; }";
-  html += "h2 { color: #34495e; font-size: 14pt; margin-top: 15px; }";
-  html += "h3 { color: #7f8c8d; font-size: 12pt; margin-top: 10px; }";
-  html += "p { margin: 8px 0; line-height: 1.5; }";
-  html += QString(".planet-symbol { font-family: '%1'; font-size: 14pt; color: #e74c3c; }").arg(planetFont);
-  html += QString(".sign-symbol { font-family: '%1'; font-size: 17pt; color: #3498db; }").arg(signFont);
-  html += QString(".aspect-symbol { font-family: '%1'; font-size: 12pt; color: #9b59b6; }").arg(planetFont);
-  html += "</style></head><body>";
+  sink.beginReport();
+  // Dispatch basierend auf Horoskop-Typ
+  if (radix.horoTyp == TYP_TRANSIT) {
+    buildTransitReport(radix, lang, sink);
+  } else if (radix.horoTyp == TYP_SYNASTRIE) {
+    buildSynastryReport(radix, lang, sink);
+  } else {
+    buildRadixReport(radix, lang, sink);
+  }
+  sink.endReport();
+}
+
+int AstroTextAnalyzer::buildReports(const QVector<Radix> &charts,
+                                    const std::function<void(int, const AstroReport &)> &fertig) const {
+  ASTRO_TIMER("AstroTextAnalyzer::buildReports");
+  astroTextStore().ensureLoaded();
+  const QString lang = analyzerLang();
+
+  // Ein Puffer für alle Horoskope - wächst nur bis zur größten Analyse
+  AstroReport report;
+  report.reserve(256, HTML_RESERVE);
+
+  int anzahl = 0;
+  for (int i = 0; i < charts.size(); ++i) {
+    const Radix &radix = charts[i];
+    report.clear();
+    if (radix.horoTyp == TYP_TRANSIT) {
+      buildTransitReport(radix, lang, report);
+    } else if (radix.horoTyp == TYP_SYNASTRIE) {
+      buildSynastryReport(radix, lang, report);
+    } else {
+      buildRadixReport(radix, lang, report);
+    }
+    ASTRO_COUNT("AstroTextAnalyzer::buildReports/fragments", report.size());
+    if (fertig) {
+      fertig(i, report);
+    }
+    ++anzahl;
+  }
+  return anzahl;
+}
 
+void AstroTextAnalyzer::buildTransitReport(const Radix &radix, const QString &lang,
+                                           ReportSink &sink) const {
   // Bei Transit: radix.synastrie enthält das Radix (Geburtsdatum), radix enthält Transit-Datum
   // Aber die Struktur ist so aufgebaut, dass radix.rFix das Geburtsdatum enthält
   // und radix.synastrie->rFix das Transit-Datum
@@ -119,8 +227,6 @@ QString AstroTextAnalyzer::analyzeTransit(const Radix &radix) const {
                            .arg(radix.rFix.jahr)
                            .arg(nStunde, 2, 10, QChar('0'))
                            .arg(nMinute, 2, 10, QChar('0'));
-  QString ort = radix.rFix.ort;
-  if (ort.isEmpty()) ort = "---";
   
   // Transit-Datum (aus radix.synastrie->rFix - das ist das Transit-Horoskop)
   QString transitDatumStr;
@@ -128,41 +234,42 @@ QString AstroTextAnalyzer::analyzeTransit(const Radix &radix) const {
     const Radix& transitRadix = *radix.synastrie;
     int tStunde = static_cast<int>(transitRadix.rFix.zeit);
     int tMinute = static_cast<int>((transitRadix.rFix.zeit - tStunde) * 60);
-    QString dateTemplate = astroTextStore().text(lang, "analysis.transit.date_line",
-                                                "Transit-Datum: %1.%2.%3 um %4:%5 Uhr");
-    transitDatumStr = dateTemplate
-                           .arg(transitRadix.rFix.tag, 2, 10, QChar('0'))
-                           .arg(transitRadix.rFix.monat, 2, 10, QChar('0'))
-                           .arg(transitRadix.rFix.jahr)
-                           .arg(tStunde, 2, 10, QChar('0'))
-                           .arg(tMinute, 2, 10, QChar('0'));
-  }
-
-  QString title = astroTextStore().text(lang, "analysis.transit.title",
-                                       "Horoskop-Analyse: Transit");
-  html += QString("<h1>%1</h1>").arg(title);
+    auto zweistellig = [](int wert) { return QString("%1").arg(wert, 2, 10, QChar('0')); };
+    transitDatumStr = astroTextStore().vorlage(lang, "analysis.transit.date_line",
+                                               "Transit-Datum: %1.%2.%3 um %4:%5 Uhr")
+                          .render({ zweistellig(transitRadix.rFix.tag),
+                                    zweistellig(transitRadix.rFix.monat),
+                                    QString::number(transitRadix.rFix.jahr),
+                                    zweistellig(tStunde),
+                                    zweistellig(tMinute) });
+  }
+
+  emitText(sink, ReportTyp::Titel,
+           astroTextStore().text(lang, "analysis.transit.title", "Horoskop-Analyse: Transit"));
   
   // Radix-Person mit Geburtsdatum
-  html += QString("<p><i>%1: %2, geboren am %3</i></p>")
-              .arg(astroTextStore().text(lang, "analysis.transit.for_person", "Für"))
-              .arg(name)
-              .arg(natalDatum);
+  emitText(sink, ReportTyp::Hinweis,
+           QString("%1: %2, geboren am %3")
+               .arg(astroTextStore().text(lang, "analysis.transit.for_person", "Für"))
+               .arg(name)
+               .arg(natalDatum));
   
   // Transit-Datum
   if (!transitDatumStr.isEmpty()) {
-    html += QString("<h3>%1</h3>").arg(transitDatumStr);
+    emitText(sink, ReportTyp::Zwischentitel, transitDatumStr);
   }
   
-  html += astroTextStore().text(lang, "analysis.transit.intro",
-                               "<p>Diese Analyse beschreibt die aktuellen planetaren Einflüsse auf Ihr Geburtshoroskop.</p>");
-  html += "<hr>";
+  emitText(sink, ReportTyp::Text,
+           astroTextStore().text(lang, "analysis.transit.intro",
+                                 "<p>Diese Analyse beschreibt die aktuellen planetaren Einflüsse auf Ihr Geburtshoroskop.</p>"));
+  emitText(sink, ReportTyp::Trenner, QString());
 
   // Transit Texte
-  html += QString("<h2>%1</h2>")
-              .arg(astroTextStore().text(lang, "analysis.transit.section_influences",
-                                        "Aktuelle Einflüsse"));
-  html += astroTextStore().text(lang, "analysis.transit.definition",
-                               "<p>Transite zeigen zeitweilige Einflüsse der aktuellen Planetenstände auf Ihr Geburtshoroskop.</p>");
+  emitText(sink, ReportTyp::Abschnitt,
+           astroTextStore().text(lang, "analysis.transit.section_influences", "Aktuelle Einflüsse"));
+  emitText(sink, ReportTyp::Text,
+           astroTextStore().text(lang, "analysis.transit.definition",
+                                 "<p>Transite zeigen zeitweilige Einflüsse der aktuellen Planetenstände auf Ihr Geburtshoroskop.</p>"));
 
   // Aspekte zwischen Transit-Planeten (radix) und Radix-Planeten (radix.synastrie)
   int aspectCount = 0;
@@ -184,16 +291,9 @@ QString AstroTextAnalyzer::analyzeTransit(const Radix &radix) const {
             int8_t sign1 = (tp < radix.stzPlanet.size()) ? radix.stzPlanet[tp] : -1;
             int8_t sign2 = (rp < natalRadix.stzPlanet.size()) ? natalRadix.stzPlanet[rp] : -1;
 
-            html += QString("<h3><span class='planet-symbol'>%1</span> %2 (T) "
-                            "<span class='aspect-symbol'>%3</span> <span "
-                            "class='planet-symbol'>%4</span> %5 (R)</h3>")
-                        .arg(PLANET_SYMBOLS[tp])
-                        .arg(getPlanetName(tp))
-                        .arg(getAspectName(aspekte[a]))
-                        .arg(PLANET_SYMBOLS[rp])
-                        .arg(getPlanetName(rp));
-
-            html += getContextAspectText(tp, sign1, rp, sign2, aspekte[a]);
+            emitAspekt(sink, tp, getPlanetName(tp), 'T', aspekte[a], getAspectName(aspekte[a]),
+                       rp, getPlanetName(rp), 'R');
+            emitText(sink, ReportTyp::Text, getContextAspectText(tp, sign1, rp, sign2, aspekte[a]));
             aspectCount++;
             break;  // Nur engsten Aspekt
           }
@@ -203,124 +303,55 @@ QString AstroTextAnalyzer::analyzeTransit(const Radix &radix) const {
   }
 
   if (aspectCount == 0) {
-    html += astroTextStore().text(lang, "analysis.transit.no_aspects",
-                                 "<p><i>Keine signifikanten Transite für diesen Tag.</i></p>");
+    emitText(sink, ReportTyp::Text,
+             astroTextStore().text(lang, "analysis.transit.no_aspects",
+                                   "<p><i>Keine signifikanten Transite für diesen Tag.</i></p>"));
   }
-
-  html += "</body></html>";
-  return html;
 }
 
-QString AstroTextAnalyzer::analyzeSynastry(const Radix &radix) const {
-  QString html;
+void AstroTextAnalyzer::buildSynastryReport(const Radix &radix, const QString &lang,
+                                            ReportSink &sink) const {
+  emitText(sink, ReportTyp::Titel,
+           astroTextStore().text(lang, "analysis.synastry.title",
+                                 "Horoskop-Analyse: Partner-Vergleich"));
+  emitText(sink, ReportTyp::Trenner, QString());
 
-  astroTextStore().ensureLoaded();
-  const QString lang = analyzerLang();
+  emitText(sink, ReportTyp::Abschnitt,
+           astroTextStore().text(lang, "analysis.synastry.section_relationship",
+                                 "Beziehungs-Aspekte"));
 
-  // Font-Namen vom AstroFontProvider holen
-  QString signFont = astroFont().fontName();  // AstroUniverse für Sternzeichen
-  QString planetFont = astroFont().getPlanetSymbolFont().family();  // DejaVu Sans für Planeten/Asteroiden
-
-  // HTML-Header mit korrekten Font-Zuordnungen
-  html += "<html><head><style>";
-  html += "body { font-family: Arial, sans-serif; font-size: 11pt; }";
-  html += "h1 { color: #2c3e50; font-size: 16pt; margin-top: 20px; }";
-  html += "h2 { color: #34495e; font-size: 14pt; margin-top: 15px; }";
-  html += "h3 { color: #7f8c8d; font-size: 12pt; margin-top: 10px; }";
-  html += "p { margin: 8px 0; line-height: 1.5; }";
-  html += QString(".planet-symbol { font-family: '%1'; font-size: 14pt; color: #e74c3c; }").arg(planetFont);
-  html += QString(".sign-symbol { font-family: '%1'; font-size: 17pt; color: #3498db; }").arg(signFont);
-  html += QString(".aspect-symbol { font-family: '%1'; font-size: 12pt; color: #9b59b6; }").arg(planetFont);
-  html += "</style></head><body>";
-
-  html += QString("<h1>%1</h1>")
-              .arg(astroTextStore().text(lang, "analysis.synastry.title",
-                                        "Horoskop-Analyse: Partner-Vergleich"));
-  html += "<hr>";
-
-  html += QString("<h2>%1</h2>")
-              .arg(astroTextStore().text(lang, "analysis.synastry.section_relationship",
-                                        "Beziehungs-Aspekte"));
-
-  // Aspekte zwischen Person A (radix) und Person B (radix.synastrie) berechnen
+  // Aspekte zwischen Person A (radix) und Person B (radix.synastrie) - aus
+  // der Synastrie-Berechnung der Pipeline, sonst einmal neu
   int aspectCount = 0;
-  static const int aspekte[] = { KONJUNKTION, HALBSEX, SEXTIL, QUADRATUR, TRIGON, QUINCUNX, OPOSITION };
 
   if (radix.synastrie) {
+    static const AuInit standard;
     const Radix& partnerRadix = *radix.synastrie;
-    
-    for (int pa = 0; pa < radix.anzahlPlanet && pa < MAX_PLANET; pa++) {
-      for (int pb = 0; pb < partnerRadix.anzahlPlanet && pb < MAX_PLANET; pb++) {
-        // Aspekt zwischen Planet pa (Person A) und Planet pb (Person B) berechnen
-        double posA = radix.planet[pa];
-        double posB = partnerRadix.planet[pb];
-        
-        for (int a = 0; a < ASPEKTE; ++a) {
-          double exakterWinkel;
-          if (checkAspektWithOrben(posA, posB, pa, pb, aspekte[a], TYP_SYNASTRIE, exakterWinkel)) {
-            int8_t sign1 = (pa < radix.stzPlanet.size()) ? radix.stzPlanet[pa] : -1;
-            int8_t sign2 = (pb < partnerRadix.stzPlanet.size()) ? partnerRadix.stzPlanet[pb] : -1;
-
-            html += QString("<h3><span class='planet-symbol'>%1</span> %2 (A) "
-                            "<span class='aspect-symbol'>%3</span> <span "
-                            "class='planet-symbol'>%4</span> %5 (B)</h3>")
-                        .arg(PLANET_SYMBOLS[pa])
-                        .arg(getPlanetName(pa))
-                        .arg(getAspectName(aspekte[a]))
-                        .arg(PLANET_SYMBOLS[pb])
-                        .arg(getPlanetName(pb));
-
-            html += getContextAspectText(pa, sign1, pb, sign2, aspekte[a]);
-            aspectCount++;
-            break;  // Nur engsten Aspekt
-          }
-        }
-      }
+    const auto kreuz = SynastrieCalc::ergebnis(radix, partnerRadix,
+                                               m_auinit ? *m_auinit : standard, TYP_SYNASTRIE);
+
+    for (const SynastrieAspekt& s : kreuz->aspekte) {
+      const int pa = s.planetA;
+      const int pb = s.planetB;
+      int8_t sign1 = (pa < radix.stzPlanet.size()) ? radix.stzPlanet[pa] : -1;
+      int8_t sign2 = (pb < partnerRadix.stzPlanet.size()) ? partnerRadix.stzPlanet[pb] : -1;
+
+      emitAspekt(sink, pa, getPlanetName(pa), 'A', s.aspekt, getAspectName(s.aspekt),
+                 pb, getPlanetName(pb), 'B');
+      emitText(sink, ReportTyp::Text, getContextAspectText(pa, sign1, pb, sign2, s.aspekt));
+      aspectCount++;
     }
   }
 
   if (aspectCount == 0) {
-    html += astroTextStore().text(lang, "analysis.synastry.no_aspects",
-                                 "<p><i>Keine starken Verbindungsaspekte gefunden.</i></p>");
+    emitText(sink, ReportTyp::Text,
+             astroTextStore().text(lang, "analysis.synastry.no_aspects",
+                                   "<p><i>Keine starken Verbindungsaspekte gefunden.</i></p>"));
   }
-
-  html += "</body></html>";
-  return html;
 }
 
-//==============================================================================
-// Hauptanalyse-Funktion
-//==============================================================================
-
-QString AstroTextAnalyzer::analyzeRadix(const Radix &radix) const {
-  astroTextStore().ensureLoaded();
-  const QString lang = analyzerLang();
-
-  // Dispatch basierend auf Horoskop-Typ
-  if (radix.horoTyp == TYP_TRANSIT) {
-    return analyzeTransit(radix);
-  } else if (radix.horoTyp == TYP_SYNASTRIE) {
-    return analyzeSynastry(radix);
-  }
-
-  QString html;
-
-  // Font-Namen vom AstroFontProvider holen
-  QString signFont = astroFont().fontName();  // AstroUniverse für Sternzeichen
-  QString planetFont = astroFont().getPlanetSymbolFont().family();  // DejaVu Sans für Planeten/Asteroiden
-
-  // Header mit korrekten Font-Zuordnungen
-  html += "<html><head><style>";
-  html += "body { font-family: Arial, sans-serif; font-size: 11pt; }";
-  html += "h1 { color: #2c3e50; font-size: 16pt; margin-top: 20px; }";
-  html += "h2 { color: #34495e; font-size: 14pt; margin-top: 15px; }";
-  html += "h3 { color: #7f8c8d; font-size: 12pt; margin-top: 10px; }";
-  html += "p { margin: 8px 0; line-height: 1.5; }";
-  html += QString(".planet-symbol { font-family: '%1'; font-size: 14pt; color: #e74c3c; }").arg(planetFont);
-  html += QString(".sign-symbol { font-family: '%1'; font-size: 17pt; color: #3498db; }").arg(signFont);
-  html += QString(".aspect-symbol { font-family: '%1'; font-size: 12pt; color: #9b59b6; }").arg(planetFont);
-  html += "</style></head><body>";
-
+void AstroTextAnalyzer::buildRadixReport(const Radix &radix, const QString &lang,
+                                         ReportSink &sink) const {
   // Titel
   QString name = radix.rFix.vorname;
   if (!radix.rFix.name.isEmpty()) {
@@ -331,8 +362,9 @@ QString AstroTextAnalyzer::analyzeRadix(const Radix &radix) const {
   if (name.isEmpty())
     name = astroTextStore().text(lang, "analysis.radix.default_name", "Radix");
 
-  QString titleTemplate = astroTextStore().text(lang, "analysis.radix.title", "Horoskop-Analyse: %1");
-  html += QString("<h1>%1</h1>").arg(titleTemplate.arg(name));
+  emitText(sink, ReportTyp::Titel,
+           astroTextStore().vorlage(lang, "analysis.radix.title", "Horoskop-Analyse: %1")
+               .render({ name }));
 
   // Geburtsdatum und -zeit aus rFix formatieren
   int stunde = static_cast<int>(radix.rFix.zeit);
@@ -345,48 +377,44 @@ QString AstroTextAnalyzer::analyzeRadix(const Radix &radix) const {
                         .arg(stunde, 2, 10, QChar('0'))
                         .arg(minute, 2, 10, QChar('0'));
   
-  QString bornTemplate = astroTextStore().text(lang, "analysis.radix.born_line",
-                                              "<p><i>Geboren am %1 um %2 Uhr in %3</i></p>");
-  html += bornTemplate.arg(datumStr).arg(zeitStr).arg(radix.rFix.ort);
+  emitText(sink, ReportTyp::Text,
+           astroTextStore().vorlage(lang, "analysis.radix.born_line",
+                                    "<p><i>Geboren am %1 um %2 Uhr in %3</i></p>")
+               .render({ datumStr, zeitStr, radix.rFix.ort }));
 
-  html += "<hr>";
+  emitText(sink, ReportTyp::Trenner, QString());
 
   // 1. Sonnenzeichen (Hauptthema)
   if (radix.stzPlanet.size() > P_SONNE) {
     int8_t sunSign = radix.stzPlanet[P_SONNE];
     QString sunLabel = astroTextStore().text(lang, "analysis.label.sun_sign", "Sonnenzeichen");
-    html += "<h2>" + QString(PLANET_SYMBOLS[P_SONNE]) + " " + sunLabel + ": " + getSignName(sunSign) + "</h2>";
-    html += QString("<p class='sign-symbol'>%1</p>")
-                .arg(astroFont().sternzeichenSymbol(sunSign));
-    html += analyzeSunSign(sunSign);
+    emitStellung(sink, P_SONNE, QString(), sunLabel, sunSign, getSignName(sunSign));
+    emitText(sink, ReportTyp::Text, analyzeSunSign(sunSign));
   }
 
   // 2. Aszendent
   if (radix.stzHaus.size() > 0) {
     int8_t ascSign = radix.stzHaus[0];
     QString ascLabel = astroTextStore().text(lang, "analysis.label.ascendant", "Aszendent");
-    html += "<h2>ASC " + ascLabel + ": " + getSignName(ascSign) + "</h2>";
-    html += QString("<p class='sign-symbol'>%1</p>")
-                .arg(astroFont().sternzeichenSymbol(ascSign));
-    html += analyzeAscendant(ascSign);
+    emitStellung(sink, -1, QStringLiteral("ASC"), ascLabel, ascSign, getSignName(ascSign));
+    emitText(sink, ReportTyp::Text, analyzeAscendant(ascSign));
   }
 
   // 3. Mondzeichen
   if (radix.stzPlanet.size() > P_MOND) {
     int8_t moonSign = radix.stzPlanet[P_MOND];
     QString moonLabel = astroTextStore().text(lang, "analysis.label.moon_sign", "Mondzeichen");
-    html += "<h2>" + QString(PLANET_SYMBOLS[P_MOND]) + " " + moonLabel + ": " + getSignName(moonSign) + "</h2>";
-    html += QString("<p class='sign-symbol'>%1</p>")
-                .arg(astroFont().sternzeichenSymbol(moonSign));
-    html += analyzeMoonSign(moonSign);
+    emitStellung(sink, P_MOND, QString(), moonLabel, moonSign, getSignName(moonSign));
+    emitText(sink, ReportTyp::Text, analyzeMoonSign(moonSign));
   }
 
-  // 4. Aspekte
   // 4. Aspekte
   QString aspectsLabel = astroTextStore().text(lang, "analysis.label.important_aspects", "Wichtige Aspekte");
-  html += "<h2>" + QString(ASPEKT_SYMBOLS[SEXTIL]) + " " + aspectsLabel + "</h2>";
-  html += astroTextStore().text(lang, "analysis.radix.aspects_intro",
-                               "<p><i>Aspekte zeigen die Beziehungen zwischen den Planeten.</i></p>");
+  // ASPEKT_SYMBOLS ist nach Aspekt/30 indiziert
+  emitText(sink, ReportTyp::Abschnitt, QString(ASPEKT_SYMBOLS[SEXTIL / 30]) + " " + aspectsLabel);
+  emitText(sink, ReportTyp::Text,
+           astroTextStore().text(lang, "analysis.radix.aspects_intro",
+                                 "<p><i>Aspekte zeigen die Beziehungen zwischen den Planeten.</i></p>"));
 
   // Aspekte durchgehen
   int aspectCount = 0;
@@ -397,14 +425,8 @@ QString AstroTextAnalyzer::analyzeRadix(const Radix &radix) const {
       if (aspIndex < radix.aspPlanet.size()) {
         int16_t aspect = radix.aspPlanet[aspIndex];
         if (aspect != KEIN_ASP) {
-          html += QString("<h3><span class='planet-symbol'>%1</span> %2 <span "
-                          "class='aspect-symbol'>%3</span> <span "
-                          "class='planet-symbol'>%4</span> %5</h3>")
-                      .arg(PLANET_SYMBOLS[i])
-                      .arg(getPlanetName(i))
-                      .arg(getAspectName(aspect))
-                      .arg(PLANET_SYMBOLS[j])
-                      .arg(getPlanetName(j));
+          emitAspekt(sink, i, getPlanetName(i), 0, aspect, getAspectName(aspect),
+                     j, getPlanetName(j), 0);
           // Kontext berücksichtigen (Zeichen)
           int8_t sign1 = -1;
           int8_t sign2 = -1;
@@ -413,7 +435,7 @@ QString AstroTextAnalyzer::analyzeRadix(const Radix &radix) const {
           if (j < radix.stzPlanet.size())
             sign2 = radix.stzPlanet[j];
 
-          html += getContextAspectText(i, sign1, j, sign2, aspect);
+          emitText(sink, ReportTyp::Text, getContextAspectText(i, sign1, j, sign2, aspect));
           aspectCount++;
         }
       }
@@ -421,88 +443,54 @@ QString AstroTextAnalyzer::analyzeRadix(const Radix &radix) const {
   }
 
   if (aspectCount == 0) {
-    html += astroTextStore().text(lang, "analysis.radix.no_aspects",
-                                 "<p><i>Keine signifikanten Aspekte gefunden.</i></p>");
+    emitText(sink, ReportTyp::Text,
+             astroTextStore().text(lang, "analysis.radix.no_aspects",
+                                   "<p><i>Keine signifikanten Aspekte gefunden.</i></p>"));
   }
 
-  // 5. ASC-Aspekte (Planeten zum Aszendenten)
-  if (radix.haus.size() > 0 && radix.planet.size() > 0) {
-    double ascPos = radix.haus[0];  // ASC = Hausspitze 1
-    static const int aspekte[] = { KONJUNKTION, HALBSEX, SEXTIL, QUADRATUR, TRIGON, QUINCUNX, OPOSITION };
-    static const double aspWinkel[] = { 0.0, 30.0, 60.0, 90.0, 120.0, 150.0, 180.0 };
-    
-    int ascAspectCount = 0;
-    QString ascAspectHtml;
-    
-    for (int p = 0; p < radix.anzahlPlanet && p < MAX_PLANET; p++) {
-      double planetPos = radix.planet[p];
-      double diff = std::abs(planetPos - ascPos);
-      if (diff > 180.0) diff = 360.0 - diff;
-      
-      // Aspekt prüfen mit Standard-Orb 8°
-      for (int a = 0; a < ASPEKTE; ++a) {
-        double orb = 8.0;
-        if (std::abs(diff - aspWinkel[a]) <= orb) {
-          int16_t asp = aspekte[a];
-          ascAspectHtml += QString("<h3><span class='planet-symbol'>%1</span> %2 <span "
-                          "class='aspect-symbol'>%3</span> ASC</h3>")
-                      .arg(PLANET_SYMBOLS[p])
-                      .arg(getPlanetName(p))
-                      .arg(getAspectName(asp));
-          ascAspectHtml += "<p>" + getAscAspectText(p, asp) + "</p>";
-          ascAspectCount++;
-          break;  // Nur engsten Aspekt
-        }
-      }
-    }
-    
-    if (ascAspectCount > 0) {
-      html += QString("<h2>%1</h2>")
-                  .arg(astroTextStore().text(lang, "analysis.label.asc_aspects", "Aspekte zum Aszendenten"));
-      html += ascAspectHtml;
+  // 5./6. Aspekte zu ASC (Hausspitze 1) und MC (Hausspitze 10)
+  static const int aspekte[] = { KONJUNKTION, HALBSEX, SEXTIL, QUADRATUR, TRIGON, QUINCUNX, OPOSITION };
+  static const double aspWinkel[] = { 0.0, 30.0, 60.0, 90.0, 120.0, 150.0, 180.0 };
+
+  for (int achse = 0; achse < 2; ++achse) {
+    const bool mc = (achse == 1);
+    const int hausIndex = mc ? 9 : 0;
+    if (radix.haus.size() <= hausIndex || radix.planet.size() == 0) {
+      continue;
     }
-  }
+    const double achsePos = radix.haus[hausIndex];
 
-  // 6. MC-Aspekte (Planeten zum Medium Coeli)
-  if (radix.haus.size() > 9 && radix.planet.size() > 0) {
-    double mcPos = radix.haus[9];  // MC = Hausspitze 10
-    static const int aspekte[] = { KONJUNKTION, HALBSEX, SEXTIL, QUADRATUR, TRIGON, QUINCUNX, OPOSITION };
-    static const double aspWinkel[] = { 0.0, 30.0, 60.0, 90.0, 120.0, 150.0, 180.0 };
-    
-    int mcAspectCount = 0;
-    QString mcAspectHtml;
-    
+    // Überschrift nur, wenn es Aspekte gibt: erst sammeln (Planet, Aspekt)
+    QVector<QPair<int, int16_t>> treffer;
     for (int p = 0; p < radix.anzahlPlanet && p < MAX_PLANET; p++) {
       double planetPos = radix.planet[p];
-      double diff = std::abs(planetPos - mcPos);
+      double diff = std::abs(planetPos - achsePos);
       if (diff > 180.0) diff = 360.0 - diff;
       
       // Aspekt prüfen mit Standard-Orb 8°
       for (int a = 0; a < ASPEKTE; ++a) {
         double orb = 8.0;
         if (std::abs(diff - aspWinkel[a]) <= orb) {
-          int16_t asp = aspekte[a];
-          mcAspectHtml += QString("<h3><span class='planet-symbol'>%1</span> %2 <span "
-                          "class='aspect-symbol'>%3</span> MC</h3>")
-                      .arg(PLANET_SYMBOLS[p])
-                      .arg(getPlanetName(p))
-                      .arg(getAspectName(asp));
-          mcAspectHtml += "<p>" + getMcAspectText(p, asp) + "</p>";
-          mcAspectCount++;
+          treffer.append({ p, static_cast<int16_t>(aspekte[a]) });
           break;  // Nur engsten Aspekt
         }
       }
     }
-    
-    if (mcAspectCount > 0) {
-      html += QString("<h2>%1</h2>")
-                  .arg(astroTextStore().text(lang, "analysis.label.mc_aspects", "Aspekte zum MC"));
-      html += mcAspectHtml;
+    if (treffer.isEmpty()) {
+      continue;
     }
-  }
 
-  html += "</body></html>";
-  return html;
+    emitText(sink, ReportTyp::Abschnitt,
+             mc ? astroTextStore().text(lang, "analysis.label.mc_aspects", "Aspekte zum MC")
+                : astroTextStore().text(lang, "analysis.label.asc_aspects", "Aspekte zum Aszendenten"));
+    const QString achseName = mc ? QStringLiteral("MC") : QStringLiteral("ASC");
+    for (const auto& t : treffer) {
+      emitAspekt(sink, t.first, getPlanetName(t.first), 0, t.second, getAspectName(t.second),
+                 -1, achseName, 0);
+      emitText(sink, ReportTyp::Absatz,
+               mc ? getMcAspectText(t.first, t.second) : getAscAspectText(t.first, t.second));
+    }
+  }
 }
 
 //==============================================================================
@@ -625,8 +613,9 @@ QString AstroTextAnalyzer::getGenericAspectText(int planet1, int planet2,
     return text;
   }
 
-  const QString templ = genericAspectTemplate(aspect);
-  text += QString(templ).arg(p1, p2);
+  const QString key = QString("aspect.generic.%1").arg(static_cast<int>(aspect));
+  astroTextStore().vorlage(analyzerLang(), key, defaultGenericAspectTemplate(aspect))
+      .appendTo(text, { p1, p2 });
 
   text += "</p>";
   return text;
@@ -2850,10 +2839,9 @@ QString AstroTextAnalyzer::getContextAspectText(int planet1, int8_t sign1,
 
   // Planetenposition hinzufügen
   if (!signName1.isEmpty() && !signName2.isEmpty()) {
-    text += QString("<b>%1 in %2 %3 %4 in %5</b><br>")
-                .arg(getPlanetName(planet1), signName1,
-                     getAspectName(aspect),
-                     getPlanetName(planet2), signName2);
+    static const TextVorlage stellung(QStringLiteral("<b>%1 in %2 %3 %4 in %5</b><br>"));
+    stellung.appendTo(text, { getPlanetName(planet1), signName1, getAspectName(aspect),
+                              getPlanetName(planet2), signName2 });
   }
 
   // Aspekt-Text einfügen
@@ -2868,71 +2856,73 @@ QString AstroTextAnalyzer::getContextAspectText(int planet1, int8_t sign1,
       QString elName = elementName(el1);
       switch (el1) {
       case 0: // Feuer
-        text += astroTextStore().text(lang, "context.same.fire",
+        astroTextStore().vorlage(lang, "context.same.fire",
                         "Beide Planeten stehen in %1-Zeichen, was diesem Aspekt besondere Dynamik, Energie und Leidenschaft verleiht. Hier ist viel Initiative und Unternehmungslust vorhanden, aber auch die Gefahr von Impulsivität und Ungeduld.")
-                    .arg(elName);
+            .appendTo(text, { elName });
         break;
       case 1: // Erde
-        text += astroTextStore().text(lang, "context.same.earth",
+        astroTextStore().vorlage(lang, "context.same.earth",
                         "Beide Planeten stehen in %1-Zeichen, was diesem Aspekt Stabilität, Ausdauer und Pragmatismus verleiht. Sie gehen methodisch vor und bauen auf solide Fundamente. Materielle Sicherheit ist wichtig.")
-                    .arg(elName);
+            .appendTo(text, { elName });
         break;
       case 2: // Luft
-        text += astroTextStore().text(lang, "context.same.air",
+        astroTextStore().vorlage(lang, "context.same.air",
                         "Beide Planeten stehen in %1-Zeichen, was diesem Aspekt geistige Beweglichkeit und kommunikative Fähigkeiten verleiht. Ideen und sozialer Austausch stehen im Vordergrund. Objektivität ist eine Stärke.")
-                    .arg(elName);
+            .appendTo(text, { elName });
         break;
       case 3: // Wasser
-        text += astroTextStore().text(lang, "context.same.water",
+        astroTextStore().vorlage(lang, "context.same.water",
                         "Beide Planeten stehen in %1-Zeichen, was diesem Aspekt emotionale Tiefe und intuitive Qualitäten verleiht. Gefühle und Empfindungen sind hier sehr stark. Einfühlungsvermögen und Sensibilität prägen diesen Bereich.")
-                    .arg(elName);
+            .appendTo(text, { elName });
         break;
       }
     } else {
       // Unterschiedliche Elemente - Kombination beschreiben
       QString elName1 = elementName(el1);
       QString elName2 = elementName(el2);
+      const QString name1 = getPlanetName(planet1);
+      const QString name2 = getPlanetName(planet2);
 
       // Harmonische Element-Kombinationen
       if ((el1 == 0 && el2 == 2) || (el1 == 2 && el2 == 0)) {
         // Feuer-Luft
-        text += astroTextStore().text(lang, "context.combo.fire_air",
+        astroTextStore().vorlage(lang, "context.combo.fire_air",
                         "%1 (%2) und %3 (%4) verbinden sich hier zu einer energiegeladenen, enthusiastischen Kombination. Ideen werden in Aktion umgesetzt, Inspiration führt zu Taten.")
-                    .arg(getPlanetName(planet1), elName1, getPlanetName(planet2), elName2);
+            .appendTo(text, { name1, elName1, name2, elName2 });
       } else if ((el1 == 1 && el2 == 3) || (el1 == 3 && el2 == 1)) {
         // Erde-Wasser
-        text += astroTextStore().text(lang, "context.combo.earth_water",
+        astroTextStore().vorlage(lang, "context.combo.earth_water",
                         "%1 (%2) und %3 (%4) verbinden sich zu einer fruchtbaren, nährenden Kombination. Praktisches und Emotionales arbeiten zusammen. Gefühle finden konkreten Ausdruck.")
-                    .arg(getPlanetName(planet1), elName1, getPlanetName(planet2), elName2);
+            .appendTo(text, { name1, elName1, name2, elName2 });
       } else if ((el1 == 0 && el2 == 1) || (el1 == 1 && el2 == 0)) {
         // Feuer-Erde
-        text += astroTextStore().text(lang, "context.combo.fire_earth",
+        astroTextStore().vorlage(lang, "context.combo.fire_earth",
                         "%1 (%2) und %3 (%4) verbinden Impuls mit Substanz. Der Feuerdrang will schnelle Ergebnisse, die Erde fordert Geduld. Diese Spannung kann zu konkreten Errungenschaften führen.")
-                    .arg(getPlanetName(planet1), elName1, getPlanetName(planet2), elName2);
+            .appendTo(text, { name1, elName1, name2, elName2 });
       } else if ((el1 == 0 && el2 == 3) || (el1 == 3 && el2 == 0)) {
         // Feuer-Wasser
-        text += astroTextStore().text(lang, "context.combo.fire_water",
+        astroTextStore().vorlage(lang, "context.combo.fire_water",
                         "%1 (%2) und %3 (%4) erzeugen Dampf - eine kraftvolle, aber volatile Mischung. Leidenschaft trifft auf Gefühl, was zu intensiven, aber auch stürmischen Energien führen kann.")
-                    .arg(getPlanetName(planet1), elName1, getPlanetName(planet2), elName2);
+            .appendTo(text, { name1, elName1, name2, elName2 });
       } else if ((el1 == 1 && el2 == 2) || (el1 == 2 && el2 == 1)) {
         // Erde-Luft
-        text += astroTextStore().text(lang, "context.combo.earth_air",
+        astroTextStore().vorlage(lang, "context.combo.earth_air",
                         "%1 (%2) und %3 (%4) verbinden Theorie mit Praxis. Ideen brauchen praktische Umsetzung, und die Erde erdet das manchmal zu abstrakte Denken der Luft.")
-                    .arg(getPlanetName(planet1), elName1, getPlanetName(planet2), elName2);
+            .appendTo(text, { name1, elName1, name2, elName2 });
       } else if ((el1 == 2 && el2 == 3) || (el1 == 3 && el2 == 2)) {
         // Luft-Wasser
-        text += astroTextStore().text(lang, "context.combo.air_water",
+        astroTextStore().vorlage(lang, "context.combo.air_water",
                         "%1 (%2) und %3 (%4) verbinden Verstand mit Gefühl. Das kann zu künstlerischer Sensibilität führen, aber auch zu Konflikten zwischen Kopf und Herz.")
-                    .arg(getPlanetName(planet1), elName1, getPlanetName(planet2), elName2);
+            .appendTo(text, { name1, elName1, name2, elName2 });
       }
     }
 
     // Qualitäts-Kontext hinzufügen
     if (qual1 >= 0 && qual2 >= 0 && qual1 == qual2) {
       QString qualName = qualityName(qual1);
-      text += astroTextStore().text(lang, "context.quality.same",
-                                   " Beide Zeichen sind %1, was die Intensität dieses Aspekts verstärkt.")
-                  .arg(qualName);
+      astroTextStore().vorlage(lang, "context.quality.same",
+                               " Beide Zeichen sind %1, was die Intensität dieses Aspekts verstärkt.")
+          .appendTo(text, { qualName });
     }
 
     text += "</i>";
@@ -10,8 +10,11 @@
  */
 
 #include "data_types.h"
+#include "astro_report.h"
 #include <QMap>
 #include <QString>
+#include <QVector>
+#include <functional>
 
 namespace astro {
 
@@ -44,6 +47,25 @@ public:
    */
   QString analyzeSynastry(const Radix &radix) const;
 
+  /**
+   * @brief Erzeugt die Analyse als Fragmente (Typ nach radix.horoTyp)
+   *
+   * Ruft beginReport()/endReport() des Sinks auf. analyzeRadix() ist
+   * buildReport() mit HtmlReportSink.
+   */
+  void buildReport(const Radix &radix, ReportSink &sink) const;
+
+  /**
+   * @brief Erzeugt die Analysen vieler Horoskope nacheinander
+   *
+   * Ein AstroReport wird für alle Horoskope wiederverwendet; fertig()
+   * erhält ihn je Horoskop (Index, Report) und darf ihn nur während des
+   * Aufrufs lesen.
+   * @return Anzahl erzeugter Analysen
+   */
+  int buildReports(const QVector<Radix> &charts,
+                   const std::function<void(int, const AstroReport &)> &fertig) const;
+
   /**
    * @brief Analysiert Sonne im Sternzeichen
    */
@@ -128,6 +150,11 @@ private:
                                int8_t sign2, int16_t aspect) const;
 
   QString defaultGenericAspectTemplate(int16_t aspect) const;
+
+  // Fragmente je Horoskop-Typ (ohne begin/end)
+  void buildRadixReport(const Radix &radix, const QString &lang, ReportSink &sink) const;
+  void buildTransitReport(const Radix &radix, const QString &lang, ReportSink &sink) const;
+  void buildSynastryReport(const Radix &radix, const QString &lang, ReportSink &sink) const;
   
   // Orben-Einstellungen (optional)
   const AuInit* m_auinit = nullptr;
@@ -7,11 +7,99 @@
 #include <QLocale>
 #include <QTextStream>
 #include <QStringConverter>
+#include <algorithm>
 
 namespace astro {
 
+//==============================================================================
+// TextVorlage
+//==============================================================================
+
+TextVorlage::TextVorlage(const QString& quelle)
+    : m_quelle(quelle) {
+    struct Fund {
+        int beginn;
+        int laenge;
+        int nummer;
+    };
+    QVector<Fund> funde;
+    const int n = m_quelle.size();
+    for (int i = 0; i + 1 < n; ++i) {
+        if (m_quelle[i] != '%') {
+            continue;
+        }
+        const int d1 = m_quelle[i + 1].digitValue();
+        if (d1 < 1) {
+            continue;
+        }
+        int laenge = 2;
+        int nummer = d1;
+        if (i + 2 < n) {
+            const int d2 = m_quelle[i + 2].digitValue();
+            if (d2 >= 0) {
+                nummer = nummer * 10 + d2;
+                ++laenge;
+            }
+        }
+        funde.append({ i, laenge, nummer });
+        i += laenge - 1;
+    }
+
+    // Nummern nach Rang auf Argument-Indizes abbilden (wie QString::arg)
+    QVector<int> nummern;
+    for (const Fund& f : funde) {
+        if (!nummern.contains(f.nummer)) {
+            nummern.append(f.nummer);
+        }
+    }
+    std::sort(nummern.begin(), nummern.end());
+    m_anzahl = nummern.size();
+
+    m_tokens.reserve(2 * funde.size() + 1);
+    int pos = 0;
+    for (const Fund& f : funde) {
+        if (f.beginn > pos) {
+            m_tokens.append({ pos, f.beginn - pos, -1 });
+        }
+        const int platz = static_cast<int>(std::lower_bound(nummern.cbegin(), nummern.cend(), f.nummer)
+                                           - nummern.cbegin());
+        m_tokens.append({ f.beginn, f.laenge, static_cast<int8_t>(platz) });
+        pos = f.beginn + f.laenge;
+    }
+    if (pos < n) {
+        m_tokens.append({ pos, n - pos, -1 });
+    }
+}
+
+void TextVorlage::appendTo(QString& out, std::initializer_list<QStringView> args) const {
+    const QStringView quelle(m_quelle);
+    const int anzahlArgs = static_cast<int>(args.size());
+    for (const Token& t : m_tokens) {
+        if (t.platz >= 0 && t.platz < anzahlArgs) {
+            out += args.begin()[t.platz];
+        } else {
+            out += quelle.sliced(t.beginn, t.laenge);
+        }
+    }
+}
+
+QString TextVorlage::render(std::initializer_list<QStringView> args) const {
+    qsizetype laenge = m_quelle.size();
+    for (QStringView a : args) {
+        laenge += a.size();
+    }
+    QString out;
+    out.reserve(laenge);
+    appendTo(out, args);
+    return out;
+}
+
+//==============================================================================
+// AstroTextStore
+//==============================================================================
+
 AstroTextStore::AstroTextStore()
-    : m_loaded(false) {
+    : m_loaded(0) {
 }
 
 void AstroTextStore::setFilePath(const QString& path) {
@@ -27,10 +115,17 @@ QString AstroTextStore::filePath() const {
 }
 
 bool AstroTextStore::ensureLoaded() {
-    if (m_loaded) {
+    if (m_loaded.loadAcquire()) {
         return true;
     }
-    return load();
+
+    // Langsamer Weg unter der Schreib-Sperre - gleichzeitige Aufrufer aus
+    // Worker-Threads laden die Datei nur einmal
+    QWriteLocker locker(&m_lock);
+    if (m_loaded.loadRelaxed()) {
+        return true;
+    }
+    return loadLocked();
 }
 
 QString AstroTextStore::dirtyId(const QString& lang, const QString& key) const {
@@ -91,19 +186,27 @@ QString AstroTextStore::unescapeValue(const QString& value) {
 }
 
 bool AstroTextStore::load() {
+    QWriteLocker locker(&m_lock);
+    return loadLocked();
+}
+
+bool AstroTextStore::loadLocked() {
+    m_revision.ref();
+
     m_overrides.clear();
     m_snapshot.clear();
     m_dirty.clear();
+    vorlagenVerwerfen(QString());
 
     const QString path = filePath();
     QFile f(path);
     if (!f.exists()) {
-        m_loaded = true;
+        m_loaded.storeRelease(1);
         return true;
     }
 
     if (!f.open(QIODevice::ReadOnly | QIODevice::Text)) {
-        m_loaded = true;
+        m_loaded.storeRelease(1);
         return false;
     }
 
@@ -143,11 +246,13 @@ bool AstroTextStore::load() {
         m_snapshot[currentLang][key] = value;
     }
 
-    m_loaded = true;
+    m_loaded.storeRelease(1);
     return true;
 }
 
 bool AstroTextStore::save() {
+    QWriteLocker locker(&m_lock);
+
     const QString path = filePath();
 
     QDir dir = QFileInfo(path).dir();
@@ -209,24 +314,68 @@ QString AstroTextStore::overrideText(const QString& lang, const QString& key) co
     return itLang->value(key);
 }
 
-QString AstroTextStore::text(const QString& lang, const QString& key, const QString& defaultValue) const {
+const QString* AstroTextStore::findText(const QString& lang, const QString& key) const {
     auto itLang = m_overrides.constFind(lang);
-    if (itLang != m_overrides.constEnd() && itLang->contains(key)) {
-        return itLang->value(key);
+    if (itLang != m_overrides.constEnd()) {
+        auto it = itLang->constFind(key);
+        if (it != itLang->constEnd()) {
+            return &it.value();
+        }
     }
 
     auto itDe = m_overrides.constFind("de");
-    if (itDe != m_overrides.constEnd() && itDe->contains(key)) {
-        return itDe->value(key);
+    if (itDe != m_overrides.constEnd()) {
+        auto it = itDe->constFind(key);
+        if (it != itDe->constEnd()) {
+            return &it.value();
+        }
+    }
+
+    return nullptr;
+}
+
+QString AstroTextStore::text(const QString& lang, const QString& key, const QString& defaultValue) const {
+    QReadLocker locker(&m_lock);
+
+    const QString* ov = findText(lang, key);
+    return ov ? *ov : defaultValue;
+}
+
+TextVorlage AstroTextStore::vorlage(const QString& lang, const QString& key, const QString& defaultValue) const {
+    QReadLocker locker(&m_lock);
+    const QString* ov = findText(lang, key);
+
+    QMutexLocker vorlagenLocker(&m_vorlagenLock);
+    VorlagenEintrag& eintrag = m_vorlagen[key][lang];
+    // Override-Vorlagen gelten bis zur nächsten Änderung; Standard-Texte
+    // kommen vom Aufrufer und werden deshalb verglichen
+    const bool gueltig = ov ? eintrag.ausOverride
+                            : (!eintrag.ausOverride && eintrag.vorlage.quelle() == defaultValue);
+    if (!gueltig) {
+        eintrag.vorlage = TextVorlage(ov ? *ov : defaultValue);
+        eintrag.ausOverride = (ov != nullptr);
     }
+    return eintrag.vorlage;
+}
 
-    return defaultValue;
+void AstroTextStore::vorlagenVerwerfen(const QString& key) {
+    QMutexLocker vorlagenLocker(&m_vorlagenLock);
+    if (key.isNull()) {
+        m_vorlagen.clear();
+    } else {
+        // Alle Sprachen: Fallback auf "de" hängt am selben Schlüssel
+        m_vorlagen.remove(key);
+    }
 }
 
 void AstroTextStore::setOverride(const QString& lang, const QString& key, const QString& value) {
     ensureLoaded();
 
+    QWriteLocker locker(&m_lock);
+    m_revision.ref();
+
     m_overrides[lang][key] = value;
+    vorlagenVerwerfen(key);
 
     QString snap = m_snapshot.value(lang).value(key);
     if (snap != value) {
@@ -239,11 +388,15 @@ void AstroTextStore::setOverride(const QString& lang, const QString& key, const
 void AstroTextStore::revertOverride(const QString& lang, const QString& key) {
     ensureLoaded();
 
+    QWriteLocker locker(&m_lock);
+    m_revision.ref();
+
     if (m_snapshot.value(lang).contains(key)) {
         m_overrides[lang][key] = m_snapshot.value(lang).value(key);
     } else {
         m_overrides[lang].remove(key);
     }
+    vorlagenVerwerfen(key);
 
     m_dirty.remove(dirtyId(lang, key));
 }
@@ -251,8 +404,16 @@ void AstroTextStore::revertOverride(const QString& lang, const QString& key) {
 void AstroTextStore::revertAll() {
     ensureLoaded();
 
+    QWriteLocker locker(&m_lock);
+    m_revision.ref();
+
     m_overrides = m_snapshot;
     m_dirty.clear();
+    vorlagenVerwerfen(QString());
+}
+
+int AstroTextStore::revision() const {
+    return m_revision.loadRelaxed();
 }
 
 bool AstroTextStore::isDirty() const {
@@ -1,11 +1,50 @@
 #pragma once
 
+#include <QAtomicInt>
+#include <QHash>
 #include <QMap>
+#include <QMutex>
+#include <QReadWriteLock>
 #include <QSet>
 #include <QString>
+#include <QStringView>
+#include <QVector>
+#include <initializer_list>
 
 namespace astro {
 
+/**
+ * @brief Vorübersetzter Katalog-Text mit Platzhaltern (%1 .. %99)
+ *
+ * Der Text wird einmal in Literal-Abschnitte und Platzhalter zerlegt;
+ * appendTo() hängt dann nur noch Abschnitte und Argumente an. Zuordnung
+ * wie QString::arg(a1, a2, ...): das erste Argument ersetzt die kleinste
+ * Platzhalter-Nummer, das zweite die nächste usw. Platzhalter ohne
+ * Argument bleiben stehen. Argumente werden nicht erneut ersetzt.
+ */
+class TextVorlage {
+public:
+    TextVorlage() = default;
+    explicit TextVorlage(const QString& quelle);
+
+    const QString& quelle() const { return m_quelle; }
+    int anzahlPlatzhalter() const { return m_anzahl; }
+
+    void appendTo(QString& out, std::initializer_list<QStringView> args) const;
+    QString render(std::initializer_list<QStringView> args) const;
+
+private:
+    struct Token {
+        int    beginn;      // Abschnitt in m_quelle
+        int    laenge;
+        int8_t platz;       // Argument-Index, -1 = Literal
+    };
+
+    QString m_quelle;
+    QVector<Token> m_tokens;
+    int m_anzahl = 0;
+};
+
 class AstroTextStore {
 public:
     AstroTextStore();
@@ -22,6 +61,14 @@ public:
 
     QString text(const QString& lang, const QString& key, const QString& defaultValue) const;
 
+    /**
+     * @brief Wie text(), aber als vorübersetzte Vorlage
+     *
+     * Die Vorlage wird je Schlüssel zwischengespeichert und nur verworfen,
+     * wenn der Text geändert (setOverride/revert/load) wird.
+     */
+    TextVorlage vorlage(const QString& lang, const QString& key, const QString& defaultValue) const;
+
     void setOverride(const QString& lang, const QString& key, const QString& value);
     void revertOverride(const QString& lang, const QString& key);
     void revertAll();
@@ -31,14 +78,33 @@ public:
 
     static QString systemLanguageCode();
 
+    // Wird bei jeder Änderung der Texte erhöht (für Caches der Analyse)
+    int revision() const;
+
 private:
     QString m_filePath;
-    bool m_loaded;
+    QAtomicInt m_loaded;        // 1 nach dem ersten load(), gesetzt unter m_lock
+    QAtomicInt m_revision;
+
+    // Analyse läuft auch in Worker-Threads: Lesen parallel, Ändern exklusiv
+    mutable QReadWriteLock m_lock;
 
     QMap<QString, QMap<QString, QString>> m_overrides;
     QMap<QString, QMap<QString, QString>> m_snapshot;
     QSet<QString> m_dirty;
 
+    // Vorlagen je Schlüssel und Sprache (eigene Sperre: Füllen unter Lese-Sperre)
+    struct VorlagenEintrag {
+        TextVorlage vorlage;
+        bool ausOverride = false;
+    };
+    mutable QMutex m_vorlagenLock;
+    mutable QHash<QString, QHash<QString, VorlagenEintrag>> m_vorlagen;
+
+    const QString* findText(const QString& lang, const QString& key) const;
+    void vorlagenVerwerfen(const QString& key);
+    bool loadLocked();          // erwartet die Schreib-Sperre
+
     static QString escapeValue(const QString& value);
     static QString unescapeValue(const QString& value);
 
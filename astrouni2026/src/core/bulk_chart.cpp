@@ -0,0 +1,223 @@
+/**
+ * @file bulk_chart.cpp
+ * @brief Implementierung der Massen-Berechnung
+ */
+
+#include "bulk_chart.h"
+#include "calculations.h"
+#include "chart_calc.h"
+#include <QElapsedTimer>
+#include <QSaveFile>
+#include <QStringConverter>
+#include <QTextStream>
+#include <QThread>
+#include <QThreadPool>
+#include <QtConcurrent>
+
+namespace astro {
+
+// Spaltennamen der Planeten (Reihenfolge P_SONNE bis P_VESTA)
+static const char* const PLANET_SPALTEN[MAX_PLANET] = {
+    "sonne", "mond", "merkur", "venus", "mars", "jupiter", "saturn",
+    "uranus", "neptun", "pluto", "nknoten", "lilith", "chiron",
+    "ceres", "pallas", "juno", "vesta"
+};
+
+// Spaltennamen der Aspekte (Index = Aspekt-Winkel / 30)
+static const char* const ASPEKT_SPALTEN[ASPEKTE] = {
+    "kon", "hsx", "sex", "qua", "tri", "qui", "opo"
+};
+
+double BulkChartResult::rowsPerSecond() const {
+    if (elapsedMs <= 0) {
+        return 0.0;
+    }
+    return rows.size() * 1000.0 / elapsedMs;
+}
+
+//==============================================================================
+// Berechnung
+//==============================================================================
+
+BulkChartRow BulkChart::calculateRow(const RadixFix& person, const AuInit& auinit,
+                                     int hausSys, const EpheContext& ctx) {
+    BulkChartRow row;
+
+    Radix radix;
+    radix.rFix = person;
+    radix.hausSys = static_cast<int8_t>(hausSys);
+
+    row.result = ChartCalc::calculate(radix, nullptr, TYP_RADIX, ctx);
+    if (row.result != ERR_OK) {
+        return row;
+    }
+    ChartCalc::calcAspects(radix, auinit.orbenPlanet);
+
+    row.jd = radix.jd;
+    row.asc = radix.asc;
+    row.mc = radix.mc;
+    for (int i = 0; i < MAX_PLANET; ++i) {
+        row.planet[i] = radix.planet[i];
+    }
+    for (int h = 0; h < MAX_HAUS; ++h) {
+        row.haus[h] = radix.haus[h];
+    }
+
+    const int n = radix.anzahlPlanet;
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+            const int asp = radix.aspPlanet[i * n + j];
+            if (i == j || asp == KEIN_ASP) {
+                continue;
+            }
+            row.aspekte[asp / 30][i] |= (1u << j);
+        }
+    }
+
+    return row;
+}
+
+BulkChartResult BulkChart::calculate(const QVector<RadixFix>& personen,
+                                     const AuInit& auinit, int hausSys, int threads) {
+    BulkChartResult result;
+    result.rows.resize(personen.size());
+
+    if (threads <= 0) {
+        threads = QThread::idealThreadCount();
+    }
+    if (!EpheContext::isThreadSafe()) {
+        threads = 1;
+    }
+    result.threads = threads;
+
+    QVector<int> indices(personen.size());
+    for (int i = 0; i < indices.size(); ++i) {
+        indices[i] = i;
+    }
+
+    // Zeilen vorab anlegen - jeder Worker schreibt nur seine eigene
+    BulkChartRow* rows = result.rows.data();
+
+    // Eine Konfiguration für den ganzen Lauf; gebunden wird je Worker-Thread
+    const EpheContext ctx = EpheContext::current();
+
+    QElapsedTimer timer;
+    timer.start();
+
+    if (threads == 1) {
+        for (int i : indices) {
+            rows[i] = calculateRow(personen[i], auinit, hausSys, ctx);
+        }
+    } else {
+        QThreadPool pool;
+        pool.setMaxThreadCount(threads);
+        QtConcurrent::blockingMap(&pool, indices, [&](int i) {
+            rows[i] = calculateRow(personen[i], auinit, hausSys, ctx);
+        });
+    }
+
+    result.elapsedMs = timer.elapsed();
+
+    for (int i = 0; i < result.rows.size(); ++i) {
+        rows[i].index = i;
+        if (rows[i].result != ERR_OK) {
+            ++result.fehler;
+        }
+    }
+
+    return result;
+}
+
+//==============================================================================
+// Ausgabe
+//==============================================================================
+
+QStringList BulkChart::columns() {
+    QStringList cols;
+    cols << "index" << "vorname" << "name" << "datum" << "zeit" << "ort"
+         << "status" << "jd" << "asc" << "mc";
+    for (int i = 0; i < MAX_PLANET; ++i) {
+        cols << QString::fromLatin1(PLANET_SPALTEN[i]);
+    }
+    for (int h = 0; h < MAX_HAUS; ++h) {
+        cols << QString("haus%1").arg(h + 1);
+    }
+    for (int a = 0; a < ASPEKTE; ++a) {
+        for (int i = 0; i < MAX_PLANET; ++i) {
+            cols << QString("%1_%2").arg(QString::fromLatin1(ASPEKT_SPALTEN[a]),
+                                         QString::fromLatin1(PLANET_SPALTEN[i]));
+        }
+    }
+    return cols;
+}
+
+static QString feld(QString text) {
+    // Tabulatoren/Zeilenumbrüche würden die Spalten verschieben
+    text.replace('\t', ' ');
+    text.replace('\n', ' ');
+    text.replace('\r', ' ');
+    return text;
+}
+
+int BulkChart::writeTable(const QString& filepath, const QVector<RadixFix>& personen,
+                          const BulkChartResult& result) {
+    QSaveFile file(filepath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        return ERR_FILE;
+    }
+
+    QTextStream out(&file);
+    out.setEncoding(QStringConverter::Utf8);
+
+    out << columns().join('\t') << '\n';
+
+    QStringList zeile;
+    for (const BulkChartRow& row : result.rows) {
+        const RadixFix& p = personen.at(row.index);
+        // Gerundet mit Übertrag (nicht 12:60)
+        int16_t stunde = 0;
+        int16_t minute = 0;
+        Calculations::decimalToTime(p.zeit, stunde, minute);
+
+        zeile.clear();
+        zeile << QString::number(row.index)
+              << feld(p.vorname)
+              << feld(p.name)
+              << QString::asprintf("%02d.%02d.%04d", p.tag, p.monat, p.jahr)
+              << QString::asprintf("%02d:%02d", stunde, minute)
+              << feld(p.ort)
+              << QString::number(row.result);
+
+        if (row.result == ERR_OK) {
+            zeile << QString::number(row.jd, 'f', 6)
+                  << QString::number(row.asc, 'f', 6)
+                  << QString::number(row.mc, 'f', 6);
+            for (int i = 0; i < MAX_PLANET; ++i) {
+                zeile << QString::number(row.planet[i], 'f', 6);
+            }
+            for (int h = 0; h < MAX_HAUS; ++h) {
+                zeile << QString::number(row.haus[h], 'f', 6);
+            }
+            for (int a = 0; a < ASPEKTE; ++a) {
+                for (int i = 0; i < MAX_PLANET; ++i) {
+                    zeile << QString::number(row.aspekte[a][i]);
+                }
+            }
+        } else {
+            // Feste Spaltenzahl auch für fehlerhafte Zeilen
+            for (int c = 0; c < 3 + MAX_PLANET + MAX_HAUS + ASPEKTE * MAX_PLANET; ++c) {
+                zeile << QString();
+            }
+        }
+
+        out << zeile.join('\t') << '\n';
+    }
+
+    out.flush();
+    if (out.status() != QTextStream::Ok || !file.commit()) {
+        return ERR_FILE;
+    }
+    return ERR_OK;
+}
+
+} // namespace astro
@@ -0,0 +1,99 @@
+#pragma once
+/**
+ * @file bulk_chart.h
+ * @brief Massen-Berechnung von Horoskopen (z.B. ganze Personen-Datenbank)
+ *
+ * Rechnet Positionen, Häuser und Aspekte für viele Personen parallel und
+ * schreibt sie als Tabelle mit festen Spalten (eine Zeile je Person).
+ */
+
+#include "data_types.h"
+#include "ephe_context.h"
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+namespace astro {
+
+/**
+ * @brief Ergebnis-Zeile einer Person
+ */
+struct BulkChartRow {
+    int     index = -1;             // Index in der Eingabeliste
+    int     result = ERR_OK;        // Rückgabe von ChartCalc::calculate
+    double  jd = 0.0;
+    double  asc = 0.0;
+    double  mc = 0.0;
+    double  planet[MAX_PLANET] = {0};
+    double  haus[MAX_HAUS] = {0};
+
+    // Aspekt-Masken: Bit j in aspekte[a][i] = Planet i hat Aspekt a zu Planet j
+    // (a in der Reihenfolge KONJUNKTION, HALBSEX, SEXTIL, QUADRATUR, TRIGON,
+    //  QUINCUNX, OPOSITION)
+    quint32 aspekte[ASPEKTE][MAX_PLANET] = {{0}};
+};
+
+/**
+ * @brief Ergebnis einer Massen-Berechnung
+ */
+struct BulkChartResult {
+    QVector<BulkChartRow> rows;
+    int     fehler = 0;             // Zeilen mit result != ERR_OK
+    int     threads = 1;            // Verwendete Threads
+    qint64  elapsedMs = 0;          // Reine Rechenzeit
+
+    /**
+     * @brief Durchsatz in Zeilen pro Sekunde
+     */
+    double rowsPerSecond() const;
+};
+
+/**
+ * @brief Massen-Berechnung über eine Liste von Personen
+ */
+class BulkChart {
+public:
+    /**
+     * @brief Berechnet alle Personen parallel
+     * @param personen Stammdaten (z.B. PersonDB::getAll())
+     * @param auinit Einstellungen (Orben für die Aspekte)
+     * @param hausSys Häusersystem
+     * @param threads Anzahl Threads (0 = alle Kerne)
+     * @return Zeilen in der Reihenfolge der Eingabe
+     *
+     * Ohne Thread-lokale Swiss Ephemeris (EpheContext::isThreadSafe())
+     * wird sequentiell gerechnet.
+     */
+    static BulkChartResult calculate(const QVector<RadixFix>& personen,
+                                     const AuInit& auinit,
+                                     int hausSys = TYP_PLACIDUS,
+                                     int threads = 0);
+
+    /**
+     * @brief Berechnet eine einzelne Person
+     * @param ctx Ephemeriden-Kontext des rechnenden Threads
+     */
+    static BulkChartRow calculateRow(const RadixFix& person, const AuInit& auinit,
+                                     int hausSys,
+                                     const EpheContext& ctx = EpheContext::current());
+
+    /**
+     * @brief Schreibt die Ergebnisse als Tabelle (Tab-getrennt, UTF-8)
+     * @param filepath Ziel-Datei
+     * @param personen Stammdaten (für Name, Datum, Ort)
+     * @param result Ergebnisse von calculate()
+     * @return ERR_OK bei Erfolg, ERR_FILE sonst
+     *
+     * Spalten: index, vorname, name, datum, zeit, ort, status, jd, asc, mc,
+     * je Planet die Länge, haus1-haus12, je Aspekt und Planet die Maske.
+     */
+    static int writeTable(const QString& filepath, const QVector<RadixFix>& personen,
+                          const BulkChartResult& result);
+
+    /**
+     * @brief Kopfzeile der Tabelle
+     */
+    static QStringList columns();
+};
+
+} // namespace astro
@@ -0,0 +1,207 @@
+#pragma once
+/**
+ * @file calendar.h
+ * @brief Umrechnung Julianisches Datum <-> Kalenderdatum
+ *
+ * Reine Ganzzahl-/Gleitkomma-Arithmetik ohne QDate/QTime, constexpr und
+ * inline - für die Hot-Paths (Transit-Schritte, Rückläufigkeit, Aspekt-
+ * Suche). Ein Zeitschritt von Minuten, Stunden oder Tagen ist eine
+ * Addition auf dem JD; nur Monate und Jahre gehen über das Kalenderdatum.
+ *
+ * Gültig für JD >= 0 (ab 4713 v. Chr.), proleptischer Kalender.
+ */
+
+#include <cstdint>
+
+namespace astro {
+
+/**
+ * @brief Kalenderdatum mit Uhrzeit (auf Sekunden gerundet)
+ */
+struct CalDateTime {
+    int jahr = 2000;
+    int monat = 1;
+    int tag = 1;
+    int stunde = 0;
+    int minute = 0;
+    int sekunde = 0;
+
+    /**
+     * @brief Uhrzeit als Dezimalstunden (wie rFix.zeit)
+     */
+    constexpr double stunden() const {
+        return static_cast<double>(stunde) + static_cast<double>(minute) / 60.0
+             + static_cast<double>(sekunde) / 3600.0;
+    }
+
+    constexpr bool operator==(const CalDateTime&) const = default;
+};
+
+/**
+ * @brief Kalender-Funktionen
+ */
+class Calendar {
+public:
+    static constexpr double MINUTE = 1.0 / 1440.0;     // in Tagen
+    static constexpr double STUNDE = 1.0 / 24.0;       // in Tagen
+    static constexpr int64_t SEKUNDEN_PRO_TAG = 86400;
+
+    //==========================================================================
+    // Kalender
+    //==========================================================================
+
+    /**
+     * @brief Liegt das Datum im gregorianischen Kalender? (ab 15.10.1582)
+     */
+    static constexpr bool isGregorian(int jahr, int monat, int tag) {
+        if (jahr != 1582) return jahr > 1582;
+        if (monat != 10) return monat > 10;
+        return tag >= 15;
+    }
+
+    static constexpr bool isLeapYear(int jahr, bool gregorianisch = true) {
+        if (!gregorianisch) return floorMod(jahr, 4) == 0;
+        return (floorMod(jahr, 4) == 0 && floorMod(jahr, 100) != 0) || floorMod(jahr, 400) == 0;
+    }
+
+    static constexpr int daysInMonth(int jahr, int monat, bool gregorianisch = true) {
+        constexpr int tage[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+        if (monat == 2 && isLeapYear(jahr, gregorianisch)) return 29;
+        return tage[monat - 1];
+    }
+
+    /**
+     * @brief Verschiebt ein Datum um n Monate
+     *
+     * Der Tag wird auf das Monatsende begrenzt (31.01. + 1 = 28./29.02.),
+     * wie bei QDate::addMonths.
+     */
+    static constexpr CalDateTime addMonths(CalDateTime dt, int anzahl, bool gregorianisch = true) {
+        const int monate = dt.jahr * 12 + (dt.monat - 1) + anzahl;
+        dt.jahr = floorDiv(monate, 12);
+        dt.monat = floorMod(monate, 12) + 1;
+        const int maxTag = daysInMonth(dt.jahr, dt.monat, gregorianisch);
+        if (dt.tag > maxTag) dt.tag = maxTag;
+        return dt;
+    }
+
+    //==========================================================================
+    // Julianische Tageszahl (ganzzahlig, Mittag)
+    //==========================================================================
+
+    /**
+     * @brief Julianische Tageszahl eines Kalenderdatums
+     */
+    static constexpr int64_t dayNumber(int jahr, int monat, int tag, bool gregorianisch = true) {
+        const int64_t a = (14 - monat) / 12;
+        const int64_t y = static_cast<int64_t>(jahr) + 4800 - a;
+        const int64_t m = monat + 12 * a - 3;
+        int64_t jdn = tag + (153 * m + 2) / 5 + 365 * y + y / 4;
+        if (gregorianisch) {
+            jdn += -y / 100 + y / 400 - 32045;
+        } else {
+            jdn -= 32083;
+        }
+        return jdn;
+    }
+
+    /**
+     * @brief Kalenderdatum einer Julianischen Tageszahl (Uhrzeit 0:00)
+     */
+    static constexpr CalDateTime fromDayNumber(int64_t jdn, bool gregorianisch = true) {
+        int64_t f = jdn + 1401;
+        if (gregorianisch) {
+            f += (((4 * jdn + 274277) / 146097) * 3) / 4 - 38;
+        }
+        const int64_t e = 4 * f + 3;
+        const int64_t g = (e % 1461) / 4;
+        const int64_t h = 5 * g + 2;
+
+        CalDateTime dt;
+        dt.tag = static_cast<int>((h % 153) / 5 + 1);
+        dt.monat = static_cast<int>((h / 153 + 2) % 12 + 1);
+        dt.jahr = static_cast<int>(e / 1461 - 4716 + (14 - dt.monat) / 12);
+        return dt;
+    }
+
+    //==========================================================================
+    // Julianisches Datum
+    //==========================================================================
+
+    /**
+     * @brief Julianisches Datum
+     * @param stunden Uhrzeit als Dezimalstunden
+     *
+     * Gleicher Tag wie Calculations::julianDay. Die Summanden werden in
+     * anderer Reihenfolge addiert, bei beliebigen Uhrzeiten kann das
+     * Ergebnis daher im letzten Bit (1 ulp) abweichen.
+     */
+    static constexpr double toJD(int jahr, int monat, int tag, double stunden,
+                                 bool gregorianisch = true) {
+        return static_cast<double>(dayNumber(jahr, monat, tag, gregorianisch)) - 0.5
+             + stunden / 24.0;
+    }
+
+    static constexpr double toJD(const CalDateTime& dt, bool gregorianisch = true) {
+        return toJD(dt.jahr, dt.monat, dt.tag, dt.stunden(), gregorianisch);
+    }
+
+    /**
+     * @brief Kalenderdatum und Uhrzeit eines Julianischen Datums
+     *
+     * Auf die nächste Sekunde gerundet - aufsummierte Schritte
+     * (z.B. 1440 x 1 Minute) landen damit wieder auf 0:00:00.
+     */
+    static constexpr CalDateTime fromJD(double jd, bool gregorianisch = true) {
+        const double t = jd + 0.5;
+        int64_t jdn = floorToInt(t);
+        int64_t sekunden = static_cast<int64_t>((t - static_cast<double>(jdn))
+                                                * static_cast<double>(SEKUNDEN_PRO_TAG) + 0.5);
+        if (sekunden >= SEKUNDEN_PRO_TAG) {
+            sekunden -= SEKUNDEN_PRO_TAG;
+            ++jdn;
+        }
+
+        CalDateTime dt = fromDayNumber(jdn, gregorianisch);
+        dt.stunde = static_cast<int>(sekunden / 3600);
+        dt.minute = static_cast<int>((sekunden / 60) % 60);
+        dt.sekunde = static_cast<int>(sekunden % 60);
+        return dt;
+    }
+
+    //==========================================================================
+    // Zeitzonen
+    //==========================================================================
+
+    /**
+     * @brief Ortszeit -> Weltzeit
+     * @param zone Zonen-Offset in Stunden (östlich positiv), inkl. Sommerzeit
+     */
+    static constexpr double localToUT(double jdLokal, double zone) {
+        return jdLokal - zone / 24.0;
+    }
+
+    /**
+     * @brief Weltzeit -> Ortszeit
+     */
+    static constexpr double utToLocal(double jdUT, double zone) {
+        return jdUT + zone / 24.0;
+    }
+
+private:
+    static constexpr int floorDiv(int a, int b) {
+        return (a >= 0) ? a / b : -((-a + b - 1) / b);
+    }
+
+    static constexpr int floorMod(int a, int b) {
+        return a - floorDiv(a, b) * b;
+    }
+
+    // std::floor ist erst ab C++23 constexpr
+    static constexpr int64_t floorToInt(double x) {
+        const int64_t i = static_cast<int64_t>(x);
+        return (static_cast<double>(i) > x) ? i - 1 : i;
+    }
+};
+
+} // namespace astro
@@ -0,0 +1,337 @@
+/**
+ * @file chart_cache.cpp
+ * @brief Implementierung des Chart-Caches
+ */
+
+#include "chart_cache.h"
+#include "chart_calc.h"
+#include <QDataStream>
+#include <QFile>
+#include <QSaveFile>
+
+namespace astro {
+
+// Dateikennung "AUCC" und Formatversion
+static constexpr quint32 CACHE_MAGIC = 0x41554343;
+static constexpr quint16 CACHE_VERSION = 2;
+
+// Nur die Geburtsdaten - Namen, Beruf, Ort und Notiz bleiben beim Aufrufer
+static RadixFix geburtsdaten(const RadixFix& rFix) {
+    RadixFix daten;
+    daten.gultig = rFix.gultig;
+    daten.sommerzeit = rFix.sommerzeit;
+    daten.zone = rFix.zone;
+    daten.laenge = rFix.laenge;
+    daten.breite = rFix.breite;
+    daten.zeit = rFix.zeit;
+    daten.tag = rFix.tag;
+    daten.monat = rFix.monat;
+    daten.jahr = rFix.jahr;
+    return daten;
+}
+
+//==============================================================================
+// Schlüssel
+//==============================================================================
+
+bool ChartKey::operator==(const ChartKey& other) const {
+    return tag == other.tag && monat == other.monat && jahr == other.jahr &&
+           zeit == other.zeit && zone == other.zone && sommerzeit == other.sommerzeit &&
+           laenge == other.laenge && breite == other.breite &&
+           hausSys == other.hausSys && anzahlPlanet == other.anzahlPlanet &&
+           typ == other.typ && ephFlags == other.ephFlags && ephePath == other.ephePath;
+}
+
+size_t qHash(const ChartKey& key, size_t seed) {
+    seed = qHashMulti(seed, key.tag, key.monat, key.jahr, key.zeit, key.zone, key.sommerzeit);
+    return qHashMulti(seed, key.laenge, key.breite, key.hausSys, key.anzahlPlanet,
+                      key.typ, key.ephFlags, key.ephePath);
+}
+
+ChartKey ChartCache::makeKey(const Radix& radix, int typ, const EpheContext& ctx) {
+    ChartKey key;
+    key.tag = radix.rFix.tag;
+    key.monat = radix.rFix.monat;
+    key.jahr = radix.rFix.jahr;
+    key.zeit = radix.rFix.zeit;
+    key.zone = radix.rFix.zone;
+    key.sommerzeit = radix.rFix.sommerzeit;
+    key.laenge = radix.rFix.laenge;
+    key.breite = radix.rFix.breite;
+    key.hausSys = radix.hausSys;
+    key.anzahlPlanet = radix.anzahlPlanet;
+    key.typ = typ;
+    key.ephFlags = ctx.config().flags;
+    key.ephePath = ctx.config().ephePath;
+    return key;
+}
+
+//==============================================================================
+// Zugriff
+//==============================================================================
+
+ChartCache::ChartCache()
+    : m_entries(256)
+    , m_hits(0)
+    , m_misses(0) {
+}
+
+std::shared_ptr<const Radix> ChartCache::find(const ChartKey& key) {
+    QMutexLocker locker(&m_mutex);
+
+    const std::shared_ptr<const Radix>* eintrag = m_entries.find(key);
+    if (eintrag == nullptr) {
+        ++m_misses;
+        return nullptr;
+    }
+    ++m_hits;
+    return *eintrag;
+}
+
+void ChartCache::insert(const ChartKey& key, const Radix& radix) {
+    // Nur die Horoskop-Ergebnisse ablegen, keine Personendaten
+    auto entry = std::make_shared<Radix>();
+    entry->rFix = geburtsdaten(radix.rFix);
+    entry->hausSys = radix.hausSys;
+    entry->horoTyp = radix.horoTyp;
+    entry->aspPlanet.clear();
+    entry->winkelPlanet.clear();
+    entry->aspHaus.clear();
+    entry->winkelHaus.clear();
+    applyChart(radix, *entry);
+
+    QMutexLocker locker(&m_mutex);
+    m_entries.insert(key, std::move(entry));
+}
+
+int ChartCache::calculate(Radix& radix, int typ, const EpheContext& ctx) {
+    const ChartKey key = makeKey(radix, typ, ctx);
+
+    if (auto cached = find(key)) {
+        applyChart(*cached, radix);
+        return ERR_OK;
+    }
+
+    int result = ChartCalc::calculate(radix, nullptr, typ, ctx);
+    if (result == ERR_OK) {
+        insert(key, radix);
+    }
+    return result;
+}
+
+void ChartCache::applyChart(const Radix& from, Radix& to) {
+    to.stzPlanet = from.stzPlanet;
+    to.stzHaus = from.stzHaus;
+    to.planet = from.planet;
+    to.planetRad = from.planetRad;
+    to.haus = from.haus;
+    to.hausRad = from.hausRad;
+    to.planetTyp = from.planetTyp;
+    to.inHaus = from.inHaus;
+    for (int i = 0; i < MAX_QUALITATEN; ++i) {
+        to.qualitaten[i] = from.qualitaten[i];
+    }
+
+    to.breite = from.breite;
+    to.dT = from.dT;
+    to.jd = from.jd;
+    to.sid = from.sid;
+    to.ver = from.ver;
+    to.mc = from.mc;
+    to.asc = from.asc;
+    to.ra = from.ra;
+    to.ob = from.ob;
+    to.anzahlPlanet = from.anzahlPlanet;
+}
+
+void ChartCache::clear() {
+    QMutexLocker locker(&m_mutex);
+    m_entries.clear();
+    m_hits = 0;
+    m_misses = 0;
+}
+
+int ChartCache::count() const {
+    QMutexLocker locker(&m_mutex);
+    return m_entries.size();
+}
+
+int ChartCache::maxEntries() const {
+    QMutexLocker locker(&m_mutex);
+    return m_entries.maxEntries();
+}
+
+void ChartCache::setMaxEntries(int maxEntries) {
+    QMutexLocker locker(&m_mutex);
+    m_entries.setMaxEntries(maxEntries);
+}
+
+//==============================================================================
+// Statistik
+//==============================================================================
+
+qint64 ChartCache::hits() const {
+    QMutexLocker locker(&m_mutex);
+    return m_hits;
+}
+
+qint64 ChartCache::misses() const {
+    QMutexLocker locker(&m_mutex);
+    return m_misses;
+}
+
+double ChartCache::hitRate() const {
+    QMutexLocker locker(&m_mutex);
+    const qint64 total = m_hits + m_misses;
+    return total > 0 ? static_cast<double>(m_hits) / total : 0.0;
+}
+
+template<typename T>
+static qint64 vectorBytes(const QVector<T>& v) {
+    return v.capacity() * static_cast<qint64>(sizeof(T));
+}
+
+qint64 ChartCache::memoryUsage() const {
+    QMutexLocker locker(&m_mutex);
+
+    qint64 bytes = 0;
+    for (const auto& [key, radix] : m_entries) {
+        const Radix& r = *radix;
+        bytes += sizeof(ChartKey) + key.ephePath.capacity() * sizeof(QChar);
+        bytes += sizeof(Radix);
+        bytes += vectorBytes(r.stzPlanet) + vectorBytes(r.stzHaus);
+        bytes += vectorBytes(r.planet) + vectorBytes(r.planetRad);
+        bytes += vectorBytes(r.haus) + vectorBytes(r.hausRad);
+        bytes += vectorBytes(r.planetTyp) + vectorBytes(r.inHaus);
+    }
+    return bytes;
+}
+
+//==============================================================================
+// Persistenz
+//==============================================================================
+
+int ChartCache::save(const QString& filepath) const {
+    QSaveFile file(filepath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return ERR_FILE;
+    }
+
+    QDataStream stream(&file);
+    stream.setByteOrder(QDataStream::LittleEndian);
+    stream.setVersion(QDataStream::Qt_6_0);
+
+    QMutexLocker locker(&m_mutex);
+
+    stream << CACHE_MAGIC << CACHE_VERSION << static_cast<qint32>(m_entries.size());
+
+    // Älteste zuerst, damit load() die LRU-Reihenfolge wiederherstellt
+    for (auto it = m_entries.rbegin(); it != m_entries.rend(); ++it) {
+        const ChartKey& k = it->first;
+        const Radix& r = *it->second;
+
+        stream << k.tag << k.monat << k.jahr << k.zeit << k.zone << k.sommerzeit
+               << k.laenge << k.breite << k.hausSys << k.anzahlPlanet
+               << static_cast<qint32>(k.typ) << k.ephFlags << k.ephePath;
+
+        // Personendaten (Namen, Ort) werden nicht gesichert - die Geburtsdaten
+        // stehen im Schlüssel, alles andere kommt beim Abruf vom Aufrufer
+        stream << r.hausSys << r.horoTyp << r.anzahlPlanet
+               << r.breite << r.dT << r.jd << r.sid << r.ver
+               << r.mc << r.asc << r.ra << r.ob
+               << r.stzPlanet << r.stzHaus << r.planet << r.planetRad
+               << r.haus << r.hausRad << r.planetTyp << r.inHaus;
+        for (int i = 0; i < MAX_QUALITATEN; ++i) {
+            stream << r.qualitaten[i];
+        }
+    }
+
+    locker.unlock();
+
+    if (stream.status() != QDataStream::Ok || !file.commit()) {
+        return ERR_FILE;
+    }
+    return ERR_OK;
+}
+
+int ChartCache::load(const QString& filepath, const EpheContext& ctx) {
+    QFile file(filepath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return ERR_FILE;
+    }
+
+    QDataStream stream(&file);
+    stream.setByteOrder(QDataStream::LittleEndian);
+    stream.setVersion(QDataStream::Qt_6_0);
+
+    quint32 magic = 0;
+    quint16 version = 0;
+    qint32 anzahl = 0;
+    stream >> magic >> version >> anzahl;
+    if (magic != CACHE_MAGIC || version != CACHE_VERSION || anzahl < 0) {
+        return ERR_FILE;
+    }
+
+    const int32_t ephFlags = ctx.config().flags;
+    const QString ephePath = ctx.config().ephePath;
+
+    QList<QPair<ChartKey, std::shared_ptr<const Radix>>> geladen;
+    for (qint32 n = 0; n < anzahl; ++n) {
+        ChartKey k;
+        qint32 typ = 0;
+        stream >> k.tag >> k.monat >> k.jahr >> k.zeit >> k.zone >> k.sommerzeit
+               >> k.laenge >> k.breite >> k.hausSys >> k.anzahlPlanet
+               >> typ >> k.ephFlags >> k.ephePath;
+        k.typ = typ;
+
+        auto r = std::make_shared<Radix>();
+        r->aspPlanet.clear();
+        r->winkelPlanet.clear();
+        r->aspHaus.clear();
+        r->winkelHaus.clear();
+        stream >> r->hausSys >> r->horoTyp >> r->anzahlPlanet
+               >> r->breite >> r->dT >> r->jd >> r->sid >> r->ver
+               >> r->mc >> r->asc >> r->ra >> r->ob
+               >> r->stzPlanet >> r->stzHaus >> r->planet >> r->planetRad
+               >> r->haus >> r->hausRad >> r->planetTyp >> r->inHaus;
+        for (int i = 0; i < MAX_QUALITATEN; ++i) {
+            stream >> r->qualitaten[i];
+        }
+
+        if (stream.status() != QDataStream::Ok) {
+            return ERR_FILE;
+        }
+
+        // Mit anderen Ephemeriden berechnet - nicht übernehmen
+        if (k.ephFlags != ephFlags || k.ephePath != ephePath) {
+            continue;
+        }
+        r->rFix.tag = k.tag;
+        r->rFix.monat = k.monat;
+        r->rFix.jahr = k.jahr;
+        r->rFix.zeit = k.zeit;
+        r->rFix.zone = k.zone;
+        r->rFix.sommerzeit = k.sommerzeit;
+        r->rFix.laenge = k.laenge;
+        r->rFix.breite = k.breite;
+        r->rFix.gultig = true;
+        geladen.append({ k, std::move(r) });
+    }
+
+    QMutexLocker locker(&m_mutex);
+    for (auto& eintrag : geladen) {
+        m_entries.insert(eintrag.first, std::move(eintrag.second));
+    }
+    return ERR_OK;
+}
+
+//==============================================================================
+// Globale Instanz
+//==============================================================================
+
+ChartCache& chartCache() {
+    static ChartCache instance;
+    return instance;
+}
+
+} // namespace astro
@@ -0,0 +1,164 @@
+#pragma once
+/**
+ * @file chart_cache.h
+ * @brief Prozessweiter Cache für berechnete Horoskope
+ *
+ * Dieselbe Person wird oft mehrfach berechnet (Personensuche → Radix,
+ * Synastrie-Partner, Transit-Basis). Der Cache hält die Ergebnisse von
+ * ChartCalc::calculate je Geburtsdaten und Einstellungen und kann sie
+ * optional auf Platte sichern. Personendaten (Namen, Ort, Notiz) werden
+ * weder gehalten noch gesichert.
+ */
+
+#include "data_types.h"
+#include "ephe_context.h"
+#include "lru_cache.h"
+#include <QHash>
+#include <QMutex>
+#include <QString>
+#include <memory>
+
+namespace astro {
+
+/**
+ * @brief Schlüssel eines gecachten Horoskops
+ *
+ * Enthält alles, was in ChartCalc::calculate einfließt - Namen und
+ * Notizen gehören nicht dazu.
+ */
+struct ChartKey {
+    int16_t tag = 0;
+    int16_t monat = 0;
+    int16_t jahr = 0;
+    double  zeit = 0.0;
+    float   zone = 0.0f;
+    double  sommerzeit = 0.0;
+    double  laenge = 0.0;
+    double  breite = 0.0;
+    int8_t  hausSys = 0;
+    int16_t anzahlPlanet = 0;
+    int     typ = TYP_RADIX;        // Horoskop-Typ (Planet-Typ-Flags)
+    int32_t ephFlags = 0;           // SwissEph::calcFlags()
+    QString ephePath;               // Ephemeriden-Verzeichnis
+
+    bool operator==(const ChartKey& other) const;
+    bool operator!=(const ChartKey& other) const { return !(*this == other); }
+};
+
+size_t qHash(const ChartKey& key, size_t seed = 0);
+
+/**
+ * @brief LRU-Cache für Horoskop-Berechnungen
+ *
+ * Gespeichert werden nur die Ergebnisse von ChartCalc::calculate
+ * (JD, Variablen, Häuser, Planeten, Qualitäten) - keine Aspekte, da diese
+ * von Orben und Partner abhängen. Einträge sind unveränderlich und werden
+ * geteilt; die QVector-Daten werden beim Übernehmen nur referenziert.
+ * Thread-sicher.
+ */
+class ChartCache {
+public:
+    ChartCache();
+
+    //==========================================================================
+    // Zugriff
+    //==========================================================================
+
+    /**
+     * @brief Erzeugt den Schlüssel für einen Radix
+     * @param radix Radix mit Eingabe (Datum, Zeit, Ort, Häusersystem)
+     * @param typ Horoskop-Typ für die Planet-Typ-Flags
+     * @param ctx Ephemeriden-Kontext (Flags und Pfad gehören zum Schlüssel)
+     */
+    static ChartKey makeKey(const Radix& radix, int typ = TYP_RADIX,
+                            const EpheContext& ctx = EpheContext::current());
+
+    /**
+     * @brief Sucht ein berechnetes Horoskop (zählt Treffer/Fehlschläge)
+     * @return Geteiltes Ergebnis oder nullptr - rFix enthält nur die
+     *         Geburtsdaten, mit applyChart() in den eigenen Radix übernehmen
+     */
+    std::shared_ptr<const Radix> find(const ChartKey& key);
+
+    /**
+     * @brief Legt ein berechnetes Horoskop ab
+     * @param key Schlüssel
+     * @param radix Mit ChartCalc::calculate berechneter Radix
+     */
+    void insert(const ChartKey& key, const Radix& radix);
+
+    /**
+     * @brief Berechnet einen Radix oder übernimmt ihn aus dem Cache
+     * @param radix [in/out] Radix mit Eingabe und Ausgabe (wie ChartCalc)
+     * @param typ Horoskop-Typ
+     * @param ctx Ephemeriden-Kontext
+     * @return ERR_OK bei Erfolg, Fehlercode sonst
+     *
+     * Ersetzt ChartCalc::calculate(radix, nullptr, typ, ctx).
+     */
+    int calculate(Radix& radix, int typ = TYP_RADIX,
+                  const EpheContext& ctx = EpheContext::current());
+
+    /**
+     * @brief Kopiert die Horoskop-Ergebnisse in einen Radix
+     *
+     * Stammdaten (rFix), Aspekte und Zeichnungs-Flags des Ziels bleiben
+     * erhalten.
+     */
+    static void applyChart(const Radix& from, Radix& to);
+
+    void clear();
+    int count() const;
+
+    int maxEntries() const;
+    void setMaxEntries(int maxEntries);
+
+    //==========================================================================
+    // Statistik
+    //==========================================================================
+
+    qint64 hits() const;
+    qint64 misses() const;
+
+    /**
+     * @brief Trefferquote 0.0 - 1.0 (0 wenn noch nicht abgefragt)
+     */
+    double hitRate() const;
+
+    /**
+     * @brief Geschätzter Speicherbedarf aller Einträge in Bytes
+     */
+    qint64 memoryUsage() const;
+
+    //==========================================================================
+    // Persistenz
+    //==========================================================================
+
+    /**
+     * @brief Sichert alle Einträge in eine Datei (ohne Personendaten)
+     * @return ERR_OK bei Erfolg, ERR_FILE sonst
+     */
+    int save(const QString& filepath) const;
+
+    /**
+     * @brief Lädt Einträge aus einer Datei (ergänzt den Cache)
+     * @return ERR_OK bei Erfolg, ERR_FILE wenn nicht lesbar oder ungültig
+     *
+     * Einträge, die mit anderen Ephemeriden-Flags oder einem anderen
+     * Ephemeriden-Pfad als in ctx berechnet wurden, werden übersprungen.
+     */
+    int load(const QString& filepath, const EpheContext& ctx = EpheContext::current());
+
+private:
+    mutable QMutex m_mutex;
+    LruCache<ChartKey, std::shared_ptr<const Radix>> m_entries;
+    qint64 m_hits;
+    qint64 m_misses;
+};
+
+/**
+ * @brief Globale Chart-Cache Instanz
+ */
+ChartCache& chartCache();
+
+} // namespace astro
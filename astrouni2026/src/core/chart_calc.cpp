@@ -5,7 +5,8 @@
 
 #include "chart_calc.h"
 #include "calculations.h"
-#include "swiss_eph.h"
+#include "instrumentation.h"
+#include "synastry.h"
 #include <cmath>
 
 namespace astro {
@@ -14,7 +15,8 @@ namespace astro {
 // Haupt-Berechnungsfunktionen
 //==============================================================================
 
-int ChartCalc::calculate(Radix& radix, Radix* transit, int typ) {
+int ChartCalc::calculate(Radix& radix, Radix* transit, int typ, const EpheContext& ctx) {
+    ASTRO_TIMER("ChartCalc::calculate");
     // 1. Julianisches Datum berechnen
     radix.jd = Calculations::julianDay(
         radix.rFix.tag, 
@@ -25,43 +27,46 @@ int ChartCalc::calculate(Radix& radix, Radix* transit, int typ) {
     );
     
     // 2. Variablen berechnen (MC, ASC, Siderische Zeit, etc.)
-    calcVariables(radix);
+    calcVariables(radix, ctx);
     
     // 3. Häuser berechnen
-    int result = calcHouses(radix);
+    int result = calcHouses(radix, ctx);
     if (result != ERR_OK) {
         return result;
     }
     
     // 4. Planeten berechnen
-    calcPlanets(radix);
+    calcPlanets(radix, ctx);
     
     // 5. Planet-Typen setzen
-    setPlanetType(radix, typ);
+    setPlanetType(radix, typ, ctx);
     
     // 6. Qualitäten berechnen
     calcQualities(radix);
     
-    // 7. Fehlende Werte für Synastrie (STRICT LEGACY: kein Composit)
+    // 7. Fehlende Werte für Synastrie (STRICT LEGACY: kein Composit),
+    //    hier ohne Einstellungen mit den Standard-Orben
     if (transit != nullptr && typ == TYP_SYNASTRIE) {
-        calcMissing(radix, transit, typ);
+        static const AuInit standard;
+        calcMissing(radix, transit, typ, standard, ctx);
     }
     
     return ERR_OK;
 }
 
-void ChartCalc::calcVariables(Radix& radix) {
+void ChartCalc::calcVariables(Radix& radix, const EpheContext& ctx) {
+    ASTRO_TIMER("ChartCalc::calcVariables");
     // Breite für Berechnungen
     radix.breite = radix.rFix.breite;
     
     // Delta T
-    radix.dT = swissEph().calcDeltaT(radix.jd);
+    radix.dT = ctx.calcDeltaT(radix.jd);
     
     // Obliquität (Schiefe der Ekliptik)
-    radix.ob = swissEph().calcObliquity(radix.jd);
+    radix.ob = ctx.calcObliquity(radix.jd);
     
     // Siderische Zeit
-    radix.sid = swissEph().calcSiderealTime(radix.jd, radix.rFix.laenge);
+    radix.sid = ctx.calcSiderealTime(radix.jd, radix.rFix.laenge);
     
     // RAMC (Rektaszension des MC)
     radix.ra = radix.sid;
@@ -100,12 +105,13 @@ void ChartCalc::calcVariables(Radix& radix) {
     radix.ver = Calculations::mod360(radix.ver);
 }
 
-int ChartCalc::calcHouses(Radix& radix) {
+int ChartCalc::calcHouses(Radix& radix, const EpheContext& ctx) {
+    ASTRO_TIMER("ChartCalc::calcHouses");
     // Swiss Ephemeris für Häuserberechnung verwenden
     double cusps[13];
     double ascmc[10];
     
-    bool success = swissEph().calcHouses(
+    const EpheStatus status = ctx.calcHouses(
         radix.jd,
         radix.breite,
         radix.rFix.laenge,
@@ -114,7 +120,7 @@ int ChartCalc::calcHouses(Radix& radix) {
         ascmc
     );
     
-    if (!success) {
+    if (!status.ok()) {
         return ERR_HOUSE;
     }
     
@@ -132,17 +138,19 @@ int ChartCalc::calcHouses(Radix& radix) {
     return ERR_OK;
 }
 
-void ChartCalc::calcPlanets(Radix& radix) {
+void ChartCalc::calcPlanets(Radix& radix, const EpheContext& ctx) {
+    ASTRO_TIMER("ChartCalc::calcPlanets");
     for (int i = 0; i < radix.anzahlPlanet; ++i) {
-        double lon, lat, dist, speed;
+        const PlanetPos pos = ctx.calcPlanet(i, radix.jd);
         
-        if (swissEph().calcPlanet(i, radix.jd, lon, lat, dist, speed)) {
+        if (pos.ok()) {
+            const double lon = pos.longitude;
             radix.planet[i] = lon;
             radix.planetRad[i] = lon * PI / DEGHALB;
             radix.stzPlanet[i] = Calculations::getZeichen(lon);
             
             // Rückläufigkeit prüfen
-            if (speed < 0.0) {
+            if (pos.speed < 0.0) {
                 radix.planetTyp[i] |= P_TYP_RUCK;
             }
             
@@ -156,12 +164,13 @@ void ChartCalc::calcPlanets(Radix& radix) {
             radix.inHaus[i] = 0;
             // Debug: Fehler ausgeben
             qWarning("Planet %d konnte nicht berechnet werden: %s", 
-                     i, qPrintable(swissEph().getLastError()));
+                     i, qPrintable(pos.status.error));
         }
     }
 }
 
 void ChartCalc::calcHouseAspects(Radix& radix, const QVector<float>& orben, int16_t aspektFlags) {
+    ASTRO_TIMER("ChartCalc::calcHouseAspects");
     // Nur berechnen, wenn Häuseraspekte aktiviert sind
     if ((aspektFlags & S_HAUS) == 0) {
         // aspHaus auf KEIN_ASP zurücksetzen
@@ -218,13 +227,17 @@ void ChartCalc::calcHouseAspects(Radix& radix, const QVector<float>& orben, int1
     }
 }
 
-void ChartCalc::calcMissing(Radix& radix, Radix* transit, int typ) {
-    // STRICT LEGACY: Nur Radix, Synastrie, Transit - kein Composit
-    // Synastrie: Beide Radixe bleiben unverändert
+void ChartCalc::calcMissing(Radix& radix, Radix* transit, int typ, const AuInit& auinit,
+                            const EpheContext& ctx) {
+    // Synastrie: Beide Radixe bleiben unverändert, Kreuz-Aspekte, Composit
+    // und Davison (mit dem Kontext dieser Berechnung) kommen als Ergebnis an
+    // den Radix.
     // Transit: Transit-Planeten werden separat berechnet
-    Q_UNUSED(radix);
-    Q_UNUSED(transit);
-    Q_UNUSED(typ);
+    if (transit == nullptr || typ != TYP_SYNASTRIE) {
+        return;
+    }
+    radix.synastrieErgebnis = std::make_shared<const SynastrieErgebnis>(SynastrieCalc::calculate(
+        radix, *transit, auinit, typ, SynastrieCalc::SYN_ALLE, ctx));
 }
 
 //==============================================================================
@@ -232,6 +245,7 @@ void ChartCalc::calcMissing(Radix& radix, Radix* transit, int typ) {
 //==============================================================================
 
 void ChartCalc::calcAspects(Radix& radix, const QVector<float>& orben) {
+    ASTRO_TIMER("ChartCalc::calcAspects");
     static const int aspekte[] = {
         KONJUNKTION, HALBSEX, SEXTIL, QUADRATUR, TRIGON, QUINCUNX, OPOSITION
     };
@@ -268,6 +282,7 @@ void ChartCalc::calcAspects(Radix& radix, const QVector<float>& orben) {
 }
 
 void ChartCalc::calcAngles(Radix& radix, Radix* transit, int typ) {
+    ASTRO_TIMER("ChartCalc::calcAngles");
     int numPlanets = radix.anzahlPlanet;
     
     // Winkel zwischen Planeten
@@ -297,6 +312,7 @@ void ChartCalc::calcAngles(Radix& radix, Radix* transit, int typ) {
 //==============================================================================
 
 void ChartCalc::calcQualities(Radix& radix) {
+    ASTRO_TIMER("ChartCalc::calcQualities");
     // Qualitäten zurücksetzen
     for (int i = 0; i < MAX_QUALITATEN; ++i) {
         radix.qualitaten[i] = 0;
@@ -371,13 +387,13 @@ int8_t ChartCalc::getHouseOfPlanet(double planetPos, const QVector<double>& haus
     return 0;  // Fallback
 }
 
-void ChartCalc::setPlanetType(Radix& radix, int typ) {
+void ChartCalc::setPlanetType(Radix& radix, int typ, const EpheContext& ctx) {
     for (int i = 0; i < radix.anzahlPlanet; ++i) {
         // Basis-Typ setzen
         radix.planetTyp[i] = P_TYP_NORM;
         
         // Rückläufigkeit prüfen (bereits in calcPlanets gesetzt)
-        if (swissEph().isRetrograde(i, radix.jd)) {
+        if (ctx.isRetrograde(i, radix.jd)) {
             radix.planetTyp[i] |= P_TYP_RUCK;
         }
         
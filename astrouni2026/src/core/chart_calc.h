@@ -7,6 +7,7 @@
  */
 
 #include "data_types.h"
+#include "ephe_context.h"
 
 namespace astro {
 
@@ -26,11 +27,16 @@ public:
      * @param radix [in/out] Radix-Daten mit Eingabe (Datum, Zeit, Ort) und Ausgabe
      * @param transit Optional: Transit-Radix für Synastrie/Composit
      * @param typ Horoskop-Typ (TYP_RADIX, TYP_TRANSIT, etc.)
+     *            Bei TYP_SYNASTRIE mit Partner rechnet calcMissing() mit den
+     *            Standard-Orben; für die eingestellten Orben danach
+     *            ChartPipeline::calcAspects() bzw. calcMissing() mit AuInit
+     * @param ctx Ephemeriden-Kontext (Worker-Threads übergeben ihren eigenen)
      * @return ERR_OK bei Erfolg, Fehlercode sonst
      * 
      * Port von: sCalcChart(RADIX*, RADIX*, short)
      */
-    static int calculate(Radix& radix, Radix* transit = nullptr, int typ = TYP_RADIX);
+    static int calculate(Radix& radix, Radix* transit = nullptr, int typ = TYP_RADIX,
+                         const EpheContext& ctx = EpheContext::current());
     
     /**
      * @brief Berechnet die Häuserspitzen
@@ -39,7 +45,7 @@ public:
      * 
      * Port von: sCalcHauser(RADIX*)
      */
-    static int calcHouses(Radix& radix);
+    static int calcHouses(Radix& radix, const EpheContext& ctx = EpheContext::current());
     
     /**
      * @brief Berechnet die Planetenpositionen
@@ -47,7 +53,7 @@ public:
      * 
      * Port von: vCalcPlanets(RADIX*)
      */
-    static void calcPlanets(Radix& radix);
+    static void calcPlanets(Radix& radix, const EpheContext& ctx = EpheContext::current());
     
     /**
      * @brief Berechnet Variablen (MC, ASC, Siderische Zeit, etc.)
@@ -55,17 +61,21 @@ public:
      * 
      * Port von: vCalcVar(RADIX*)
      */
-    static void calcVariables(Radix& radix);
+    static void calcVariables(Radix& radix, const EpheContext& ctx = EpheContext::current());
     
     /**
      * @brief Berechnet fehlende Werte (Composit, Synastrie)
-     * @param radix Haupt-Radix
+     * @param radix Haupt-Radix (radix.synastrieErgebnis wird gesetzt)
      * @param transit Transit/Partner-Radix
      * @param typ Horoskop-Typ
+     * @param auinit Orben für die Kreuz-Aspekte
+     * @param ctx Ephemeriden-Kontext für das Davison-Horoskop
      * 
      * Port von: vCalcMissing(RADIX*, RADIX*, short)
+     * Bei Synastrie über SynastrieCalc (mit Composit und Davison).
      */
-    static void calcMissing(Radix& radix, Radix* transit, int typ);
+    static void calcMissing(Radix& radix, Radix* transit, int typ, const AuInit& auinit,
+                            const EpheContext& ctx = EpheContext::current());
     
     //==========================================================================
     // Häusersystem-Berechnungen
@@ -217,7 +227,8 @@ public:
      * 
      * Port von: sSetPlanetTyp(RADIX*, short)
      */
-    static void setPlanetType(Radix& radix, int typ);
+    static void setPlanetType(Radix& radix, int typ,
+                              const EpheContext& ctx = EpheContext::current());
     
 private:
     // Hilfsfunktionen für Häuserberechnung
@@ -0,0 +1,299 @@
+/**
+ * @file chart_pipeline.cpp
+ * @brief Implementierung der inkrementellen Horoskop-Berechnung
+ */
+
+#include "chart_pipeline.h"
+#include "analysis_cache.h"
+#include "calculations.h"
+#include "chart_cache.h"
+#include "chart_calc.h"
+#include "synastry.h"
+#include <QHash>
+#include <QStringList>
+
+namespace astro {
+
+//==============================================================================
+// Konstruktor
+//==============================================================================
+
+ChartPipeline::ChartPipeline()
+    : m_valid(0)
+    , m_lastStages(0) {
+}
+
+//==============================================================================
+// Abhängigkeiten
+//==============================================================================
+
+int ChartPipeline::dependents(int stages) {
+    // Direkte Abhängigkeiten: Stufe → Stufen, die ihr Ergebnis verwenden
+    static const struct { int stage; int deps; } kanten[] = {
+        { STAGE_JD,          STAGE_VARIABLEN | STAGE_PLANETEN },
+        { STAGE_VARIABLEN,   STAGE_HAEUSER },
+        { STAGE_HAEUSER,     STAGE_ASPEKTE | STAGE_TEXT },
+        { STAGE_PLANETEN,    STAGE_ASPEKTE | STAGE_QUALITAETEN },
+        { STAGE_ASPEKTE,     STAGE_TEXT },
+        { STAGE_QUALITAETEN, STAGE_TEXT },
+    };
+
+    int result = stages;
+    int vorher;
+    do {
+        vorher = result;
+        for (const auto& k : kanten) {
+            if (result & k.stage) {
+                result |= k.deps;
+            }
+        }
+    } while (result != vorher);
+
+    return result;
+}
+
+void ChartPipeline::invalidate(int stages) {
+    m_valid &= ~dependents(stages);
+}
+
+ChartPipeline::ChartInput ChartPipeline::chartInput(const Radix& radix, int typ) {
+    ChartInput in;
+    in.tag = radix.rFix.tag;
+    in.monat = radix.rFix.monat;
+    in.jahr = radix.rFix.jahr;
+    in.zeit = radix.rFix.zeit;
+    in.zone = radix.rFix.zone;
+    in.sommerzeit = radix.rFix.sommerzeit;
+    in.laenge = radix.rFix.laenge;
+    in.breite = radix.rFix.breite;
+    in.hausSys = radix.hausSys;
+    in.anzahlPlanet = radix.anzahlPlanet;
+    in.typ = typ;
+    return in;
+}
+
+ChartPipeline::AspectInput ChartPipeline::aspectInput(const AuInit& auinit, int typ,
+                                                      const Radix* partner) {
+    AspectInput in;
+    in.typ = typ;
+    in.orben = orbenHash(auinit);
+    if (partner != nullptr) {
+        in.partnerPlanet = partner->planet;
+    }
+    return in;
+}
+
+size_t ChartPipeline::orbenHash(const AuInit& auinit) {
+    size_t seed = qHash(auinit.sAspekte);
+    seed = qHashRange(auinit.orbenPlanet.begin(), auinit.orbenPlanet.end(), seed);
+    seed = qHashRange(auinit.orbenHaus.begin(), auinit.orbenHaus.end(), seed);
+    seed = qHashRange(auinit.orbenTPlanet.begin(), auinit.orbenTPlanet.end(), seed);
+    seed = qHashRange(auinit.orbenTHaus.begin(), auinit.orbenTHaus.end(), seed);
+    seed = qHashRange(auinit.orbenSPlanet.begin(), auinit.orbenSPlanet.end(), seed);
+    seed = qHashRange(auinit.orbenSHaus.begin(), auinit.orbenSHaus.end(), seed);
+    return seed;
+}
+
+//==============================================================================
+// Berechnung
+//==============================================================================
+
+int ChartPipeline::calculate(Radix& radix, int typ) {
+    m_lastStages = 0;
+
+    const ChartInput in = chartInput(radix, typ);
+    int dirty = 0;
+    if (in.tag != m_chart.tag || in.monat != m_chart.monat || in.jahr != m_chart.jahr ||
+        in.zeit != m_chart.zeit || in.zone != m_chart.zone ||
+        in.sommerzeit != m_chart.sommerzeit) {
+        dirty |= STAGE_JD;
+    }
+    if (in.laenge != m_chart.laenge || in.breite != m_chart.breite) {
+        dirty |= STAGE_VARIABLEN;
+    }
+    if (in.hausSys != m_chart.hausSys) {
+        dirty |= STAGE_HAEUSER;
+    }
+    if (in.anzahlPlanet != m_chart.anzahlPlanet || in.typ != m_chart.typ) {
+        dirty |= STAGE_PLANETEN;
+    }
+    invalidate(dirty);
+    m_chart = in;
+
+    const int todo = STAGE_CHART & ~m_valid;
+
+    // Alles neu: fertiges Horoskop aus dem Chart-Cache übernehmen
+    ChartKey cacheKey;
+    if (todo == STAGE_CHART) {
+        cacheKey = ChartCache::makeKey(radix, typ);
+        if (auto cached = chartCache().find(cacheKey)) {
+            ChartCache::applyChart(*cached, radix);
+            m_valid |= STAGE_CHART;
+            return ERR_OK;
+        }
+    }
+
+    // 1. Julianisches Datum
+    if (todo & STAGE_JD) {
+        radix.jd = Calculations::julianDay(
+            radix.rFix.tag,
+            radix.rFix.monat,
+            radix.rFix.jahr,
+            radix.rFix.zeit - radix.rFix.zone - radix.rFix.sommerzeit,
+            true  // Gregorianisch
+        );
+        m_valid |= STAGE_JD;
+        m_lastStages |= STAGE_JD;
+    }
+
+    // 2. Variablen (MC, ASC, Siderische Zeit, etc.)
+    if (todo & STAGE_VARIABLEN) {
+        ChartCalc::calcVariables(radix);
+        m_valid |= STAGE_VARIABLEN;
+        m_lastStages |= STAGE_VARIABLEN;
+    }
+
+    // 3. Häuser
+    if (todo & STAGE_HAEUSER) {
+        int result = ChartCalc::calcHouses(radix);
+        if (result != ERR_OK) {
+            return result;
+        }
+        // Unveränderte Planeten den neuen Häusern zuordnen
+        if (!(todo & STAGE_PLANETEN)) {
+            assignHouses(radix);
+        }
+        m_valid |= STAGE_HAEUSER;
+        m_lastStages |= STAGE_HAEUSER;
+    }
+
+    // 4. Planeten inkl. Planet-Typen
+    if (todo & STAGE_PLANETEN) {
+        ChartCalc::calcPlanets(radix);
+        ChartCalc::setPlanetType(radix, typ);
+        m_valid |= STAGE_PLANETEN;
+        m_lastStages |= STAGE_PLANETEN;
+    }
+
+    // 5. Qualitäten
+    if (todo & STAGE_QUALITAETEN) {
+        ChartCalc::calcQualities(radix);
+        m_valid |= STAGE_QUALITAETEN;
+        m_lastStages |= STAGE_QUALITAETEN;
+    }
+
+    if (todo == STAGE_CHART) {
+        chartCache().insert(cacheKey, radix);
+    }
+
+    return ERR_OK;
+}
+
+void ChartPipeline::calcAspects(Radix& radix, const AuInit& auinit, int typ, Radix* partner) {
+    m_lastStages = 0;
+
+    AspectInput in = aspectInput(auinit, typ, partner);
+    if (in.typ != m_aspect.typ || in.orben != m_aspect.orben ||
+        in.partnerPlanet != m_aspect.partnerPlanet) {
+        invalidate(STAGE_ASPEKTE);
+    }
+    m_aspect = std::move(in);
+
+    if (m_valid & STAGE_ASPEKTE) {
+        return;
+    }
+
+    // Orben passend zum Horoskop-Typ (wie MainWindow)
+    const QVector<float>* orben = &auinit.orbenPlanet;
+    if (typ == TYP_SYNASTRIE) {
+        orben = &auinit.orbenSPlanet;
+    } else if (typ == TYP_TRANSIT) {
+        orben = &auinit.orbenTPlanet;
+    }
+
+    ChartCalc::calcAspects(radix, *orben);
+    ChartCalc::calcAngles(radix, partner, typ);
+    ChartCalc::calcHouseAspects(radix, auinit.orbenHaus, auinit.sAspekte);
+
+    // Kreuz-Aspekte zum Partner einmal für Grafik, Liste, Text und PDF.
+    // Composit und Davison nur auf Anfrage über SynastrieCalc::ergebnis()
+    if (partner != nullptr && (typ == TYP_SYNASTRIE || typ == TYP_TRANSIT)) {
+        radix.synastrieErgebnis = std::make_shared<const SynastrieErgebnis>(
+            SynastrieCalc::calculate(radix, *partner, auinit, typ, SynastrieCalc::SYN_ASPEKTE));
+    } else {
+        radix.synastrieErgebnis.reset();
+    }
+
+    m_valid |= STAGE_ASPEKTE;
+    m_lastStages |= STAGE_ASPEKTE;
+}
+
+int ChartPipeline::run(Radix& radix, const AuInit& auinit, int typ, Radix* partner) {
+    int result = calculate(radix, typ);
+    if (result != ERR_OK) {
+        return result;
+    }
+    const int chartStages = m_lastStages;
+    calcAspects(radix, auinit, typ, partner);
+    m_lastStages |= chartStages;
+    return ERR_OK;
+}
+
+const QString& ChartPipeline::text(const Radix& radix, const AuInit& auinit) {
+    m_lastStages = 0;
+
+    // Sprache, Orben und bearbeitete Texte stecken im Cache-Schlüssel
+    const AnalysisKey key = AnalysisCache::makeKey(radix, auinit);
+    if (key != m_textKey) {
+        invalidate(STAGE_TEXT);
+    }
+
+    if (!(m_valid & STAGE_TEXT)) {
+        m_text = analysisCache().analyzeRadix(radix, auinit);
+        m_textKey = key;
+        m_valid |= STAGE_TEXT;
+        m_lastStages |= STAGE_TEXT;
+    }
+
+    return m_text;
+}
+
+void ChartPipeline::adopt(const Radix& radix, const AuInit& auinit, int typ,
+                          const Radix* partner) {
+    m_chart = chartInput(radix, typ);
+    m_aspect = aspectInput(auinit, typ, partner);
+    m_valid = STAGE_ALLE & ~STAGE_TEXT;
+    m_lastStages = 0;
+}
+
+//==============================================================================
+// Hilfsfunktionen
+//==============================================================================
+
+void ChartPipeline::assignHouses(Radix& radix) {
+    for (int i = 0; i < radix.anzahlPlanet; ++i) {
+        radix.inHaus[i] = ChartCalc::getHouseOfPlanet(radix.planet[i], radix.haus);
+    }
+}
+
+QString ChartPipeline::stageNames(int stages) {
+    static const struct { int stage; const char* name; } namen[] = {
+        { STAGE_JD,          "JD" },
+        { STAGE_VARIABLEN,   "Variablen" },
+        { STAGE_HAEUSER,     "Häuser" },
+        { STAGE_PLANETEN,    "Planeten" },
+        { STAGE_ASPEKTE,     "Aspekte" },
+        { STAGE_QUALITAETEN, "Qualitäten" },
+        { STAGE_TEXT,        "Text" },
+    };
+
+    QStringList list;
+    for (const auto& n : namen) {
+        if (stages & n.stage) {
+            list << QString::fromUtf8(n.name);
+        }
+    }
+    return list.isEmpty() ? QStringLiteral("-") : list.join(", ");
+}
+
+} // namespace astro
@@ -0,0 +1,184 @@
+#pragma once
+/**
+ * @file chart_pipeline.h
+ * @brief Inkrementelle Horoskop-Berechnung mit Stufen-Abhängigkeiten
+ *
+ * Zerlegt ChartCalc::calculate und die nachgelagerten Aspekt-Aufrufe in
+ * Stufen (JD → Variablen → Häuser → Planeten → Aspekte → Qualitäten → Text)
+ * und rechnet bei einer Änderung nur die betroffenen Stufen neu.
+ */
+
+#include "analysis_cache.h"
+#include "data_types.h"
+#include <QString>
+
+namespace astro {
+
+/**
+ * @brief Abhängigkeits-gesteuerte Horoskop-Berechnung
+ *
+ * Die Pipeline merkt sich die Eingaben, mit denen jede Stufe zuletzt
+ * gelaufen ist, und vergleicht sie beim nächsten Aufruf:
+ *
+ *  - JD:          Datum, Zeit, Zone, Sommerzeit
+ *  - Variablen:   JD, geographische Länge/Breite
+ *  - Häuser:      Variablen, Häusersystem
+ *  - Planeten:    JD, Planetenanzahl, Horoskop-Typ (Planet-Typ-Flags)
+ *  - Qualitäten:  Planeten
+ *  - Aspekte:     Planeten, Häuser, Orben, Aspekt-Auswahl, Partner-Radix
+ *  - Text:        Aspekte, Qualitäten, Sprache, alle Orben, Text-Revision
+ *
+ * Ein Wechsel des Häusersystems rechnet also nur Häuser, Aspekte und Text
+ * neu, eine Orben-Änderung nur Aspekte und Text. Datum und Zeit ändern das
+ * JD und damit alle Horoskop-Stufen. Sind alle Horoskop-Stufen
+ * ungültig, kommt das Ergebnis wenn möglich aus chartCache(). Die Pipeline arbeitet auf
+ * dem übergebenen Radix (in/out wie ChartCalc) - ein Radix, der außerhalb
+ * der Pipeline verändert wurde, muss mit invalidate() markiert werden.
+ */
+class ChartPipeline {
+public:
+    /**
+     * @brief Berechnungs-Stufen (Bitmaske)
+     */
+    enum Stage {
+        STAGE_JD          = 0x0001,
+        STAGE_VARIABLEN   = 0x0002,
+        STAGE_HAEUSER     = 0x0004,
+        STAGE_PLANETEN    = 0x0008,
+        STAGE_ASPEKTE     = 0x0010,
+        STAGE_QUALITAETEN = 0x0020,
+        STAGE_TEXT        = 0x0040,
+
+        STAGE_CHART       = STAGE_JD | STAGE_VARIABLEN | STAGE_HAEUSER |
+                            STAGE_PLANETEN | STAGE_QUALITAETEN,
+        STAGE_ALLE        = STAGE_CHART | STAGE_ASPEKTE | STAGE_TEXT
+    };
+
+    ChartPipeline();
+
+    //==========================================================================
+    // Berechnung
+    //==========================================================================
+
+    /**
+     * @brief Berechnet die Horoskop-Stufen (wie ChartCalc::calculate)
+     * @param radix [in/out] Radix mit Eingabe (Datum, Zeit, Ort) und Ausgabe
+     * @param typ Horoskop-Typ für die Planet-Typ-Flags
+     * @return ERR_OK bei Erfolg, Fehlercode sonst
+     *
+     * Stufen: JD, Variablen, Häuser, Planeten, Qualitäten
+     */
+    int calculate(Radix& radix, int typ = TYP_RADIX);
+
+    /**
+     * @brief Berechnet die Aspekt-Stufe
+     * @param radix [in/out] Berechneter Radix
+     * @param auinit Einstellungen (Orben, Aspekt-Auswahl)
+     * @param typ Horoskop-Typ - wählt die Orben (Radix/Synastrie/Transit)
+     * @param partner Optional: Synastrie-/Transit-Radix für die Winkel
+     *
+     * Entspricht der Folge calcAspects → calcAngles → calcHouseAspects.
+     * Mit Partner (Synastrie/Transit) zusätzlich SynastrieCalc, Ergebnis
+     * in radix.synastrieErgebnis.
+     */
+    void calcAspects(Radix& radix, const AuInit& auinit, int typ = TYP_RADIX,
+                     Radix* partner = nullptr);
+
+    /**
+     * @brief Berechnet Horoskop und Aspekte in einem Aufruf
+     * @return ERR_OK bei Erfolg, Fehlercode sonst
+     */
+    int run(Radix& radix, const AuInit& auinit, int typ = TYP_RADIX,
+            Radix* partner = nullptr);
+
+    /**
+     * @brief Liefert die Textanalyse (Text-Stufe, bei Bedarf berechnet)
+     * @param radix Berechneter Radix
+     * @param auinit Einstellungen (Orben)
+     * @return HTML der Radix-Textanalyse
+     *
+     * Fertige Analysen kommen aus analysisCache() - auch solche, die ein
+     * Worker-Thread vorab berechnet hat.
+     */
+    const QString& text(const Radix& radix, const AuInit& auinit);
+
+    /**
+     * @brief Übernimmt einen außerhalb berechneten Radix als gültig
+     * @param radix Vollständig berechneter Radix (inkl. Aspekte)
+     * @param auinit Einstellungen, mit denen gerechnet wurde
+     * @param typ Horoskop-Typ
+     * @param partner Optional: Synastrie-/Transit-Radix
+     *
+     * Danach rechnet die Pipeline nur noch, was sich gegenüber diesem
+     * Stand ändert. Die Text-Stufe bleibt ungültig.
+     */
+    void adopt(const Radix& radix, const AuInit& auinit, int typ = TYP_RADIX,
+               const Radix* partner = nullptr);
+
+    /**
+     * @brief Markiert Stufen (und alle abhängigen) als ungültig
+     */
+    void invalidate(int stages = STAGE_ALLE);
+
+    //==========================================================================
+    // Diagnose
+    //==========================================================================
+
+    /**
+     * @brief Stufen, die beim letzten Aufruf tatsächlich gelaufen sind
+     */
+    int lastStages() const { return m_lastStages; }
+
+    /**
+     * @brief Aktuell gültige Stufen
+     */
+    int validStages() const { return m_valid; }
+
+    /**
+     * @brief Lesbare Liste der Stufen (z.B. "Häuser, Aspekte")
+     */
+    static QString stageNames(int stages);
+
+    /**
+     * @brief Prüfsumme über alle Orben-Tabellen und die Aspekt-Auswahl
+     */
+    static size_t orbenHash(const AuInit& auinit);
+
+private:
+    // Eingaben, mit denen die Stufen zuletzt gelaufen sind
+    struct ChartInput {
+        int16_t tag = 0;
+        int16_t monat = 0;
+        int16_t jahr = 0;
+        double  zeit = 0.0;
+        float   zone = 0.0f;
+        double  sommerzeit = 0.0;
+        double  laenge = 0.0;
+        double  breite = 0.0;
+        int8_t  hausSys = 0;
+        int16_t anzahlPlanet = 0;
+        int     typ = TYP_RADIX;
+    };
+
+    struct AspectInput {
+        int     typ = TYP_RADIX;
+        size_t  orben = 0;
+        QVector<double> partnerPlanet;
+    };
+
+    ChartInput  m_chart;
+    AspectInput m_aspect;
+    AnalysisKey m_textKey;
+    QString     m_text;
+
+    int m_valid;
+    int m_lastStages;
+
+    static ChartInput chartInput(const Radix& radix, int typ);
+    static AspectInput aspectInput(const AuInit& auinit, int typ, const Radix* partner);
+    static int dependents(int stages);
+
+    void assignHouses(Radix& radix);
+};
+
+} // namespace astro
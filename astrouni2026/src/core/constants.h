@@ -203,6 +203,9 @@ inline constexpr int S_HAUS  = 0x4000;
 inline constexpr int S_3er   = 0x1;
 inline constexpr int S_9er   = 0x2;
 
+// Programm-Optionen (AuInit::sOptionen, neu)
+inline constexpr int S_CACHE_DATEI = 0x1;   // Chart-Cache zwischen Sitzungen sichern
+
 //==============================================================================
 // Inkrement-Typen (aus astrouni.h Zeile 279-284)
 //==============================================================================
@@ -294,6 +297,8 @@ inline constexpr const char* RADDAT = "astrorad.dat";
 inline constexpr const char* NOTDAT = "astronot.dat";
 inline constexpr const char* ORBDAT = "default.dat";
 inline constexpr const char* INIDAT = "astroini.dat";
+inline constexpr const char* SETDAT = "astroset.dat";  // Einstellungen (neu, ersetzt INIDAT)
+inline constexpr const char* CACHEDAT = "astrocache.dat";  // Chart-Cache (neu)
 
 // Version
 inline constexpr int16_t MAIN_VERSION = 4;  // v0.04Beta
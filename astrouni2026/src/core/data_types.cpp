@@ -231,6 +231,8 @@ void Radix::clear() {
     rotate = 0;
     stzGrad = 0.0;
     stzIndex = 0;
+
+    synastrieErgebnis.reset();
 }
 
 void Radix::allocate(int16_t numPlanets) {
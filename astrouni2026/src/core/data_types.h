@@ -18,6 +18,8 @@
 
 namespace astro {
 
+struct SynastrieErgebnis;
+
 //==============================================================================
 // LBCOLOR - Listbox-Farben (aus astrouni.h Zeile 589-593)
 //==============================================================================
@@ -173,6 +175,7 @@ struct Radix {
     
     // Synastrie/Transit: Zweiter Radix (STRICT LEGACY: plRadix[0])
     std::shared_ptr<Radix> synastrie;  // Zweiter Radix für Synastrie/Transit
+    std::shared_ptr<const SynastrieErgebnis> synastrieErgebnis;  // Kreuz-Aspekte zu synastrie (synastry.h)
     
     // Konstruktor - initialisiert Arrays
     Radix();
@@ -236,6 +239,7 @@ struct AuInit {
     int16_t  sAspekte = S_KON | S_SEX | S_QUA | S_TRI | S_OPO;  // Aspekt-Auswahl
     int16_t  sTeilung = 0;              // Teilung (3er/9er)
     int16_t  sAnzahlPlanet = 10;        // Anzahl der angezeigten Planeten
+    int16_t  sOptionen = 0;             // Programm-Optionen (S_CACHE_DATEI)
     
     // Anzeige-Optionen
     bool     bShowMinutes = true;       // Minuten anzeigen
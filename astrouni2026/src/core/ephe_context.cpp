@@ -0,0 +1,228 @@
+/**
+ * @file ephe_context.cpp
+ * @brief Implementierung des Ephemeriden-Kontexts
+ */
+
+#include "ephe_context.h"
+#include "instrumentation.h"
+#include "swiss_eph.h"
+#include <QAtomicInteger>
+#include <QMutex>
+
+// Swiss Ephemeris Header
+extern "C" {
+#include "swephexp.h"
+}
+
+namespace astro {
+
+namespace {
+
+QAtomicInteger<quint64> g_nextConfigId { 1 };
+
+// Globale Konfiguration: Zeiger unter Sperre, Generation sperrfrei lesbar
+QMutex g_configMutex;
+EpheConfigPtr g_config;
+QAtomicInteger<quint64> g_generation { 0 };
+
+// Konfiguration, an die Swiss Ephemeris in diesem Thread gebunden ist
+thread_local quint64 t_boundId = 0;
+
+// TLS aus sweodef.h als Text: "__thread" bzw. "__declspec(thread)", leer
+// wenn Swiss Ephemeris ihren Zustand global hält
+#define ASTRO_TEXT(x) #x
+#define ASTRO_MAKRO_TEXT(x) ASTRO_TEXT(x)
+constexpr bool SWE_TLS = sizeof(ASTRO_MAKRO_TEXT(TLS)) > 1;
+#undef ASTRO_MAKRO_TEXT
+#undef ASTRO_TEXT
+
+} // namespace
+
+//==============================================================================
+// Konfiguration
+//==============================================================================
+
+EpheConfigPtr EpheConfig::create(const QString& ephePath) {
+    auto config = std::make_shared<EpheConfig>();
+    config->ephePath = ephePath;
+    config->flags = SEFLG_SPEED | SEFLG_SWIEPH;
+    config->id = g_nextConfigId.fetchAndAddRelaxed(1);
+    return config;
+}
+
+EpheContext::EpheContext(EpheConfigPtr config)
+    : m_config(config ? std::move(config) : EpheConfig::create(QString())) {
+}
+
+void EpheContext::setGlobalConfig(EpheConfigPtr config) {
+    {
+        QMutexLocker locker(&g_configMutex);
+        g_config = std::move(config);
+    }
+    g_generation.fetchAndAddRelease(1);
+}
+
+EpheConfigPtr EpheContext::globalConfig() {
+    QMutexLocker locker(&g_configMutex);
+    if (!g_config) {
+        g_config = EpheConfig::create(QString());
+    }
+    return g_config;
+}
+
+EpheContext EpheContext::current() {
+    thread_local EpheConfigPtr config;
+    thread_local quint64 generation = ~quint64(0);
+
+    const quint64 gen = g_generation.loadAcquire();
+    if (!config || gen != generation) {
+        config = globalConfig();
+        generation = gen;
+    }
+    return EpheContext(config);
+}
+
+bool EpheContext::isThreadSafe() {
+#if defined(_WIN32)
+    // Der C-Teil sieht WIN32 (ohne TLS), C++ ohne Erweiterungen nicht immer
+    return false;
+#else
+    return SWE_TLS;
+#endif
+}
+
+void EpheContext::bindThread() const {
+    if (t_boundId == m_config->id) {
+        return;
+    }
+    QByteArray pathBytes = m_config->ephePath.toLocal8Bit();
+    swe_set_ephe_path(const_cast<char*>(pathBytes.constData()));
+    t_boundId = m_config->id;
+}
+
+//==============================================================================
+// Planeten-Berechnung
+//==============================================================================
+
+int EpheContext::toSwissEphPlanet(int planet) {
+    // Mapping von internen Planet-Indizes zu Swiss Ephemeris
+    switch (planet) {
+        case P_SONNE:   return SE_SUN;
+        case P_MOND:    return SE_MOON;
+        case P_MERKUR:  return SE_MERCURY;
+        case P_VENUS:   return SE_VENUS;
+        case P_MARS:    return SE_MARS;
+        case P_JUPITER: return SE_JUPITER;
+        case P_SATURN:  return SE_SATURN;
+        case P_URANUS:  return SE_URANUS;
+        case P_NEPTUN:  return SE_NEPTUNE;
+        case P_PLUTO:   return SE_PLUTO;
+        case P_NKNOTEN: return SE_TRUE_NODE;
+        case P_LILITH:  return SE_MEAN_APOG;  // Mittlere Lilith
+        case P_CHIRON:  return SE_CHIRON;
+        case P_CERES:   return SE_CERES;
+        case P_PALLAS:  return SE_PALLAS;
+        case P_JUNO:    return SE_JUNO;
+        case P_VESTA:   return SE_VESTA;
+        default:        return -1;
+    }
+}
+
+PlanetPos EpheContext::calcPlanet(int planet, double jd) const {
+    ASTRO_TIMER("EpheContext::calcPlanet");
+    PlanetPos pos;
+
+    int sePlanet = toSwissEphPlanet(planet);
+    if (sePlanet < 0) {
+        pos.status = { ERR_EPHEM, QString("Unbekannter Planet: %1").arg(planet) };
+        return pos;
+    }
+
+    bindThread();
+
+    double xx[6];
+    char serr[AS_MAXCH] = {0};
+    int32_t iret = swe_calc_ut(jd, sePlanet, m_config->flags, xx, serr);
+
+    if (iret < 0) {
+        pos.status = { ERR_EPHEM, QString::fromLatin1(serr) };
+        return pos;
+    }
+
+    pos.longitude = xx[0];
+    pos.latitude = xx[1];
+    pos.distance = xx[2];
+    pos.speed = xx[3];
+    return pos;
+}
+
+double EpheContext::calcPlanetLongitude(int planet, double jd) const {
+    const PlanetPos pos = calcPlanet(planet, jd);
+    return pos.ok() ? pos.longitude : -1.0;
+}
+
+bool EpheContext::isRetrograde(int planet, double jd) const {
+    const PlanetPos pos = calcPlanet(planet, jd);
+    return pos.ok() && pos.speed < 0.0;
+}
+
+//==============================================================================
+// Häuser-Berechnung
+//==============================================================================
+
+EpheStatus EpheContext::calcHouses(double jd, double lat, double lon, int hsys,
+                                   double* cusps, double* ascmc) const {
+    ASTRO_TIMER("EpheContext::calcHouses");
+    bindThread();
+
+    char hsysChar = SwissEph::houseSysToChar(hsys);
+    int iret = swe_houses_ex(jd, SEFLG_SWIEPH, lat, lon, hsysChar, cusps, ascmc);
+
+    if (iret < 0) {
+        return { ERR_HOUSE, QString("Fehler bei Häuserberechnung (%1, Breite %2)")
+                                .arg(QLatin1Char(hsysChar)).arg(lat) };
+    }
+    return {};
+}
+
+//==============================================================================
+// Zeit und Ekliptik
+//==============================================================================
+
+double EpheContext::calcSiderealTime(double jd, double longitude) const {
+    bindThread();
+    double armc = swe_sidtime(jd);  // ARMC in Stunden
+
+    // Lokale siderische Zeit = ARMC + Länge/15
+    double lst = armc + longitude / 15.0;
+
+    // Normalisieren auf 0-24 Stunden
+    while (lst >= 24.0) lst -= 24.0;
+    while (lst < 0.0) lst += 24.0;
+
+    // Konvertieren in Grad (0-360)
+    return lst * 15.0;
+}
+
+double EpheContext::calcObliquity(double jd) const {
+    bindThread();
+    double xx[6];
+    char serr[AS_MAXCH] = {0};
+
+    // Berechne Nutation und Obliquität
+    int32_t iret = swe_calc_ut(jd, SE_ECL_NUT, 0, xx, serr);
+
+    if (iret < 0) {
+        // Fallback: Standardwert
+        return AXE;
+    }
+
+    return xx[0];  // Wahre Obliquität
+}
+
+double EpheContext::calcDeltaT(double jd) const {
+    bindThread();
+    return swe_deltat(jd);
+}
+
+} // namespace astro
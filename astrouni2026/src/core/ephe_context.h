@@ -0,0 +1,159 @@
+#pragma once
+/**
+ * @file ephe_context.h
+ * @brief Ephemeriden-Kontext für (parallele) Berechnungen
+ *
+ * Swiss Ephemeris hält ihren Zustand je Thread (TLS). Ein EpheContext
+ * verbindet eine unveränderliche Konfiguration (Pfad, Flags) mit dem
+ * aufrufenden Thread und liefert Ergebnisse samt Fehler als Rückgabewert -
+ * es gibt keinen gemeinsamen veränderlichen Zustand. ChartCalc und
+ * TransitCalc nehmen den Kontext als Parameter; Worker-Threads übergeben
+ * ihn ausdrücklich, alle anderen Aufrufer erhalten EpheContext::current().
+ */
+
+#include <QString>
+#include <memory>
+#include "constants.h"
+
+namespace astro {
+
+/**
+ * @brief Unveränderliche Ephemeriden-Konfiguration (zwischen Threads geteilt)
+ */
+struct EpheConfig {
+    QString ephePath;
+    int32_t flags = 0;      // SEFLG_* für Planeten
+    quint64 id = 0;         // Eindeutig je erzeugter Konfiguration
+
+    /**
+     * @brief Erzeugt eine neue Konfiguration
+     * @param ephePath Verzeichnis mit den .se1 Dateien
+     */
+    static std::shared_ptr<const EpheConfig> create(const QString& ephePath);
+};
+
+using EpheConfigPtr = std::shared_ptr<const EpheConfig>;
+
+/**
+ * @brief Ergebnis-Status einer Ephemeriden-Berechnung
+ */
+struct EpheStatus {
+    int     result = ERR_OK;    // ERR_OK, ERR_EPHEM, ERR_HOUSE
+    QString error;
+
+    bool ok() const { return result == ERR_OK; }
+};
+
+/**
+ * @brief Position eines Planeten
+ */
+struct PlanetPos {
+    double longitude = 0.0;     // Ekliptikale Länge in Grad
+    double latitude = 0.0;      // Ekliptikale Breite in Grad
+    double distance = 0.0;      // Entfernung in AU
+    double speed = 0.0;         // Geschwindigkeit in Grad/Tag
+    EpheStatus status;
+
+    bool ok() const { return status.ok(); }
+};
+
+/**
+ * @brief Zugriff auf Swiss Ephemeris für den aufrufenden Thread
+ *
+ * Ein Kontext ist ein leichtes Handle auf eine EpheConfig. Die Swiss-
+ * Ephemeris-Bindung (Pfad) wird je Thread beim ersten Aufruf hergestellt
+ * und nur bei einer anderen Konfiguration erneuert.
+ */
+class EpheContext {
+public:
+    explicit EpheContext(EpheConfigPtr config);
+
+    /**
+     * @brief Kontext mit der globalen Konfiguration (SwissEph::setEphePath)
+     *
+     * Der Pfad auf dem Hot-Path ist sperrfrei: die Konfiguration wird je
+     * Thread zwischengespeichert und nur nach einer Änderung neu gelesen.
+     */
+    static EpheContext current();
+
+    /**
+     * @brief Setzt die globale Konfiguration
+     */
+    static void setGlobalConfig(EpheConfigPtr config);
+
+    /**
+     * @brief Aktuelle globale Konfiguration
+     */
+    static EpheConfigPtr globalConfig();
+
+    /**
+     * @brief Darf aus mehreren Threads gleichzeitig gerechnet werden?
+     *
+     * Nur wenn Swiss Ephemeris mit Thread-lokalem Zustand gebaut ist
+     * (siehe TLS in sweodef.h - nicht unter Windows und macOS).
+     */
+    static bool isThreadSafe();
+
+    const EpheConfig& config() const { return *m_config; }
+
+    /**
+     * @brief Bindet den aufrufenden Thread an die Konfiguration
+     *
+     * Wird von allen Berechnungen implizit aufgerufen.
+     */
+    void bindThread() const;
+
+    //==========================================================================
+    // Berechnungen
+    //==========================================================================
+
+    /**
+     * @brief Berechnet die Position eines Planeten
+     * @param planet Planet-Index (P_SONNE bis P_VESTA)
+     * @param jd Julianisches Datum (UT)
+     */
+    PlanetPos calcPlanet(int planet, double jd) const;
+
+    /**
+     * @brief Ekliptikale Länge eines Planeten, -1 bei Fehler
+     */
+    double calcPlanetLongitude(int planet, double jd) const;
+
+    /**
+     * @brief Ist der Planet rückläufig? (false bei Fehler)
+     */
+    bool isRetrograde(int planet, double jd) const;
+
+    /**
+     * @brief Berechnet die Häuserspitzen
+     * @param cusps [out] 13 Häuserspitzen (Index 1-12)
+     * @param ascmc [out] ASC, MC, ARMC, Vertex, ... (10 Werte)
+     */
+    EpheStatus calcHouses(double jd, double lat, double lon, int hsys,
+                          double* cusps, double* ascmc) const;
+
+    /**
+     * @brief Lokale siderische Zeit in Grad
+     */
+    double calcSiderealTime(double jd, double longitude) const;
+
+    /**
+     * @brief Wahre Schiefe der Ekliptik in Grad
+     */
+    double calcObliquity(double jd) const;
+
+    /**
+     * @brief Delta T (TT - UT) in Tagen
+     */
+    double calcDeltaT(double jd) const;
+
+    /**
+     * @brief Interner Planet-Index zu Swiss-Ephemeris-ID (-1 wenn unbekannt)
+     */
+    static int toSwissEphPlanet(int planet);
+
+private:
+    EpheConfigPtr m_config;
+};
+
+} // namespace astro
@@ -0,0 +1,220 @@
+/**
+ * @file ephe_memory.cpp
+ * @brief Implementierung der speicher-residenten Ephemeriden
+ */
+
+#include "ephe_memory.h"
+#include <QByteArray>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QMutex>
+#include <QResource>
+#include <QSaveFile>
+#include <atomic>
+#include <cstdio>
+#include <memory>
+
+// Hook in sweph.c (swi_fopen)
+extern "C" {
+extern FILE* (*swi_fopen_hook)(const char* fname, const char* ephepath);
+}
+
+namespace astro {
+
+namespace {
+
+struct Datei {
+    std::unique_ptr<QFile> file;    // offen halten, solange eingeblendet
+    QByteArray kopie;               // Preload bzw. komprimierte Ressource
+    const uchar* data = nullptr;
+    qint64 size = 0;
+};
+
+QMutex g_mutex;
+// Dateien aus Verzeichnissen nach absolutem Pfad: nach einem Wechsel des
+// Ephemeriden-Pfads liefert der Hook nur noch Dateien des neuen Pfads
+QHash<QString, std::shared_ptr<Datei>> g_dateien;
+// Eingebettete Dateien nach Dateiname - sie gehören zum Programm und
+// gelten für jeden Pfad
+QHash<QString, std::shared_ptr<Datei>> g_eingebettet;
+std::atomic<int> g_treffer{ 0 };
+
+QString absoluterPfad(const QString& dir, const QString& name) {
+    return QDir::cleanPath(QDir(dir).absoluteFilePath(name));
+}
+
+FILE* astroEpheOpen(const char* fname, const char* ephepath) {
+#if defined(_WIN32)
+    Q_UNUSED(fname);
+    Q_UNUSED(ephepath);
+    return nullptr;
+#else
+    const QString name = QString::fromLocal8Bit(fname);
+    std::shared_ptr<Datei> datei;
+    {
+        QMutexLocker locker(&g_mutex);
+        // Dieselbe Suchreihenfolge wie swi_fopen (";" oder ":" trennt)
+        QString pfade = QString::fromLocal8Bit(ephepath);
+        pfade.replace(QLatin1Char(';'), QLatin1Char(':'));
+        for (const QString& dir : pfade.split(QLatin1Char(':'), Qt::SkipEmptyParts)) {
+            datei = g_dateien.value(absoluterPfad(dir, name));
+            if (datei) {
+                break;
+            }
+        }
+        if (!datei) {
+            datei = g_eingebettet.value(name);
+        }
+    }
+    if (!datei) {
+        return nullptr;
+    }
+    g_treffer.fetch_add(1, std::memory_order_relaxed);
+    // Nur lesend geöffnet - der Bereich wird nie beschrieben
+    return fmemopen(const_cast<uchar*>(datei->data), static_cast<size_t>(datei->size), "rb");
+#endif
+}
+
+void registriere(QHash<QString, std::shared_ptr<Datei>>& ziel, const QString& schluessel,
+                 std::shared_ptr<Datei> datei) {
+    QMutexLocker locker(&g_mutex);
+    ziel.insert(schluessel, std::move(datei));
+    swi_fopen_hook = &astroEpheOpen;
+}
+
+} // namespace
+
+bool EpheMemory::isSupported() {
+#if defined(_WIN32)
+    return false;
+#else
+    return true;
+#endif
+}
+
+EpheMemory::Modus EpheMemory::modusAusUmgebung() {
+    const QByteArray wert = qgetenv("ASTRO_EPHE_MEMORY").trimmed().toLower();
+    if (wert == "map") {
+        return Modus::Map;
+    }
+    if (wert == "preload") {
+        return Modus::Preload;
+    }
+    return Modus::Aus;
+}
+
+int EpheMemory::addDirectory(const QString& dir, Modus modus) {
+    if (!isSupported() || modus == Modus::Aus) {
+        return 0;
+    }
+
+    int anzahl = 0;
+    const QStringList namen = QDir(dir).entryList({ "*.se1", "*.SE1" }, QDir::Files);
+    for (const QString& name : namen) {
+        auto datei = std::make_shared<Datei>();
+        datei->file = std::make_unique<QFile>(QDir(dir).filePath(name));
+        if (!datei->file->open(QIODevice::ReadOnly)) {
+            continue;
+        }
+        datei->size = datei->file->size();
+
+        if (modus == Modus::Map) {
+            datei->data = datei->file->map(0, datei->size);
+        }
+        if (!datei->data) {
+            // Preload - oder Einblenden nicht möglich
+            datei->kopie = datei->file->readAll();
+            datei->file.reset();
+            if (datei->kopie.size() != datei->size) {
+                continue;
+            }
+            datei->data = reinterpret_cast<const uchar*>(datei->kopie.constData());
+        }
+
+        registriere(g_dateien, absoluterPfad(dir, name), std::move(datei));
+        ++anzahl;
+    }
+    return anzahl;
+}
+
+int EpheMemory::addResources(const QString& prefix) {
+    if (!isSupported()) {
+        return 0;
+    }
+
+    int anzahl = 0;
+    QDirIterator it(prefix, { "*.se1", "*.SE1" }, QDir::Files);
+    while (it.hasNext()) {
+        const QString pfad = it.next();
+        QResource resource(pfad);
+        if (!resource.isValid()) {
+            continue;
+        }
+
+        auto datei = std::make_shared<Datei>();
+        if (resource.compressionAlgorithm() == QResource::NoCompression) {
+            datei->data = resource.data();
+            datei->size = resource.size();
+        } else {
+            datei->kopie = resource.uncompressedData();
+            datei->data = reinterpret_cast<const uchar*>(datei->kopie.constData());
+            datei->size = datei->kopie.size();
+        }
+
+        registriere(g_eingebettet, it.fileName(), std::move(datei));
+        ++anzahl;
+    }
+    return anzahl;
+}
+
+QString EpheMemory::extractResources(const QString& prefix, const QString& targetDir) {
+    if (!QDir().mkpath(targetDir)) {
+        return QString();
+    }
+
+    QDirIterator it(prefix, { "*.se1", "*.SE1" }, QDir::Files);
+    while (it.hasNext()) {
+        const QString pfad = it.next();
+        const QString ziel = QDir(targetDir).filePath(it.fileName());
+
+        QFile quelle(pfad);
+        if (QFileInfo(ziel).size() == quelle.size()) {
+            continue;
+        }
+        if (!quelle.open(QIODevice::ReadOnly)) {
+            return QString();
+        }
+        QSaveFile out(ziel);
+        if (!out.open(QIODevice::WriteOnly) || out.write(quelle.readAll()) != quelle.size()
+            || !out.commit()) {
+            return QString();
+        }
+    }
+    return targetDir;
+}
+
+int EpheMemory::fileCount() {
+    QMutexLocker locker(&g_mutex);
+    return g_dateien.size() + g_eingebettet.size();
+}
+
+qint64 EpheMemory::totalBytes() {
+    QMutexLocker locker(&g_mutex);
+    qint64 summe = 0;
+    for (const auto& datei : g_dateien) {
+        summe += datei->size;
+    }
+    for (const auto& datei : g_eingebettet) {
+        summe += datei->size;
+    }
+    return summe;
+}
+
+int EpheMemory::hookHits() {
+    return g_treffer.load(std::memory_order_relaxed);
+}
+
+} // namespace astro
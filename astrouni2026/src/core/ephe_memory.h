@@ -0,0 +1,93 @@
+#pragma once
+/**
+ * @file ephe_memory.h
+ * @brief Ephemeriden-Dateien (.se1) aus dem Speicher statt von der Platte
+ *
+ * Swiss Ephemeris liest die .se1 Dateien über stdio (fseek/fread) und
+ * öffnet sie je Thread neu. Sind die Dateien hier registriert, bekommt
+ * sweph.c beim Öffnen einen FILE* auf den Speicherbereich (fmemopen):
+ * keine Plattenzugriffe nach dem Start, keine geteilten Datei-Handles
+ * zwischen Threads.
+ *
+ * Registrieren nur beim Start, vor der ersten Berechnung - die Bereiche
+ * bleiben bis Programmende gültig. Dateien aus einem Verzeichnis gelten
+ * nur, solange es im Ephemeriden-Pfad steht; eingebettete immer.
+ *
+ * Standardmäßig aus: die Dateien liegen nach dem ersten Lesen ohnehin im
+ * Seiten-Cache des Betriebssystems, und Map/Preload halten sie zusätzlich
+ * im Adressraum. Einschalten über ASTRO_EPHE_MEMORY, z.B. für Messungen
+ * oder langsame Netzlaufwerke.
+ */
+
+#include <QString>
+
+namespace astro {
+
+/**
+ * @brief Speicher-residente Ephemeriden-Dateien
+ */
+class EpheMemory {
+public:
+    enum class Modus {
+        Aus,        // Dateien normal über den Ephemeriden-Pfad lesen
+        Map,        // Dateien einblenden (Seiten lädt das Betriebssystem)
+        Preload     // Dateien komplett einlesen (kein Plattenzugriff mehr)
+    };
+
+    /**
+     * @brief Steht der Speicher-Zugriff auf dieser Plattform zur Verfügung?
+     *
+     * Braucht fmemopen (Linux, macOS, BSD) - unter Windows nicht.
+     */
+    static bool isSupported();
+
+    /**
+     * @brief Modus aus der Umgebungsvariable ASTRO_EPHE_MEMORY
+     *        ("off", "map", "preload"; Vorgabe: off)
+     */
+    static Modus modusAusUmgebung();
+
+    /**
+     * @brief Registriert alle .se1 Dateien eines Verzeichnisses
+     * @param dir Ephemeriden-Verzeichnis
+     * @param modus Map oder Preload
+     * @return Anzahl registrierter Dateien
+     */
+    static int addDirectory(const QString& dir, Modus modus = Modus::Map);
+
+    /**
+     * @brief Registriert eingebettete Ephemeriden (Qt-Ressourcen)
+     * @param prefix Ressourcen-Verzeichnis, z.B. ":/ephe"
+     * @return Anzahl registrierter Dateien
+     *
+     * Unkomprimierte Ressourcen werden ohne Kopie verwendet.
+     */
+    static int addResources(const QString& prefix);
+
+    /**
+     * @brief Kopiert eingebettete Ephemeriden in ein Verzeichnis
+     * @return Ziel-Verzeichnis, leer bei Fehler
+     *
+     * Für Plattformen ohne fmemopen: das Verzeichnis wird dann als
+     * Ephemeriden-Pfad gesetzt. Vorhandene Dateien gleicher Größe
+     * werden nicht erneut geschrieben.
+     */
+    static QString extractResources(const QString& prefix, const QString& targetDir);
+
+    /**
+     * @brief Anzahl registrierter Dateien
+     */
+    static int fileCount();
+
+    /**
+     * @brief Gesamtgröße der registrierten Dateien in Bytes
+     */
+    static qint64 totalBytes();
+
+    /**
+     * @brief Wie oft sweph.c eine Datei aus dem Speicher bekommen hat
+     */
+    static int hookHits();
+};
+
+} // namespace astro
@@ -0,0 +1,286 @@
+/**
+ * @file instrumentation.cpp
+ * @brief Implementierung der Zeitmessung und Zähler
+ */
+
+#include "instrumentation.h"
+#include "constants.h"
+#include <QCoreApplication>
+#include <QHash>
+#include <QMutex>
+#include <QSaveFile>
+#include <QTextStream>
+#include <QThread>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+namespace astro {
+
+namespace {
+
+constexpr int MAX_TRACE_EVENTS = 200000;   // je Thread
+constexpr int MAX_MESSPUNKTE = 256;
+
+// Werte eines Messpunkts in einem Thread - geschrieben nur vom Thread
+// selbst, atomar nur damit snapshot() aus einem anderen Thread lesen darf
+struct Wert {
+    std::atomic<qint64> count { 0 };
+    std::atomic<qint64> totalNs { 0 };
+    std::atomic<qint64> maxNs { 0 };
+};
+
+struct TraceEvent {
+    int id;
+    qint64 startNs;
+    qint64 durNs;
+};
+
+struct ThreadDaten {
+    int tid = 0;
+    QString threadName;
+    Wert werte[MAX_MESSPUNKTE];
+    QMutex eventMutex;              // Nur beim Aufzeichnen
+    QVector<TraceEvent> events;
+};
+
+struct Messpunkt {
+    const char* name;
+    bool isTimer;
+};
+
+// Messpunkte: nur beim ersten Durchlauf einer Aufrufstelle erweitert
+QMutex g_registryMutex;
+QHash<QByteArray, int> g_messpunktIndex;
+QVector<Messpunkt> g_messpunkte;
+QVector<std::shared_ptr<ThreadDaten>> g_registry;
+std::atomic<bool> g_tracing { false };
+
+const auto g_epoch = std::chrono::steady_clock::now();
+
+ThreadDaten* neueThreadDaten() {
+    auto daten = std::make_shared<ThreadDaten>();
+    daten->threadName = QThread::currentThread()->objectName();
+    QMutexLocker locker(&g_registryMutex);
+    daten->tid = g_registry.size() + 1;
+    if (daten->threadName.isEmpty()) {
+        const QCoreApplication* app = QCoreApplication::instance();
+        daten->threadName = (app && app->thread() == QThread::currentThread())
+            ? QStringLiteral("Main") : QString("Worker %1").arg(daten->tid);
+    }
+    g_registry.append(daten);
+    return daten.get();     // g_registry hält die Daten über das Thread-Ende hinaus
+}
+
+ThreadDaten& threadDaten() {
+    thread_local ThreadDaten* daten = neueThreadDaten();
+    return *daten;
+}
+
+QVector<std::shared_ptr<ThreadDaten>> registry() {
+    QMutexLocker locker(&g_registryMutex);
+    return g_registry;
+}
+
+QVector<Messpunkt> messpunkte() {
+    QMutexLocker locker(&g_registryMutex);
+    return g_messpunkte;
+}
+
+QString jsonString(const QString& text) {
+    QString out = text;
+    out.replace('\\', "\\\\");
+    out.replace('"', "\\\"");
+    return '"' + out + '"';
+}
+
+} // namespace
+
+//==============================================================================
+// Messen
+//==============================================================================
+
+qint64 Instrumentation::nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - g_epoch).count();
+}
+
+int Instrumentation::messpunkt(const char* name, bool isTimer) {
+    QMutexLocker locker(&g_registryMutex);
+    const QByteArray schluessel(name);
+    auto it = g_messpunktIndex.constFind(schluessel);
+    if (it != g_messpunktIndex.constEnd()) {
+        g_messpunkte[it.value()].isTimer |= isTimer;
+        return it.value();
+    }
+    if (g_messpunkte.size() >= MAX_MESSPUNKTE) {
+        return -1;
+    }
+    const int id = g_messpunkte.size();
+    g_messpunkte.append({ name, isTimer });
+    g_messpunktIndex.insert(schluessel, id);
+    return id;
+}
+
+void Instrumentation::addTime(int id, qint64 startNs, qint64 durNs) {
+    if (id < 0) {
+        return;
+    }
+    ThreadDaten& d = threadDaten();
+    Wert& w = d.werte[id];
+    w.count.fetch_add(1, std::memory_order_relaxed);
+    w.totalNs.fetch_add(durNs, std::memory_order_relaxed);
+    if (durNs > w.maxNs.load(std::memory_order_relaxed)) {
+        w.maxNs.store(durNs, std::memory_order_relaxed);
+    }
+
+    if (g_tracing.load(std::memory_order_relaxed)) {
+        QMutexLocker locker(&d.eventMutex);
+        if (d.events.size() < MAX_TRACE_EVENTS) {
+            d.events.append({ id, startNs, durNs });
+        }
+    }
+}
+
+void Instrumentation::count(int id, qint64 n) {
+    if (id < 0) {
+        return;
+    }
+    threadDaten().werte[id].count.fetch_add(n, std::memory_order_relaxed);
+}
+
+//==============================================================================
+// Auslesen
+//==============================================================================
+
+QVector<InstrStat> Instrumentation::snapshot() {
+    const QVector<Messpunkt> punkte = messpunkte();
+    QVector<InstrStat> result(punkte.size());
+    for (int i = 0; i < punkte.size(); ++i) {
+        result[i].name = QString::fromUtf8(punkte[i].name);
+        result[i].isTimer = punkte[i].isTimer;
+    }
+
+    // Felder aller Threads zusammenführen
+    for (const auto& d : registry()) {
+        for (int i = 0; i < punkte.size(); ++i) {
+            const Wert& w = d->werte[i];
+            result[i].count += w.count.load(std::memory_order_relaxed);
+            result[i].totalNs += w.totalNs.load(std::memory_order_relaxed);
+            result[i].maxNs = qMax(result[i].maxNs, w.maxNs.load(std::memory_order_relaxed));
+        }
+    }
+
+    result.erase(std::remove_if(result.begin(), result.end(),
+                                [](const InstrStat& s) { return s.count == 0; }),
+                 result.end());
+    std::sort(result.begin(), result.end(), [](const InstrStat& a, const InstrStat& b) {
+        if (a.totalNs != b.totalNs) {
+            return a.totalNs > b.totalNs;
+        }
+        return a.name < b.name;
+    });
+    return result;
+}
+
+void Instrumentation::reset() {
+    // Ein gleichzeitig laufender Messpunkt kann einzelne Werte überleben
+    for (const auto& d : registry()) {
+        for (Wert& w : d->werte) {
+            w.count.store(0, std::memory_order_relaxed);
+            w.totalNs.store(0, std::memory_order_relaxed);
+            w.maxNs.store(0, std::memory_order_relaxed);
+        }
+        QMutexLocker locker(&d->eventMutex);
+        d->events.clear();
+    }
+}
+
+QString Instrumentation::report() {
+    QString text;
+    QTextStream out(&text);
+
+    out << qSetFieldWidth(44) << Qt::left << "Messpunkt"
+        << qSetFieldWidth(12) << Qt::right << "Anzahl" << "Gesamt ms" << "Mittel us" << "Max us"
+        << qSetFieldWidth(0) << "\n";
+
+    for (const InstrStat& s : snapshot()) {
+        out << qSetFieldWidth(44) << Qt::left << s.name
+            << qSetFieldWidth(12) << Qt::right << s.count;
+        if (s.isTimer) {
+            out << QString::number(s.totalNs / 1e6, 'f', 2)
+                << QString::number(s.count > 0 ? s.totalNs / 1e3 / s.count : 0.0, 'f', 2)
+                << QString::number(s.maxNs / 1e3, 'f', 1);
+        }
+        out << qSetFieldWidth(0) << "\n";
+    }
+
+    out.flush();
+    return text;
+}
+
+//==============================================================================
+// Chrome-Trace
+//==============================================================================
+
+void Instrumentation::setTracing(bool on) {
+    g_tracing.store(on);
+}
+
+bool Instrumentation::isTracing() {
+    return g_tracing.load();
+}
+
+qint64 Instrumentation::traceEventCount() {
+    qint64 anzahl = 0;
+    for (const auto& d : registry()) {
+        QMutexLocker locker(&d->eventMutex);
+        anzahl += d->events.size();
+    }
+    return anzahl;
+}
+
+int Instrumentation::writeChromeTrace(const QString& filepath) {
+    QSaveFile file(filepath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        return ERR_FILE;
+    }
+
+    QTextStream out(&file);
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    bool erstes = true;
+    auto trenner = [&]() {
+        out << (erstes ? "\n" : ",\n");
+        erstes = false;
+    };
+
+    const QVector<Messpunkt> punkte = messpunkte();
+    for (const auto& d : registry()) {
+        QMutexLocker locker(&d->eventMutex);
+
+        trenner();
+        out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << d->tid
+            << ",\"args\":{\"name\":" << jsonString(d->threadName) << "}}";
+
+        // Zeiten in Mikrosekunden (Chrome-Trace-Einheit)
+        for (const TraceEvent& e : d->events) {
+            trenner();
+            out << "{\"name\":" << jsonString(QString::fromUtf8(punkte[e.id].name))
+                << ",\"cat\":\"astro\",\"ph\":\"X\",\"pid\":1,\"tid\":" << d->tid
+                << ",\"ts\":" << QString::number(e.startNs / 1e3, 'f', 3)
+                << ",\"dur\":" << QString::number(e.durNs / 1e3, 'f', 3) << "}";
+        }
+    }
+
+    out << "\n]}\n";
+    out.flush();
+
+    if (out.status() != QTextStream::Ok || !file.commit()) {
+        return ERR_FILE;
+    }
+    return ERR_OK;
+}
+
+} // namespace astro
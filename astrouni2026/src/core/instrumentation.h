@@ -0,0 +1,156 @@
+#pragma once
+/**
+ * @file instrumentation.h
+ * @brief Leichtgewichtige Zeitmessung und Zähler für die Hot-Paths
+ *
+ * Messpunkte werden mit ASTRO_TIMER("Name") (misst bis Ende des Scopes)
+ * und ASTRO_COUNT("Name", n) gesetzt. Jeder Messpunkt bekommt beim ersten
+ * Durchlauf einen festen Index; jeder Thread zählt in einem eigenen Feld
+ * über diese Indizes (ohne Sperre und ohne Hash-Suche), zusammengeführt
+ * wird erst beim Auslesen. Einkompiliert nur mit
+ * -DASTRO_INSTRUMENTATION=ON (CMake), sonst sind alle Messpunkte Leer-
+ * anweisungen.
+ *
+ * Namen müssen String-Literale sein (werden nicht kopiert).
+ */
+
+#include <QString>
+#include <QVector>
+
+#ifndef ASTRO_INSTRUMENTATION
+#define ASTRO_INSTRUMENTATION 0
+#endif
+
+namespace astro {
+
+/**
+ * @brief Zusammengeführte Werte eines Messpunkts
+ */
+struct InstrStat {
+    QString name;
+    qint64  count = 0;      // Aufrufe (Timer) bzw. Summe (Zähler)
+    qint64  totalNs = 0;    // Gesamtzeit (nur Timer)
+    qint64  maxNs = 0;      // Längster Einzelaufruf (nur Timer)
+    bool    isTimer = false;
+};
+
+/**
+ * @brief Sammelstelle aller Messpunkte
+ */
+class Instrumentation {
+public:
+    /**
+     * @brief Ist die Messung einkompiliert?
+     */
+    static constexpr bool enabled() { return ASTRO_INSTRUMENTATION != 0; }
+
+    /**
+     * @brief Index eines Messpunkts (einmal je Aufrufstelle)
+     * @param name Messpunkt (String-Literal)
+     * @param isTimer true für ASTRO_TIMER, false für ASTRO_COUNT
+     * @return Index, gleiche Namen teilen sich einen; -1 wenn alle
+     *         256 Plätze vergeben sind (wird dann nicht gezählt)
+     */
+    static int messpunkt(const char* name, bool isTimer = false);
+
+    /**
+     * @brief Verbucht eine gemessene Zeit (vom ScopedTimer aufgerufen)
+     * @param id Index aus messpunkt()
+     * @param startNs Start seit Programmstart
+     * @param durNs Dauer
+     */
+    static void addTime(int id, qint64 startNs, qint64 durNs);
+
+    /**
+     * @brief Erhöht einen Zähler
+     * @param id Index aus messpunkt()
+     */
+    static void count(int id, qint64 n = 1);
+
+    /**
+     * @brief Nanosekunden seit Programmstart (monoton)
+     */
+    static qint64 nowNs();
+
+    /**
+     * @brief Alle Messpunkte über alle Threads, nach Gesamtzeit sortiert
+     */
+    static QVector<InstrStat> snapshot();
+
+    /**
+     * @brief Setzt alle Werte und aufgezeichneten Ereignisse zurück
+     */
+    static void reset();
+
+    /**
+     * @brief Lesbare Tabelle aller Messpunkte (für Log/Dump)
+     */
+    static QString report();
+
+    //==========================================================================
+    // Chrome-Trace
+    //==========================================================================
+
+    /**
+     * @brief Schaltet das Aufzeichnen einzelner Ereignisse ein/aus
+     *
+     * Ohne Aufzeichnung werden nur Summen gebildet. Je Thread werden
+     * höchstens 200000 Ereignisse gehalten.
+     */
+    static void setTracing(bool on);
+    static bool isTracing();
+
+    /**
+     * @brief Anzahl aufgezeichneter Ereignisse über alle Threads
+     */
+    static qint64 traceEventCount();
+
+    /**
+     * @brief Schreibt die Ereignisse im Chrome-Trace-Format (chrome://tracing)
+     * @return ERR_OK bei Erfolg, ERR_FILE sonst
+     */
+    static int writeChromeTrace(const QString& filepath);
+};
+
+/**
+ * @brief Misst die Zeit bis zum Ende des Scopes
+ */
+class ScopedTimer {
+public:
+    explicit ScopedTimer(int id)
+        : m_id(id)
+        , m_start(Instrumentation::nowNs()) {
+    }
+
+    ~ScopedTimer() {
+        Instrumentation::addTime(m_id, m_start, Instrumentation::nowNs() - m_start);
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    int m_id;
+    qint64 m_start;
+};
+
+} // namespace astro
+
+#define ASTRO_INSTR_CONCAT2(a, b) a##b
+#define ASTRO_INSTR_CONCAT(a, b) ASTRO_INSTR_CONCAT2(a, b)
+
+#if ASTRO_INSTRUMENTATION
+#define ASTRO_TIMER(name) \
+    static const int ASTRO_INSTR_CONCAT(astroTimerId_, __LINE__) = \
+        ::astro::Instrumentation::messpunkt(name, true); \
+    ::astro::ScopedTimer ASTRO_INSTR_CONCAT(astroTimer_, __LINE__)( \
+        ASTRO_INSTR_CONCAT(astroTimerId_, __LINE__))
+#define ASTRO_COUNT(name, n) \
+    do { \
+        static const int astroCountId = ::astro::Instrumentation::messpunkt(name); \
+        ::astro::Instrumentation::count(astroCountId, n); \
+    } while (0)
+#else
+#define ASTRO_TIMER(name) do {} while (0)
+#define ASTRO_COUNT(name, n) do {} while (0)
+#endif
@@ -0,0 +1,93 @@
+#pragma once
+/**
+ * @file lru_cache.h
+ * @brief Begrenzte Zuordnung mit Verdrängung des am längsten nicht benutzten Eintrags
+ *
+ * Gemeinsame Grundlage von ChartCache und AnalysisCache. Suchen, Einfügen
+ * und Verdrängen kosten O(1): die Einträge stehen in einer Liste (vorne =
+ * zuletzt benutzt), der Hash zeigt auf ihre Position. Anders als QCache
+ * lässt sich die Reihenfolge auslesen, ohne sie zu verändern (Sichern,
+ * Speicherstatistik). Nicht thread-sicher - die Caches sperren selbst.
+ */
+
+#include <QHash>
+#include <QtGlobal>
+#include <list>
+#include <utility>
+
+namespace astro {
+
+template<typename Key, typename T>
+class LruCache {
+public:
+    using Eintrag = std::pair<Key, T>;
+    using const_iterator = typename std::list<Eintrag>::const_iterator;
+    using const_reverse_iterator = typename std::list<Eintrag>::const_reverse_iterator;
+
+    explicit LruCache(int maxEntries) : m_maxEntries(qMax(1, maxEntries)) {}
+
+    /**
+     * @brief Sucht einen Eintrag und markiert ihn als zuletzt benutzt
+     * @return Zeiger auf den Wert (gültig bis zur nächsten Änderung) oder nullptr
+     */
+    const T* find(const Key& key) {
+        const auto it = m_index.constFind(key);
+        if (it == m_index.constEnd()) {
+            return nullptr;
+        }
+        m_eintraege.splice(m_eintraege.begin(), m_eintraege, it.value());
+        return &it.value()->second;
+    }
+
+    /**
+     * @brief Legt einen Eintrag ab (ersetzt einen vorhandenen) und
+     *        verdrängt bei Überlauf die ältesten
+     */
+    void insert(const Key& key, T value) {
+        const auto it = m_index.constFind(key);
+        if (it != m_index.constEnd()) {
+            it.value()->second = std::move(value);
+            m_eintraege.splice(m_eintraege.begin(), m_eintraege, it.value());
+        } else {
+            m_eintraege.emplace_front(key, std::move(value));
+            m_index.insert(key, m_eintraege.begin());
+        }
+        trim();
+    }
+
+    void clear() {
+        m_index.clear();
+        m_eintraege.clear();
+    }
+
+    int size() const { return static_cast<int>(m_index.size()); }
+
+    int maxEntries() const { return m_maxEntries; }
+
+    void setMaxEntries(int maxEntries) {
+        m_maxEntries = qMax(1, maxEntries);
+        trim();
+    }
+
+    // Zuletzt benutzte zuerst; ändert die Reihenfolge nicht
+    const_iterator begin() const { return m_eintraege.cbegin(); }
+    const_iterator end() const { return m_eintraege.cend(); }
+
+    // Älteste zuerst
+    const_reverse_iterator rbegin() const { return m_eintraege.crbegin(); }
+    const_reverse_iterator rend() const { return m_eintraege.crend(); }
+
+private:
+    std::list<Eintrag> m_eintraege;     // vorne = zuletzt benutzt
+    QHash<Key, typename std::list<Eintrag>::iterator> m_index;
+    int m_maxEntries;
+
+    void trim() {
+        while (size() > m_maxEntries) {
+            m_index.remove(m_eintraege.back().first);
+            m_eintraege.pop_back();
+        }
+    }
+};
+
+} // namespace astro
@@ -0,0 +1,108 @@
+/**
+ * @file sign_timeline.cpp
+ * @brief Implementierung der Zeichen-Eintritte
+ */
+
+#include "sign_timeline.h"
+#include "instrumentation.h"
+#include <algorithm>
+#include <utility>
+
+namespace astro {
+
+namespace {
+
+// Zeitpunkte der Schnappschüsse weichen um Rundung vom Zeitraum ab
+constexpr double TOLERANZ = 1e-6;
+
+} // namespace
+
+void SignTimeline::clear() {
+    m_eintritte.clear();
+    m_startJD = 0.0;
+    m_endJD = 0.0;
+}
+
+int SignTimeline::build(const Radix& radix, double startJD, double endJD,
+                        bool* abortFlag,
+                        const EpheContext& ctx) {
+    ASTRO_TIMER("SignTimeline::build");
+    clear();
+    const int numPlanets = std::min<int>(radix.anzahlPlanet, MAX_PLANET);
+    QVector<QVector<Eintritt>> eintritte(numPlanets);
+
+    // EV_OFFEN: Zeichen am Anfang als erster Eintritt je Körper
+    int anzahl = 0;
+    const int res = TransitEvents::calculate(
+        radix, startJD, endJD, EV_ZEICHEN | EV_OFFEN,
+        [&](const TransitEvent& ev) {
+            eintritte[ev.planet].append({ ev.jd, ev.ziel });
+            ++anzahl;
+        },
+        {}, {}, abortFlag, ctx);
+    if (res < 0 || (abortFlag && *abortFlag)) {
+        return res < 0 ? res : 0;
+    }
+
+    m_eintritte = std::move(eintritte);
+    m_startJD = startJD;
+    m_endJD = endJD;
+    return anzahl - numPlanets;
+}
+
+bool SignTimeline::abgedeckt(int planet, double vonJD, double bisJD) const {
+    return planet >= 0 && planet < m_eintritte.size() && !m_eintritte[planet].isEmpty()
+        && vonJD >= m_startJD - TOLERANZ && bisJD <= m_endJD + TOLERANZ;
+}
+
+int8_t SignTimeline::zeichen(int planet, double jd) const {
+    if (!abgedeckt(planet, jd, jd)) {
+        return -1;
+    }
+    const QVector<Eintritt>& e = m_eintritte[planet];
+    // Letzter Eintritt bis jd (der erste liegt auf startJD)
+    auto it = std::upper_bound(e.cbegin(), e.cend(), jd, [](double t, const Eintritt& x) {
+        return t < x.jd;
+    });
+    return it == e.cbegin() ? e.first().zeichen : (it - 1)->zeichen;
+}
+
+bool SignTimeline::zeichen(int planet, double vonJD, double bisJD, QVector<int8_t>& folge) const {
+    folge.clear();
+    if (!abgedeckt(planet, vonJD, bisJD)) {
+        return false;
+    }
+    const QVector<Eintritt>& e = m_eintritte[planet];
+    auto it = std::upper_bound(e.cbegin(), e.cend(), vonJD, [](double t, const Eintritt& x) {
+        return t < x.jd;
+    });
+    folge.append(it == e.cbegin() ? e.first().zeichen : (it - 1)->zeichen);
+    for (; it != e.cend() && it->jd <= bisJD; ++it) {
+        if (it->zeichen != folge.last()) {
+            folge.append(it->zeichen);
+        }
+    }
+    return true;
+}
+
+bool SignTimeline::deckt(double vonJD, double bisJD) const {
+    return !m_eintritte.isEmpty() && vonJD >= m_startJD - TOLERANZ && bisJD <= m_endJD + TOLERANZ;
+}
+
+QVector<int8_t> SignTimeline::folge(int planet, const Radix& von, const Radix& bis) const {
+    QVector<int8_t> folge;
+    if (zeichen(planet, von.jd, bis.jd, folge)) {
+        return folge;
+    }
+    for (const Radix* r : { &von, &bis }) {
+        if (planet >= 0 && planet < r->anzahlPlanet && planet < r->stzPlanet.size()) {
+            const int8_t stz = r->stzPlanet[planet];
+            if (stz >= 0 && stz < 12 && (folge.isEmpty() || folge.last() != stz)) {
+                folge.append(stz);
+            }
+        }
+    }
+    return folge;
+}
+
+} // namespace astro
@@ -0,0 +1,74 @@
+#pragma once
+/**
+ * @file sign_timeline.h
+ * @brief Zeichen-Eintritte der Transit-Körper über einen Zeitraum
+ *
+ * Je Körper eine nach Zeit sortierte Liste der Eintritte (exakte Zeitpunkte
+ * aus TransitEvents). Welche Zeichen ein Körper in einem Teil-Zeitraum
+ * durchläuft, ergibt sich per binärer Suche - ohne die Radix-Schnappschüsse
+ * eines Multi-Transit-Laufs abzulaufen.
+ */
+
+#include "transit_events.h"
+
+namespace astro {
+
+class SignTimeline {
+public:
+    /**
+     * @brief Rechnet die Eintritte aller Körper (radix.anzahlPlanet)
+     * @param startJD Beginn (UT)
+     * @param endJD Ende (UT)
+     * @return Anzahl Eintritte (ohne die Anfangs-Zeichen), ERR_EPHEM bei Fehler
+     */
+    int build(const Radix& radix, double startJD, double endJD,
+              bool* abortFlag = nullptr,
+              const EpheContext& ctx = EpheContext::current());
+
+    void clear();
+    bool isEmpty() const { return m_eintritte.isEmpty(); }
+    int anzahlPlaneten() const { return m_eintritte.size(); }
+    double startJD() const { return m_startJD; }
+    double endJD() const { return m_endJD; }
+
+    /**
+     * @brief Zeichen eines Körpers zum Zeitpunkt jd, -1 außerhalb
+     */
+    int8_t zeichen(int planet, double jd) const;
+
+    /**
+     * @brief Durchlaufene Zeichen in [vonJD, bisJD], in zeitlicher
+     *        Reihenfolge (wie Legacy: ohne direkte Wiederholung)
+     * @return false, wenn Körper oder Zeitraum nicht abgedeckt sind
+     */
+    bool zeichen(int planet, double vonJD, double bisJD, QVector<int8_t>& folge) const;
+
+    /**
+     * @brief Deckt die Zeitleiste [vonJD, bisJD] für alle Körper ab?
+     */
+    bool deckt(double vonJD, double bisJD) const;
+
+    /**
+     * @brief Durchlaufene Zeichen zwischen zwei voll berechneten Transit-Radixen
+     *
+     * Aus der Zeitleiste; ist der Zeitraum nicht abgedeckt (z.B. build()
+     * abgebrochen), nur die Zeichen von von und bis. Die Schritte dazwischen
+     * tragen bei TransitCalc::calcMultiTransit keine Planeten.
+     */
+    QVector<int8_t> folge(int planet, const Radix& von, const Radix& bis) const;
+
+private:
+    struct Eintritt {
+        double jd;
+        int8_t zeichen;
+    };
+
+    bool abgedeckt(int planet, double vonJD, double bisJD) const;
+
+    // Je Körper: erster Eintrag = Zeichen am Anfang (jd = startJD)
+    QVector<QVector<Eintritt>> m_eintritte;
+    double m_startJD = 0.0;
+    double m_endJD = 0.0;
+};
+
+} // namespace astro
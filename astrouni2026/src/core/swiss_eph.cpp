@@ -4,6 +4,8 @@
  */
 
 #include "swiss_eph.h"
+#include "ephe_context.h"
+#include "ephe_memory.h"
 #include <QDir>
 #include <QFile>
 
@@ -14,12 +16,13 @@ extern "C" {
 
 namespace astro {
 
+thread_local QString SwissEph::s_lastError;
+
 //==============================================================================
 // Konstruktor / Destruktor
 //==============================================================================
 
-SwissEph::SwissEph() 
-    : m_initialized(false) {
+SwissEph::SwissEph() {
 }
 
 SwissEph::~SwissEph() {
@@ -31,23 +34,27 @@ SwissEph::~SwissEph() {
 //==============================================================================
 
 void SwissEph::setEphePath(const QString& path) {
-    m_ephePath = path;
-    QByteArray pathBytes = path.toLocal8Bit();
-    swe_set_ephe_path(const_cast<char*>(pathBytes.constData()));
-    m_initialized = true;
+    EpheContext::setGlobalConfig(EpheConfig::create(path));
+    EpheContext::current().bindThread();
     clearError();
 }
 
 QString SwissEph::getEphePath() const {
-    return m_ephePath;
+    return EpheContext::globalConfig()->ephePath;
 }
 
 bool SwissEph::checkEpheFiles() const {
-    if (m_ephePath.isEmpty()) {
+    // Eingebettete bzw. bereits eingeblendete Dateien
+    if (EpheMemory::fileCount() > 0) {
+        return true;
+    }
+    
+    const QString ephePath = getEphePath();
+    if (ephePath.isEmpty()) {
         return false;
     }
     
-    QDir dir(m_ephePath);
+    QDir dir(ephePath);
     if (!dir.exists()) {
         return false;
     }
@@ -60,58 +67,35 @@ bool SwissEph::checkEpheFiles() const {
     return !files.isEmpty();
 }
 
+int32_t SwissEph::calcFlags() const {
+    return EpheContext::globalConfig()->flags;
+}
+
+void SwissEph::initThread() {
+    EpheContext::current().bindThread();
+}
+
+bool SwissEph::isThreadSafe() {
+    return EpheContext::isThreadSafe();
+}
+
 //==============================================================================
 // Planeten-Berechnung
 //==============================================================================
 
-int SwissEph::toSwissEphPlanet(int planet) const {
-    // Mapping von internen Planet-Indizes zu Swiss Ephemeris
-    switch (planet) {
-        case P_SONNE:   return SE_SUN;
-        case P_MOND:    return SE_MOON;
-        case P_MERKUR:  return SE_MERCURY;
-        case P_VENUS:   return SE_VENUS;
-        case P_MARS:    return SE_MARS;
-        case P_JUPITER: return SE_JUPITER;
-        case P_SATURN:  return SE_SATURN;
-        case P_URANUS:  return SE_URANUS;
-        case P_NEPTUN:  return SE_NEPTUNE;
-        case P_PLUTO:   return SE_PLUTO;
-        case P_NKNOTEN: return SE_TRUE_NODE;
-        case P_LILITH:  return SE_MEAN_APOG;  // Mittlere Lilith
-        case P_CHIRON:  return SE_CHIRON;
-        case P_CERES:   return SE_CERES;
-        case P_PALLAS:  return SE_PALLAS;
-        case P_JUNO:    return SE_JUNO;
-        case P_VESTA:   return SE_VESTA;
-        default:        return -1;
-    }
-}
-
 bool SwissEph::calcPlanet(int planet, double jd, 
                           double& longitude, double& latitude,
                           double& distance, double& speed) {
-    int sePlanet = toSwissEphPlanet(planet);
-    if (sePlanet < 0) {
-        setError(QString("Unbekannter Planet: %1").arg(planet));
-        return false;
-    }
-    
-    double xx[6];
-    char serr[256] = {0};
-    
-    int32_t iflag = SEFLG_SPEED | SEFLG_SWIEPH;
-    int32_t iret = swe_calc_ut(jd, sePlanet, iflag, xx, serr);
-    
-    if (iret < 0) {
-        setError(QString::fromLatin1(serr));
+    const PlanetPos pos = EpheContext::current().calcPlanet(planet, jd);
+    if (!pos.ok()) {
+        setError(pos.status.error);
         return false;
     }
     
-    longitude = xx[0];  // Ekliptikale Länge
-    latitude = xx[1];   // Ekliptikale Breite
-    distance = xx[2];   // Entfernung in AU
-    speed = xx[3];      // Geschwindigkeit in Grad/Tag
+    longitude = pos.longitude;
+    latitude = pos.latitude;
+    distance = pos.distance;
+    speed = pos.speed;
     
     clearError();
     return true;
@@ -160,13 +144,9 @@ char SwissEph::houseSysToChar(int hsys) {
 
 bool SwissEph::calcHouses(double jd, double lat, double lon, int hsys,
                           double* cusps, double* ascmc) {
-    char hsysChar = houseSysToChar(hsys);
-    char serr[256] = {0};
-    
-    int iret = swe_houses_ex(jd, SEFLG_SWIEPH, lat, lon, hsysChar, cusps, ascmc);
-    
-    if (iret < 0) {
-        setError(QString("Fehler bei Häuserberechnung: %1").arg(serr));
+    const EpheStatus status = EpheContext::current().calcHouses(jd, lat, lon, hsys, cusps, ascmc);
+    if (!status.ok()) {
+        setError(status.error);
         return false;
     }
     
@@ -175,48 +155,19 @@ bool SwissEph::calcHouses(double jd, double lat, double lon, int hsys,
 }
 
 //==============================================================================
-// Siderische Zeit
+// Siderische Zeit, Obliquität, Delta T
 //==============================================================================
 
 double SwissEph::calcSiderealTime(double jd, double longitude) {
-    double armc = swe_sidtime(jd);  // ARMC in Stunden
-    
-    // Lokale siderische Zeit = ARMC + Länge/15
-    double lst = armc + longitude / 15.0;
-    
-    // Normalisieren auf 0-24 Stunden
-    while (lst >= 24.0) lst -= 24.0;
-    while (lst < 0.0) lst += 24.0;
-    
-    // Konvertieren in Grad (0-360)
-    return lst * 15.0;
+    return EpheContext::current().calcSiderealTime(jd, longitude);
 }
 
-//==============================================================================
-// Obliquität
-//==============================================================================
-
 double SwissEph::calcObliquity(double jd) {
-    double xx[6];
-    char serr[256] = {0};
-    
-    // Berechne Nutation und Obliquität
-    int32_t iret = swe_calc_ut(jd, SE_ECL_NUT, 0, xx, serr);
-    
-    if (iret < 0) {
-        // Fallback: Standardwert
-        return AXE;
-    }
-    
-    return xx[0];  // Wahre Obliquität
+    return EpheContext::current().calcObliquity(jd);
 }
 
-//==============================================================================
-// Delta T
-//==============================================================================
-
 double SwissEph::calcDeltaT(double jd) {
-    return swe_deltat(jd);
+    return EpheContext::current().calcDeltaT(jd);
 }
 
 //==============================================================================
@@ -224,19 +175,19 @@ double SwissEph::calcDeltaT(double jd) {
 //==============================================================================
 
 QString SwissEph::getLastError() const {
-    return m_lastError;
+    return s_lastError;
 }
 
 bool SwissEph::hasError() const {
-    return !m_lastError.isEmpty();
+    return !s_lastError.isEmpty();
 }
 
 void SwissEph::clearError() {
-    m_lastError.clear();
+    s_lastError.clear();
 }
 
 void SwissEph::setError(const QString& error) {
-    m_lastError = error;
+    s_lastError = error;
 }
 
 //==============================================================================
@@ -16,7 +16,10 @@ namespace astro {
 /**
  * @brief Swiss Ephemeris Wrapper
  * 
- * Kapselt alle Aufrufe an die Swiss Ephemeris Bibliothek.
+ * Kapselt alle Aufrufe an die Swiss Ephemeris Bibliothek für den GUI-
+ * Thread. Die Berechnungen laufen über EpheContext::current(); der letzte
+ * Fehler wird je Thread gehalten. Für parallele Berechnungen den
+ * EpheContext direkt verwenden (Fehler als Rückgabewert).
  */
 class SwissEph {
 public:
@@ -34,6 +37,9 @@ public:
     /**
      * @brief Setzt den Pfad zu den Ephemeriden-Dateien
      * @param path Pfad zum Verzeichnis mit den .se1 Dateien
+     * 
+     * Legt eine neue globale EpheConfig an; andere Threads übernehmen sie
+     * bei ihrer nächsten Berechnung.
      */
     void setEphePath(const QString& path);
     
@@ -48,6 +54,29 @@ public:
      */
     bool checkEpheFiles() const;
     
+    /**
+     * @brief Flags, mit denen die Planeten berechnet werden (SEFLG_*)
+     * 
+     * Gehört zum Schlüssel des Chart-Caches: andere Flags ergeben
+     * andere Positionen.
+     */
+    int32_t calcFlags() const;
+    
+    /**
+     * @brief Bereitet den aufrufenden Thread für Berechnungen vor
+     * 
+     * Swiss Ephemeris hält ihren Zustand (u.a. den Ephemeriden-Pfad) je
+     * Thread. Geschieht über EpheContext bei jeder Berechnung auch implizit.
+     */
+    void initThread();
+    
+    /**
+     * @brief Darf aus mehreren Threads gleichzeitig gerechnet werden?
+     * 
+     * Siehe EpheContext::isThreadSafe().
+     */
+    static bool isThreadSafe();
+    
     //==========================================================================
     // Planeten-Berechnung
     //==========================================================================
@@ -160,12 +189,8 @@ public:
     void clearError();
     
 private:
-    QString m_ephePath;
-    QString m_lastError;
-    bool m_initialized;
-    
-    // Konvertiert internen Planet-Index zu Swiss Ephemeris Planet-ID
-    int toSwissEphPlanet(int planet) const;
+    // Fehler je Thread (Worker-Threads rechnen parallel)
+    static thread_local QString s_lastError;
     
     // Setzt Fehlermeldung
     void setError(const QString& error);
@@ -0,0 +1,318 @@
+/**
+ * @file synastry.cpp
+ * @brief Implementierung der Synastrie-Berechnung
+ */
+
+#include "synastry.h"
+#include "calculations.h"
+#include "calendar.h"
+#include "chart_calc.h"
+#include "chart_pipeline.h"
+#include "instrumentation.h"
+#include <algorithm>
+#include <cmath>
+
+namespace astro {
+
+namespace {
+
+// Reihenfolge wie ChartCalc und die Orben-Tabellen
+constexpr int ASPEKT_FOLGE[ASPEKTE] = {
+    KONJUNKTION, HALBSEX, SEXTIL, QUADRATUR, TRIGON, QUINCUNX, OPOSITION
+};
+
+constexpr int ASPEKT_FLAG[ASPEKTE] = {
+    S_KON, S_HAL, S_SEX, S_QUA, S_TRI, S_QUI, S_OPO
+};
+
+// Fehlt ein Orb in den Einstellungen (oder ist 0), gilt wie bisher 8°
+constexpr float STANDARD_ORB = 8.0f;
+
+// Abstand zweier Positionen (0..360) auf dem Kreis, 0..180
+inline double abstand(double pos1, double pos2) {
+    const double diff = std::fabs(pos1 - pos2);
+    return diff > DEGHALB ? DEGMAX - diff : diff;
+}
+
+// Mitte auf dem kürzeren Bogen
+inline double mitte(double pos1, double pos2) {
+    return Calculations::mod360(pos1 + Calculations::minDist(pos1, pos2) / 2.0);
+}
+
+int anzahlPlaneten(const Radix& radix) {
+    return std::min({ static_cast<int>(radix.anzahlPlanet), static_cast<int>(radix.planet.size()),
+                      MAX_PLANET });
+}
+
+/**
+ * Aspekt-Matrix B x A: für jeden Planeten von B eine Zeile über alle
+ * Planeten von A. Die Orben werden vorab je Aspekt zu Zeilen umsortiert,
+ * damit die innere Schleife nur über zusammenhängende Arrays läuft und
+ * ohne Verzweigung auskommt (vom Compiler vektorisierbar).
+ */
+void kreuzMatrix(SynastrieErgebnis& e, const QVector<float>& orben) {
+    // orbTabelle[(k * MAX_PLANET + b) * MAX_PLANET + a]
+    float orbTabelle[ASPEKTE * MAX_PLANET * MAX_PLANET];
+    for (int b = 0; b < MAX_PLANET; ++b) {
+        for (int a = 0; a < MAX_PLANET; ++a) {
+            for (int k = 0; k < ASPEKTE; ++k) {
+                const int idx = (b * MAX_PLANET + a) * ASPEKTE + k;
+                const float orb = idx < orben.size() ? orben[idx] : 0.0f;
+                orbTabelle[(k * MAX_PLANET + b) * MAX_PLANET + a] = orb > 0.0f ? orb : STANDARD_ORB;
+            }
+        }
+    }
+
+    for (int b = 0; b < e.anzahlB; ++b) {
+        double* winkel = &e.winkel[b * MAX_PLANET];
+        int16_t* aspekt = &e.aspekt[b * MAX_PLANET];
+        const double posB = e.planetB[b];
+
+        for (int a = 0; a < e.anzahlA; ++a) {
+            winkel[a] = abstand(e.planetA[a], posB);
+        }
+        for (int k = 0; k < ASPEKTE; ++k) {
+            const float* orb = &orbTabelle[(k * MAX_PLANET + b) * MAX_PLANET];
+            const double soll = static_cast<double>(ASPEKT_FOLGE[k]);
+            const int16_t asp = static_cast<int16_t>(ASPEKT_FOLGE[k]);
+            for (int a = 0; a < e.anzahlA; ++a) {
+                const bool treffer = aspekt[a] == KEIN_ASP && std::fabs(winkel[a] - soll) <= orb[a];
+                aspekt[a] = treffer ? asp : aspekt[a];
+            }
+        }
+    }
+}
+
+/**
+ * Aspekte der Planeten eines Horoskops zu den Häusern des anderen
+ * (Orben und Aspekt-Auswahl wie ChartCalc::calcHouseAspects)
+ */
+void hausAspekte(const double* planeten, int anzahl, const double* haeuser,
+                 const QVector<float>& orben, int16_t aspektFlags, int16_t* ziel) {
+    std::fill(ziel, ziel + MAX_PLANET * MAX_HAUS, static_cast<int16_t>(KEIN_ASP));
+    if ((aspektFlags & S_HAUS) == 0) {
+        return;
+    }
+    for (int i = 0; i < anzahl; ++i) {
+        for (int h = 0; h < MAX_HAUS; ++h) {
+            const double winkel = abstand(planeten[i], haeuser[h]);
+            for (int k = 0; k < ASPEKTE; ++k) {
+                if (!(aspektFlags & ASPEKT_FLAG[k])) {
+                    continue;
+                }
+                const int idx = k * MAX_PLANET + i;
+                const float orb = idx < orben.size() ? orben[idx] : STANDARD_ORB;
+                if (std::fabs(winkel - ASPEKT_FOLGE[k]) <= orb) {
+                    ziel[i * MAX_HAUS + h] = static_cast<int16_t>(ASPEKT_FOLGE[k]);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+// Aspekte eines abgeleiteten Horoskops (wie ChartPipeline::calcAspects)
+void radixAspekte(Radix& radix, const AuInit& auinit) {
+    ChartCalc::calcAspects(radix, auinit.orbenPlanet);
+    ChartCalc::calcAngles(radix, nullptr, TYP_RADIX);
+    ChartCalc::calcHouseAspects(radix, auinit.orbenHaus, auinit.sAspekte);
+}
+
+} // namespace
+
+//==============================================================================
+// SynastrieErgebnis
+//==============================================================================
+
+SynastrieErgebnis::SynastrieErgebnis() {
+    std::fill(std::begin(aspekt), std::end(aspekt), static_cast<int16_t>(KEIN_ASP));
+    std::fill(std::begin(aspektHausA), std::end(aspektHausA), static_cast<int16_t>(KEIN_ASP));
+    std::fill(std::begin(aspektHausB), std::end(aspektHausB), static_cast<int16_t>(KEIN_ASP));
+}
+
+int16_t SynastrieErgebnis::planetAspekt(int planetA, int planetB) const {
+    if (planetA < 0 || planetA >= anzahlA || planetB < 0 || planetB >= anzahlB) {
+        return KEIN_ASP;
+    }
+    return aspekt[planetB * MAX_PLANET + planetA];
+}
+
+double SynastrieErgebnis::planetWinkel(int planetA, int planetB) const {
+    if (planetA < 0 || planetA >= anzahlA || planetB < 0 || planetB >= anzahlB) {
+        return 0.0;
+    }
+    return winkel[planetB * MAX_PLANET + planetA];
+}
+
+bool SynastrieErgebnis::passtZu(const Radix& a, const Radix& b, int horoTyp,
+                                size_t pruefsumme) const {
+    if (horoTyp != typ || pruefsumme != orben || anzahlPlaneten(a) != anzahlA
+        || anzahlPlaneten(b) != anzahlB) {
+        return false;
+    }
+    for (int i = 0; i < anzahlA; ++i) {
+        if (a.planet[i] != planetA[i]) {
+            return false;
+        }
+    }
+    for (int i = 0; i < anzahlB; ++i) {
+        if (b.planet[i] != planetB[i]) {
+            return false;
+        }
+    }
+    for (int h = 0; h < MAX_HAUS; ++h) {
+        if ((h < a.haus.size() ? a.haus[h] : 0.0) != hausA[h]
+            || (h < b.haus.size() ? b.haus[h] : 0.0) != hausB[h]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//==============================================================================
+// SynastrieCalc
+//==============================================================================
+
+SynastrieErgebnis SynastrieCalc::calculate(const Radix& a, const Radix& b, const AuInit& auinit,
+                                           int typ, int umfang, const EpheContext& ctx) {
+    ASTRO_TIMER("SynastrieCalc::calculate");
+    SynastrieErgebnis e;
+    e.typ = typ;
+    e.umfang = umfang | SYN_ASPEKTE;
+    e.orben = ChartPipeline::orbenHash(auinit);
+    e.anzahlA = anzahlPlaneten(a);
+    e.anzahlB = anzahlPlaneten(b);
+    for (int i = 0; i < e.anzahlA; ++i) {
+        e.planetA[i] = a.planet[i];
+    }
+    for (int i = 0; i < e.anzahlB; ++i) {
+        e.planetB[i] = b.planet[i];
+    }
+    for (int h = 0; h < MAX_HAUS; ++h) {
+        e.hausA[h] = h < a.haus.size() ? a.haus[h] : 0.0;
+        e.hausB[h] = h < b.haus.size() ? b.haus[h] : 0.0;
+    }
+
+    const bool transit = (typ == TYP_TRANSIT);
+    kreuzMatrix(e, transit ? auinit.orbenTPlanet : auinit.orbenSPlanet);
+
+    const QVector<float>& orbenHaus = transit ? auinit.orbenTHaus : auinit.orbenSHaus;
+    hausAspekte(e.planetB, e.anzahlB, e.hausA, orbenHaus, auinit.sAspekte, e.aspektHausA);
+    hausAspekte(e.planetA, e.anzahlA, e.hausB, orbenHaus, auinit.sAspekte, e.aspektHausB);
+
+    if (a.haus.size() >= MAX_HAUS && b.haus.size() >= MAX_HAUS) {
+        for (int i = 0; i < e.anzahlB; ++i) {
+            e.inHausA[i] = ChartCalc::getHouseOfPlanet(e.planetB[i], a.haus);
+        }
+        for (int i = 0; i < e.anzahlA; ++i) {
+            e.inHausB[i] = ChartCalc::getHouseOfPlanet(e.planetA[i], b.haus);
+        }
+    }
+
+    // Liste nach A, dann B - Reihenfolge der Textanalyse und des PDF-Exports
+    e.aspekte.reserve(e.anzahlA * ASPEKTE);
+    for (int pa = 0; pa < e.anzahlA; ++pa) {
+        for (int pb = 0; pb < e.anzahlB; ++pb) {
+            const int idx = pb * MAX_PLANET + pa;
+            if (e.aspekt[idx] == KEIN_ASP) {
+                continue;
+            }
+            SynastrieAspekt s;
+            s.planetA = static_cast<int8_t>(pa);
+            s.planetB = static_cast<int8_t>(pb);
+            s.aspekt = e.aspekt[idx];
+            s.winkel = e.winkel[idx];
+            s.orb = std::fabs(s.winkel - s.aspekt);
+            e.aspekte.append(s);
+        }
+    }
+    ASTRO_COUNT("SynastrieCalc::aspekte", e.aspekte.size());
+
+    if (umfang & SYN_COMPOSIT) {
+        calcComposit(a, b, e.composit, auinit);
+    }
+    if (umfang & SYN_DAVISON) {
+        e.davisonResult = calcDavison(a, b, e.davison, auinit, ctx);
+    }
+    return e;
+}
+
+std::shared_ptr<const SynastrieErgebnis> SynastrieCalc::ergebnis(const Radix& a, const Radix& b,
+                                                                 const AuInit& auinit,
+                                                                 int typ, int umfang) {
+    const std::shared_ptr<const SynastrieErgebnis>& vorhanden = a.synastrieErgebnis;
+    if (vorhanden && (vorhanden->umfang & umfang) == umfang
+        && vorhanden->passtZu(a, b, typ, ChartPipeline::orbenHash(auinit))) {
+        return vorhanden;
+    }
+    return std::make_shared<const SynastrieErgebnis>(calculate(a, b, auinit, typ, umfang));
+}
+
+void SynastrieCalc::calcComposit(const Radix& a, const Radix& b, Radix& composit,
+                                 const AuInit& auinit) {
+    ASTRO_TIMER("SynastrieCalc::calcComposit");
+    const int n = std::min(anzahlPlaneten(a), anzahlPlaneten(b));
+    composit.allocate(static_cast<int16_t>(n));
+    composit.hausSys = a.hausSys;
+    composit.horoTyp = TYP_RADIX;
+
+    composit.jd = (a.jd + b.jd) / 2.0;
+    composit.breite = (a.breite + b.breite) / 2.0;
+    composit.ob = (a.ob + b.ob) / 2.0;
+    composit.asc = mitte(a.asc, b.asc);
+    composit.mc = mitte(a.mc, b.mc);
+
+    const int haeuser = std::min(a.haus.size(), b.haus.size());
+    for (int h = 0; h < haeuser && h < composit.haus.size(); ++h) {
+        composit.haus[h] = mitte(a.haus[h], b.haus[h]);
+        composit.hausRad[h] = composit.haus[h] * PI / DEGHALB;
+    }
+    for (int h = 0; h < MAX_HAUS; ++h) {
+        composit.stzHaus[h] = Calculations::getZeichen(composit.haus[h]);
+    }
+
+    for (int i = 0; i < n; ++i) {
+        composit.planet[i] = mitte(a.planet[i], b.planet[i]);
+        composit.planetRad[i] = composit.planet[i] * PI / DEGHALB;
+        composit.stzPlanet[i] = Calculations::getZeichen(composit.planet[i]);
+        composit.inHaus[i] = ChartCalc::getHouseOfPlanet(composit.planet[i], composit.haus);
+    }
+
+    ChartCalc::calcQualities(composit);
+    radixAspekte(composit, auinit);
+}
+
+int SynastrieCalc::calcDavison(const Radix& a, const Radix& b, Radix& davison,
+                               const AuInit& auinit, const EpheContext& ctx) {
+    ASTRO_TIMER("SynastrieCalc::calcDavison");
+    davison.allocate(static_cast<int16_t>(std::min(anzahlPlaneten(a), anzahlPlaneten(b))));
+    davison.hausSys = a.hausSys;
+    davison.horoTyp = TYP_RADIX;
+
+    // radix.jd ist Weltzeit - das Davison-Horoskop rechnet ohne Zone
+    const CalDateTime mitteZeit = Calendar::fromJD((a.jd + b.jd) / 2.0);
+    davison.rFix.tag = static_cast<int16_t>(mitteZeit.tag);
+    davison.rFix.monat = static_cast<int16_t>(mitteZeit.monat);
+    davison.rFix.jahr = static_cast<int16_t>(mitteZeit.jahr);
+    davison.rFix.zeit = mitteZeit.stunden();
+    davison.rFix.zone = 0.0f;
+    davison.rFix.sommerzeit = 0.0;
+    davison.rFix.breite = (a.rFix.breite + b.rFix.breite) / 2.0;
+    double laenge = a.rFix.laenge + Calculations::minDist(a.rFix.laenge, b.rFix.laenge) / 2.0;
+    if (laenge > DEGHALB) {
+        laenge -= DEGMAX;
+    } else if (laenge <= -DEGHALB) {
+        laenge += DEGMAX;
+    }
+    davison.rFix.laenge = laenge;
+    davison.rFix.gultig = true;
+
+    const int result = ChartCalc::calculate(davison, nullptr, TYP_RADIX, ctx);
+    if (result != ERR_OK) {
+        return result;
+    }
+    radixAspekte(davison, auinit);
+    return ERR_OK;
+}
+
+} // namespace astro
@@ -0,0 +1,143 @@
+#pragma once
+/**
+ * @file synastry.h
+ * @brief Synastrie: Kreuz-Aspekte, Composit- und Davison-Horoskop
+ *
+ * Rechnet für zwei Horoskope A (Radix) und B (Partner bzw. Transit) in
+ * einem Durchgang die vollständige Aspekt-Matrix A x B, die Aspekte der
+ * Planeten zu den Häusern des jeweils anderen Horoskops und auf Wunsch das
+ * Composit- (Halbsummen) und das Davison-Horoskop (Zeit-/Ort-Mitte).
+ *
+ * Das Ergebnis hängt als radix.synastrieErgebnis am Radix (gesetzt von
+ * ChartPipeline::calcAspects) - Grafik, Aspekt-Liste, Textanalyse und
+ * PDF-Export lesen daraus, statt die Aspekte jeweils selbst zu suchen.
+ */
+
+#include "data_types.h"
+#include "ephe_context.h"
+#include <QVector>
+#include <memory>
+
+namespace astro {
+
+/**
+ * @brief Ein Aspekt zwischen Planet a von A und Planet b von B
+ */
+struct SynastrieAspekt {
+    int8_t  planetA = -1;
+    int8_t  planetB = -1;
+    int16_t aspekt = KEIN_ASP;
+    double  winkel = 0.0;           // Abstand der Positionen (0..180)
+    double  orb = 0.0;              // Abweichung vom exakten Aspekt
+};
+
+/**
+ * @brief Ergebnis einer Synastrie-Berechnung
+ *
+ * Orben: Planeten [planetB * MAX_PLANET + planetA] * ASPEKTE + Aspekt aus
+ * orbenSPlanet bzw. orbenTPlanet (wie bisher Grafik und Aspekt-Liste),
+ * Häuser wie ChartCalc::calcHouseAspects aus orbenSHaus bzw. orbenTHaus.
+ * Je Paar zählt der erste Aspekt in der Reihenfolge KONJUNKTION, HALBSEX,
+ * SEXTIL, QUADRATUR, TRIGON, QUINCUNX, OPOSITION.
+ */
+struct SynastrieErgebnis {
+    int     typ = TYP_SYNASTRIE;    // TYP_SYNASTRIE oder TYP_TRANSIT (Orben)
+    int     umfang = 0;             // Berechnete Teile (SynastrieCalc::Umfang)
+    size_t  orben = 0;              // ChartPipeline::orbenHash der Einstellungen
+    int     anzahlA = 0;
+    int     anzahlB = 0;
+    double  planetA[MAX_PLANET] = {0};
+    double  planetB[MAX_PLANET] = {0};
+    double  hausA[MAX_HAUS] = {0};
+    double  hausB[MAX_HAUS] = {0};
+
+    // Planeten-Matrix, Index planetB * MAX_PLANET + planetA
+    int16_t aspekt[MAX_PLANET * MAX_PLANET];
+    double  winkel[MAX_PLANET * MAX_PLANET] = {0};
+
+    // Planeten von B zu Häusern von A (Index planetB * MAX_HAUS + haus)
+    // und Planeten von A zu Häusern von B (Index planetA * MAX_HAUS + haus)
+    int16_t aspektHausA[MAX_PLANET * MAX_HAUS];
+    int16_t aspektHausB[MAX_PLANET * MAX_HAUS];
+
+    // Haus-Überlagerung: Haus von A, in dem Planet b steht, und umgekehrt
+    int8_t  inHausA[MAX_PLANET] = {0};
+    int8_t  inHausB[MAX_PLANET] = {0};
+
+    // Alle Planeten-Aspekte, sortiert nach planetA, dann planetB
+    QVector<SynastrieAspekt> aspekte;
+
+    Radix   composit;               // Halbsummen von A und B
+    Radix   davison;                // Horoskop für Zeit- und Ort-Mitte
+    int     davisonResult = ERR_OK; // Rückgabe von ChartCalc::calculate
+
+    SynastrieErgebnis();
+
+    int16_t planetAspekt(int planetA, int planetB) const;
+    double planetWinkel(int planetA, int planetB) const;
+
+    /**
+     * @brief Gehört das Ergebnis zu diesen Horoskopen und Einstellungen?
+     *
+     * Vergleicht Planeten, Häuser, Orben-Typ und Orben-Prüfsumme.
+     */
+    bool passtZu(const Radix& a, const Radix& b, int horoTyp, size_t pruefsumme) const;
+};
+
+/**
+ * @brief Synastrie-Berechnung
+ */
+class SynastrieCalc {
+public:
+    /**
+     * @brief Teile der Berechnung (Bitmaske)
+     */
+    enum Umfang {
+        SYN_ASPEKTE  = 0x1,         // Planeten- und Haus-Kreuzaspekte
+        SYN_COMPOSIT = 0x2,
+        SYN_DAVISON  = 0x4,
+        SYN_ALLE     = SYN_ASPEKTE | SYN_COMPOSIT | SYN_DAVISON
+    };
+
+    /**
+     * @brief Berechnet die Synastrie von A und B
+     * @param a Berechneter Radix (Person A bzw. Radix bei Transit)
+     * @param b Berechneter Partner- bzw. Transit-Radix
+     * @param auinit Einstellungen (Orben, Aspekt-Auswahl für Häuser)
+     * @param typ TYP_SYNASTRIE oder TYP_TRANSIT - wählt die Orben
+     * @param umfang Zu berechnende Teile (Aspekte werden immer berechnet)
+     * @param ctx Ephemeriden-Kontext für das Davison-Horoskop
+     */
+    static SynastrieErgebnis calculate(const Radix& a, const Radix& b, const AuInit& auinit,
+                                       int typ = TYP_SYNASTRIE, int umfang = SYN_ALLE,
+                                       const EpheContext& ctx = EpheContext::current());
+
+    /**
+     * @brief Liefert a.synastrieErgebnis, wenn es passt, sonst ein neues
+     *
+     * Für Anzeigen, die nicht sicher über die Pipeline gehen (z.B. aus
+     * einem kopierten Radix mit anderem Transit).
+     */
+    static std::shared_ptr<const SynastrieErgebnis> ergebnis(const Radix& a, const Radix& b,
+                                                             const AuInit& auinit,
+                                                             int typ = TYP_SYNASTRIE,
+                                                             int umfang = SYN_ASPEKTE);
+
+    /**
+     * @brief Composit-Horoskop: Halbsumme (kürzerer Bogen) jedes Planeten,
+     *        jeder Häuserspitze und von ASC/MC, danach Aspekte
+     */
+    static void calcComposit(const Radix& a, const Radix& b, Radix& composit,
+                             const AuInit& auinit);
+
+    /**
+     * @brief Davison-Horoskop: Radix für die Mitte von Weltzeit, Breite
+     *        und Länge (kürzerer Bogen) beider Geburten, danach Aspekte
+     * @return ERR_OK bei Erfolg, Fehlercode von ChartCalc::calculate sonst
+     */
+    static int calcDavison(const Radix& a, const Radix& b, Radix& davison,
+                           const AuInit& auinit,
+                           const EpheContext& ctx = EpheContext::current());
+};
+
+} // namespace astro
@@ -0,0 +1,216 @@
+/**
+ * @file synastry_search.cpp
+ * @brief Implementierung der Synastrie-Suche
+ */
+
+#include "synastry_search.h"
+#include "instrumentation.h"
+#include <QThread>
+#include <QThreadPool>
+#include <QtConcurrent>
+#include <algorithm>
+#include <cmath>
+
+namespace astro {
+
+namespace {
+
+// Personen je Arbeitspaket - Zwischenwerte bleiben im L1-Cache
+constexpr int BLOCK = 1024;
+
+// Reihenfolge wie SynastrieCalc und die Orben-Tabellen
+constexpr int ASPEKT_FOLGE[ASPEKTE] = {
+    KONJUNKTION, HALBSEX, SEXTIL, QUADRATUR, TRIGON, QUINCUNX, OPOSITION
+};
+
+// Fehlt ein Orb in den Einstellungen (oder ist 0), gilt wie bisher 8°
+constexpr float STANDARD_ORB = 8.0f;
+
+/**
+ * Planeten-Paar der Anfrage mit allem, was nicht von der Person abhängt
+ */
+struct Paar {
+    int    planet = 0;              // Planet der Person
+    double position = 0.0;          // Position des Planeten der Anfrage
+    double orb[ASPEKTE];
+    double gewicht[ASPEKTE];        // Punkte bei exaktem Aspekt
+    double abfall[ASPEKTE];         // Punkte weniger je Grad Abweichung
+};
+
+bool besser(const SynastrieTreffer& a, const SynastrieTreffer& b) {
+    return a.punkte != b.punkte ? a.punkte > b.punkte : a.index < b.index;
+}
+
+// Behält die besten anzahl Treffer (0 = alle), sortiert
+void kuerzen(QVector<SynastrieTreffer>& treffer, int anzahl) {
+    if (anzahl > 0 && treffer.size() > anzahl) {
+        std::partial_sort(treffer.begin(), treffer.begin() + anzahl, treffer.end(), besser);
+        treffer.resize(anzahl);
+    } else {
+        std::sort(treffer.begin(), treffer.end(), besser);
+    }
+}
+
+} // namespace
+
+//==============================================================================
+// Aufbau
+//==============================================================================
+
+void SynastrieSuche::clear() {
+    m_positionen.clear();
+    m_index.clear();
+}
+
+int SynastrieSuche::build(const QVector<RadixFix>& personen, const AuInit& auinit,
+                          int hausSys, int threads) {
+    return build(BulkChart::calculate(personen, auinit, hausSys, threads));
+}
+
+int SynastrieSuche::build(const BulkChartResult& result) {
+    clear();
+    for (const BulkChartRow& row : result.rows) {
+        if (row.result == ERR_OK) {
+            m_index.append(row.index);
+        }
+    }
+
+    const int n = m_index.size();
+    m_positionen.resize(MAX_PLANET * n);
+    double* positionen = m_positionen.data();
+    int person = 0;
+    for (const BulkChartRow& row : result.rows) {
+        if (row.result != ERR_OK) {
+            continue;
+        }
+        for (int p = 0; p < MAX_PLANET; ++p) {
+            positionen[p * n + person] = row.planet[p];
+        }
+        ++person;
+    }
+    return n;
+}
+
+//==============================================================================
+// Bewertung
+//==============================================================================
+
+QVector<SynastrieTreffer> SynastrieSuche::rangliste(const Radix& radix, const AuInit& auinit,
+                                                    const SynastrieGewichte& gewichte,
+                                                    int anzahl, int ausschluss,
+                                                    int threads) const {
+    ASTRO_TIMER("SynastrieSuche::rangliste");
+    const int n = m_index.size();
+    if (n == 0) {
+        return {};
+    }
+
+    // Paare und Orben einmal vorab - hängen nur von der Anfrage ab
+    // Orben-Index wie SynastrieCalc: [planetB * MAX_PLANET + planetA] * ASPEKTE + Aspekt
+    const QVector<float>& orben = auinit.orbenSPlanet;
+    const int anzahlA = std::min({ static_cast<int>(radix.anzahlPlanet),
+                                   static_cast<int>(radix.planet.size()), MAX_PLANET });
+    QVector<Paar> paare;
+    for (int a = 0; a < anzahlA; ++a) {
+        for (int b = 0; b < MAX_PLANET; ++b) {
+            const double planetGewicht = gewichte.planet[a] * gewichte.planet[b];
+            if (planetGewicht == 0.0) {
+                continue;
+            }
+            Paar paar;
+            paar.planet = b;
+            paar.position = radix.planet[a];
+            for (int k = 0; k < ASPEKTE; ++k) {
+                const int idx = (b * MAX_PLANET + a) * ASPEKTE + k;
+                const float orb = idx < orben.size() ? orben[idx] : 0.0f;
+                paar.orb[k] = orb > 0.0f ? orb : STANDARD_ORB;
+                paar.gewicht[k] = planetGewicht * gewichte.aspekt[k];
+                paar.abfall[k] = gewichte.orbGewichtet ? paar.gewicht[k] / paar.orb[k] : 0.0;
+            }
+            paare.append(paar);
+        }
+    }
+
+    const int bloecke = (n + BLOCK - 1) / BLOCK;
+    QVector<QVector<SynastrieTreffer>> besteJeBlock(bloecke);
+    const double* positionen = m_positionen.constData();
+
+    auto bewerteBlock = [&](int block) {
+        const int start = block * BLOCK;
+        const int laenge = std::min(BLOCK, n - start);
+
+        // Alles double, damit die Schleifen einheitlich vektorisiert werden
+        double punkte[BLOCK] = {0};
+        double aspekte[BLOCK] = {0};
+        double winkel[BLOCK];
+        double frei[BLOCK];             // 1 = noch kein Aspekt für dieses Paar
+
+        for (const Paar& paar : paare) {
+            const double* pos = positionen + paar.planet * n + start;
+            for (int c = 0; c < laenge; ++c) {
+                const double diff = std::fabs(pos[c] - paar.position);
+                winkel[c] = std::min(diff, DEGMAX - diff);
+                frei[c] = 1.0;
+            }
+            // Je Person zählt der erste passende Aspekt (wie SynastrieCalc);
+            // ohne Verzweigung, damit die Schleife vektorisiert wird
+            for (int k = 0; k < ASPEKTE; ++k) {
+                const double soll = static_cast<double>(ASPEKT_FOLGE[k]);
+                const double orb = paar.orb[k];
+                const double gewicht = paar.gewicht[k];
+                const double abfall = paar.abfall[k];
+                for (int c = 0; c < laenge; ++c) {
+                    const double abweichung = std::fabs(winkel[c] - soll);
+                    const double treffer = static_cast<double>(abweichung <= orb) * frei[c];
+                    punkte[c] += treffer * (gewicht - abweichung * abfall);
+                    aspekte[c] += treffer;
+                    frei[c] -= treffer;
+                }
+            }
+        }
+
+        QVector<SynastrieTreffer>& beste = besteJeBlock[block];
+        beste.reserve(laenge);
+        for (int c = 0; c < laenge; ++c) {
+            const int index = m_index[start + c];
+            if (index == ausschluss) {
+                continue;
+            }
+            SynastrieTreffer t;
+            t.index = index;
+            t.punkte = punkte[c];
+            t.anzahlAspekte = static_cast<int16_t>(aspekte[c]);
+            beste.append(t);
+        }
+        kuerzen(beste, anzahl);
+    };
+
+    if (threads <= 0) {
+        threads = QThread::idealThreadCount();
+    }
+    if (threads == 1 || bloecke == 1) {
+        for (int block = 0; block < bloecke; ++block) {
+            bewerteBlock(block);
+        }
+    } else {
+        // Reine Rechnung ohne Ephemeride - immer parallel möglich
+        QVector<int> bloeckeListe(bloecke);
+        for (int block = 0; block < bloecke; ++block) {
+            bloeckeListe[block] = block;
+        }
+        QThreadPool pool;
+        pool.setMaxThreadCount(threads);
+        QtConcurrent::blockingMap(&pool, bloeckeListe, bewerteBlock);
+    }
+
+    QVector<SynastrieTreffer> ergebnis;
+    for (const QVector<SynastrieTreffer>& beste : besteJeBlock) {
+        ergebnis += beste;
+    }
+    kuerzen(ergebnis, anzahl);
+
+    ASTRO_COUNT("SynastrieSuche::personen", n);
+    return ergebnis;
+}
+
+} // namespace astro
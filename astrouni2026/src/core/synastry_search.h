@@ -0,0 +1,98 @@
+#pragma once
+/**
+ * @file synastry_search.h
+ * @brief Synastrie-Suche über viele Personen (z.B. ganze Personen-Datenbank)
+ *
+ * Hält die Planeten-Positionen aller Personen spaltenweise (je Planet ein
+ * zusammenhängendes Array über alle Personen) und bewertet ein Horoskop
+ * gegen alle in einem Durchgang. Die Kreuz-Aspekte werden wie bei
+ * SynastrieCalc mit den Synastrie-Orben gesucht, aber nicht gespeichert -
+ * je Person bleibt nur die Punktzahl.
+ */
+
+#include "bulk_chart.h"
+#include "data_types.h"
+#include <QVector>
+
+namespace astro {
+
+/**
+ * @brief Gewichte der Synastrie-Bewertung
+ *
+ * Ein Aspekt zwischen Planet a (Anfrage) und Planet b (Person) zählt
+ * planet[a] * planet[b] * aspekt[k], bei orbGewichtet zusätzlich mit
+ * (1 - Abweichung / Orb) - exakte Aspekte zählen voll, Aspekte am Rand
+ * des Orbs fast nicht. Planeten mit Gewicht 0 werden übersprungen.
+ */
+struct SynastrieGewichte {
+    // Reihenfolge KONJUNKTION, HALBSEX, SEXTIL, QUADRATUR, TRIGON, QUINCUNX, OPOSITION
+    double aspekt[ASPEKTE] = { 3.0, 0.5, 2.0, -2.0, 3.0, -0.5, -1.0 };
+
+    // Persönliche Planeten stärker, Asteroiden nur schwach
+    double planet[MAX_PLANET] = {
+        2.0, 2.0, 1.0, 2.0, 1.5, 1.0, 1.0,      // Sonne .. Saturn
+        0.5, 0.5, 0.5, 0.5, 0.25, 0.25,         // Uranus .. Chiron
+        0.0, 0.0, 0.0, 0.0                      // Ceres .. Vesta
+    };
+
+    bool orbGewichtet = true;
+};
+
+/**
+ * @brief Eine Person in der Rangliste
+ */
+struct SynastrieTreffer {
+    int     index = -1;             // Index in der Personen-Liste
+    double  punkte = 0.0;
+    int16_t anzahlAspekte = 0;
+};
+
+/**
+ * @brief Vorberechnete Positionen vieler Personen für die Synastrie-Suche
+ *
+ * Nach build() nur lesend benutzt - rangliste() darf aus mehreren Threads
+ * gleichzeitig aufgerufen werden.
+ */
+class SynastrieSuche {
+public:
+    /**
+     * @brief Berechnet alle Personen (BulkChart::calculate) und übernimmt
+     *        ihre Positionen
+     * @return Anzahl der übernommenen Personen (ohne Rechenfehler)
+     */
+    int build(const QVector<RadixFix>& personen, const AuInit& auinit,
+              int hausSys = TYP_PLACIDUS, int threads = 0);
+
+    /**
+     * @brief Übernimmt die Positionen einer vorhandenen Massen-Berechnung
+     * @return Anzahl der übernommenen Zeilen (ohne Rechenfehler)
+     */
+    int build(const BulkChartResult& result);
+
+    /**
+     * @brief Bewertet ein Horoskop gegen alle Personen
+     * @param radix Berechnetes Horoskop der Anfrage
+     * @param auinit Einstellungen (orbenSPlanet, Index wie SynastrieCalc)
+     * @param gewichte Gewichte der Bewertung
+     * @param anzahl Länge der Rangliste (0 = alle)
+     * @param ausschluss Index, der nicht in die Liste kommt (z.B. die
+     *        Anfrage selbst), -1 = keiner
+     * @param threads Anzahl Threads (0 = alle Kerne)
+     * @return Die besten Personen, absteigend nach Punkten
+     */
+    QVector<SynastrieTreffer> rangliste(const Radix& radix, const AuInit& auinit,
+                                        const SynastrieGewichte& gewichte = SynastrieGewichte(),
+                                        int anzahl = 100, int ausschluss = -1,
+                                        int threads = 0) const;
+
+    int size() const { return m_index.size(); }
+    void clear();
+
+private:
+    // Positionen spaltenweise: m_positionen[planet * size() + person]
+    QVector<double> m_positionen;
+    // Index in der Eingabe je Person
+    QVector<int> m_index;
+};
+
+} // namespace astro
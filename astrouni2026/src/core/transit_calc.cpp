@@ -6,38 +6,386 @@
 #include "transit_calc.h"
 #include "chart_calc.h"
 #include "calculations.h"
-#include "swiss_eph.h"
+#include "instrumentation.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 namespace astro {
 
-//==============================================================================
-// Transit-Berechnung
-//==============================================================================
+namespace {
 
-int TransitCalc::calcTransit(const Radix& radix, Radix& transit,
-                             const QDate& datum, const QTime& zeit) {
-    // Transit-Radix initialisieren
-    transit.clear();
-    transit.allocate(radix.anzahlPlanet);
-    
-    // Koordinaten vom Radix übernehmen
+CalDateTime toCalDateTime(const QDate& datum, const QTime& zeit) {
+    return { datum.year(), datum.month(), datum.day(), zeit.hour(), zeit.minute(), zeit.second() };
+}
+
+QDateTime toQDateTime(const CalDateTime& dt) {
+    return QDateTime(QDate(dt.jahr, dt.monat, dt.tag), QTime(dt.stunde, dt.minute, dt.sekunde));
+}
+
+// Zeitpunkt eines Transits aus dem Multi-Transit-Lauf (Minutengenau wie rFix)
+QDateTime transitZeitpunkt(const Radix& transit) {
+    QDate d(transit.rFix.jahr, transit.rFix.monat, transit.rFix.tag);
+    int16_t h = 0;
+    int16_t m = 0;
+    Calculations::decimalToTime(transit.rFix.zeit, h, m);
+    return QDateTime(d, QTime(h, m));
+}
+
+// Transit-Radix für einen Zeitpunkt vorbereiten: Koordinaten und
+// Häusersystem vom Radix, Datum/Zeit vom Zeitpunkt (ohne Sommerzeit)
+void setzeZeitpunkt(const Radix& radix, Radix& transit, const CalDateTime& zeitpunkt) {
     transit.rFix.laenge = radix.rFix.laenge;
     transit.rFix.breite = radix.rFix.breite;
     transit.rFix.zone = radix.rFix.zone;
-    transit.rFix.sommerzeit = 0.0;  // Transit ohne Sommerzeit
+    transit.rFix.sommerzeit = 0.0;
     
-    // Datum und Zeit setzen
-    transit.rFix.tag = datum.day();
-    transit.rFix.monat = datum.month();
-    transit.rFix.jahr = datum.year();
-    transit.rFix.zeit = Calculations::timeToDecimal(zeit.hour(), zeit.minute());
+    transit.rFix.tag = static_cast<int16_t>(zeitpunkt.tag);
+    transit.rFix.monat = static_cast<int16_t>(zeitpunkt.monat);
+    transit.rFix.jahr = static_cast<int16_t>(zeitpunkt.jahr);
+    transit.rFix.zeit = zeitpunkt.stunden();
     
-    // Häusersystem übernehmen
     transit.hausSys = radix.hausSys;
     transit.horoTyp = TYP_TRANSIT;
+}
+
+// Grenzen für adaptive Schrittweiten
+constexpr double MIN_SCHRITT = Calendar::MINUTE;
+constexpr double MAX_SCHRITT = 30.0;
+
+// Maximale Beschleunigung in Grad/Tag² (1800-2400, zweite Differenzen der
+// Längen, x1.5) - Schranke für die Interpolation in TransitSampler
+constexpr double MAX_BESCHLEUNIGUNG[MAX_PLANET] = {
+    0.001,      // Sonne
+    0.8,        // Mond
+    0.3,        // Merkur
+    0.065,      // Venus
+    0.025,      // Mars
+    0.0055,     // Jupiter
+    0.003,      // Saturn
+    0.0015,     // Uranus
+    0.001,      // Neptun
+    0.001,      // Pluto
+    0.08,       // Wahrer Knoten
+    0.00003,    // Lilith
+    0.003,      // Chiron
+    0.012,      // Ceres
+    0.019,      // Pallas
+    0.015,      // Juno
+    0.013       // Vesta
+};
+
+// Sprünge an den Segmentgrenzen der Ephemeriden-Dateien (gemessen bis 0.002°)
+constexpr double EPHE_SPRUNG = 0.005;
+
+constexpr int ASPEKT_WINKEL[ASPEKTE] = {
+    KONJUNKTION, HALBSEX, SEXTIL, QUADRATUR, TRIGON, QUINCUNX, OPOSITION
+};
+
+// Orbis für Aspekt a des Transit-Planeten tp (Legacy-Indizierung a * stride + tp)
+double orbFuer(const QVector<float>& orben, int stride, int a, int tp) {
+    return (orben.size() > a * stride + tp) ? orben[a * stride + tp] : 8.0f;
+}
+
+// Erster Aspekt innerhalb des Orbis (wie im Legacy). abstand wird auf den
+// kleinsten Abstand einer geprüften Orbis-Grenze gesenkt - solange sich die
+// Position um weniger bewegt, bleibt das Ergebnis gleich.
+int16_t findeAspekt(double pos, double ziel, const QVector<float>& orben, int stride, int tp,
+                    double& abstand) {
+    for (int a = 0; a < ASPEKTE; ++a) {
+        const double orb = orbFuer(orben, stride, a, tp);
+        double exakterWinkel;
+        const bool treffer = Calculations::checkAspekt(pos, ziel, ASPEKT_WINKEL[a], orb, exakterWinkel);
+        abstand = std::min(abstand, std::fabs(std::fabs(exakterWinkel - ASPEKT_WINKEL[a]) - orb));
+        if (treffer) {
+            return static_cast<int16_t>(ASPEKT_WINKEL[a]);
+        }
+    }
+    return KEIN_ASP;
+}
+
+/**
+ * Planeten-Längen für calcMultiTransit ohne Transit-Radix.
+ *
+ * Jeder Körper wird nur an Stützstellen exakt berechnet, im Abstand
+ * passend zu seiner Bewegung und seinem kleinsten Orbis; dazwischen wird
+ * linear interpoliert (Steigung m). fehler() ist eine sichere Schranke für
+ * die Abweichung der wahren Länge von der Geraden, das Minimum aus
+ *   - Geschwindigkeit: höchstens v, also ein Band um beide Stützstellen
+ *     (in der Mitte (v - |m|) * h / 2)
+ *   - Beschleunigung: höchstens a, also a * (t - t0) * (t1 - t) / 2
+ * zuzüglich EPHE_SPRUNG. Liegt eine Orbis-Grenze innerhalb dieser Schranke,
+ * rechnet der Aufrufer mit refine() exakt nach - die Aspekt-Sequenzen sind
+ * damit dieselben wie bei Berechnung jedes Schritts.
+ */
+class TransitSampler {
+public:
+    TransitSampler(const Radix& radix, const TransitStep& schritt, const CalDateTime& start,
+                   int anzahl, const QVector<float>& orbenPlanet, const QVector<float>& orbenHaus,
+                   const EpheContext& ctx)
+        : m_schritt(schritt)
+        , m_start(start)
+        , m_zone(radix.rFix.zone)
+        , m_last(std::max(anzahl - 1, 0))
+        , m_ctx(ctx)
+        , m_koerper(radix.anzahlPlanet) {
+        // Nominelle Schrittweite (Monate/Jahre: längste Dauer)
+        double dauer = schritt.duration();
+        if (schritt.isCalendar()) {
+            dauer = (schritt.inkrement == INC_JAHRE) ? 366.0 : 31.0;
+        }
+        
+        for (int tp = 0; tp < m_koerper.size(); ++tp) {
+            Koerper& k = m_koerper[tp];
+            k.bewegung = TransitCalc::maxDailyMotion(tp);
+            k.beschleunigung = (tp < MAX_PLANET) ? MAX_BESCHLEUNIGUNG[tp] : 0.0;
+            
+            double orb = DEGHALB;
+            for (int a = 0; a < ASPEKTE; ++a) {
+                for (double o : { orbFuer(orbenPlanet, MAX_PLANET, a, tp),
+                                  orbFuer(orbenHaus, MAX_HAUS, a, tp) }) {
+                    if (o > 0.0) {
+                        orb = std::min(orb, o);
+                    }
+                }
+            }
+            
+            // Abstand, bei dem die Schranke in der Intervallmitte etwa ein
+            // Viertel des Orbis erreicht - nachgerechnet wird nur nahe den Grenzen
+            if (k.bewegung > 0.0 && k.beschleunigung > 0.0 && dauer > 0.0) {
+                double h = std::max(orb / (4.0 * k.bewegung), std::sqrt(2.0 * orb / k.beschleunigung));
+                h = std::min(h, 90.0 / k.bewegung);  // Interpolation eindeutig
+                const double takt = std::floor(h / dauer);
+                k.takt = static_cast<int>(std::clamp(takt, 1.0, static_cast<double>(m_last + 1)));
+            }
+        }
+    }
+    
+    void setStep(int idx) {
+        m_idx = idx;
+        m_jd = jdAt(idx);
+    }
+    
+    double jd() const { return m_jd; }
+    
+    double position(int tp) {
+        Koerper& k = m_koerper[tp];
+        if (k.s0 < 0 || m_idx >= k.s1) {
+            // Neues Intervall ab dem aktuellen Schritt
+            if (k.s0 >= 0 && m_idx == k.s1) {
+                k.s0 = k.s1;
+                k.t0 = k.t1;
+                k.x0 = k.x1;
+            } else {
+                k.s0 = m_idx;
+                k.t0 = m_jd;
+                k.x0 = exact(tp, m_jd);
+            }
+            k.s1 = std::min(k.s0 + k.takt, std::max(m_last, k.s0));
+            k.t1 = (k.s1 > k.s0) ? jdAt(k.s1) : k.t0;
+            k.x1 = (k.s1 > k.s0) ? exact(tp, k.t1) : k.x0;
+        }
+        if (m_idx == k.s0) {
+            return k.x0;
+        }
+        const double anteil = (m_jd - k.t0) / (k.t1 - k.t0);
+        return Calculations::mod360(k.x0 + anteil * Calculations::minDist(k.x0, k.x1));
+    }
+    
+    double fehler(int tp) const {
+        const Koerper& k = m_koerper[tp];
+        if (m_idx == k.s0) {
+            return 0.0;
+        }
+        const double v = k.bewegung;
+        const double m = Calculations::minDist(k.x0, k.x1) / (k.t1 - k.t0);
+        if (std::fabs(m) > v) {
+            return DEGMAX;  // Schranke verletzt - immer exakt rechnen
+        }
+        const double tau0 = m_jd - k.t0;
+        const double tau1 = k.t1 - m_jd;
+        const double oben = std::min((v - m) * tau0, (v + m) * tau1);
+        const double unten = std::min((v + m) * tau0, (v - m) * tau1);
+        const double krumm = k.beschleunigung * tau0 * tau1 / 2.0;
+        return std::min(std::max(oben, unten), krumm) + EPHE_SPRUNG;
+    }
+    
+    double refine(int tp) {
+        Koerper& k = m_koerper[tp];
+        k.s0 = m_idx;
+        k.t0 = m_jd;
+        k.x0 = exact(tp, m_jd);
+        return k.x0;
+    }
+    
+private:
+    struct Koerper {
+        double bewegung = 0.0;  // Maximale Tagesbewegung
+        double beschleunigung = 0.0;
+        int    takt = 1;        // Stützstellen-Abstand in Schritten
+        int    s0 = -1;         // Stützstellen (Schritt, JD, Länge)
+        int    s1 = -1;
+        double t0 = 0.0;
+        double t1 = 0.0;
+        double x0 = 0.0;
+        double x1 = 0.0;
+    };
+    
+    // Gleiches JD wie ChartCalc::calculate für den Transit-Radix
+    double jdAt(int idx) const {
+        const CalDateTime z = m_schritt.advance(m_start, idx);
+        return Calculations::julianDay(static_cast<int16_t>(z.tag), static_cast<int16_t>(z.monat),
+                                       static_cast<int16_t>(z.jahr), z.stunden() - m_zone, true);
+    }
+    
+    // Wie ChartCalc::calcPlanets: 0 bei Fehler
+    double exact(int tp, double jd) const {
+        ASTRO_COUNT("TransitCalc::calcMultiTransit/Stützstellen", 1);
+        const PlanetPos pos = m_ctx.calcPlanet(tp, jd);
+        return pos.ok() ? pos.longitude : 0.0;
+    }
+    
+    const TransitStep& m_schritt;
+    CalDateTime m_start;
+    double m_zone;
+    int m_last;
+    const EpheContext& m_ctx;
+    QVector<Koerper> m_koerper;
+    int m_idx = 0;
+    double m_jd = 0.0;
+};
+
+} // namespace
+
+//==============================================================================
+// Schrittweite
+//==============================================================================
+
+TransitStep TransitStep::adaptive(const QVector<int>& planeten, double orb) {
+    double maxBewegung = 0.0;
+    for (int planet : planeten) {
+        maxBewegung = std::max(maxBewegung, TransitCalc::maxDailyMotion(planet));
+    }
+    if (maxBewegung <= 0.0 || orb <= 0.0) {
+        return fixed(INC_TAGE);
+    }
+    
+    // Orbis-Bereich (2 x orb) in mindestens vier Schritten, auf ganze Minuten
+    double tage = std::clamp(2.0 * orb / (4.0 * maxBewegung), MIN_SCHRITT, MAX_SCHRITT);
+    tage = std::floor(tage / Calendar::MINUTE) * Calendar::MINUTE;
+    return days(std::max(tage, MIN_SCHRITT));
+}
+
+bool TransitStep::isValid() const {
+    if (tage > 0.0) {
+        return std::isfinite(tage) && tage * Calendar::SEKUNDEN_PRO_TAG >= 1.0;
+    }
+    return isCalendar() || duration() > 0.0;
+}
+
+double TransitStep::duration() const {
+    if (tage > 0.0) {
+        return tage;
+    }
+    switch (inkrement) {
+        case INC_MINUTEN: return Calendar::MINUTE;
+        case INC_STUNDEN: return Calendar::STUNDE;
+        case INC_TAGE:    return 1.0;
+        case INC_WOCHEN:  return 7.0;
+        default:          return 0.0;
+    }
+}
+
+CalDateTime TransitStep::advance(const CalDateTime& start, int n) const {
+    if (isCalendar()) {
+        return Calendar::addMonths(start, inkrement == INC_JAHRE ? n * 12 : n);
+    }
+    return Calendar::fromJD(Calendar::toJD(start) + n * duration());
+}
+
+int TransitStep::count(const CalDateTime& start, const CalDateTime& ende) const {
+    const double startJD = Calendar::toJD(start);
+    const double endJD = Calendar::toJD(ende);
+    if (!isValid() || endJD < startJD) {
+        return 0;
+    }
+    
+    // Schätzung, dann auf die Rundung von advance() abgleichen
+    int n;
+    if (isCalendar()) {
+        const int monate = (inkrement == INC_JAHRE) ? 12 : 1;
+        n = ((ende.jahr - start.jahr) * 12 + (ende.monat - start.monat)) / monate;
+    } else {
+        const double schaetzung = std::floor((endJD - startJD) / duration());
+        if (schaetzung >= std::numeric_limits<int>::max() - 1) {
+            return std::numeric_limits<int>::max();
+        }
+        n = static_cast<int>(schaetzung);
+    }
+    while (n > 0 && Calendar::toJD(advance(start, n)) > endJD) {
+        --n;
+    }
+    while (Calendar::toJD(advance(start, n + 1)) <= endJD) {
+        ++n;
+    }
+    return n + 1;
+}
+
+double TransitCalc::maxDailyMotion(int planet) {
+    // Grad/Tag: Maximum über 1800-2400 aus den mitgelieferten Ephemeriden,
+    // aufgerundet. Obere Schranke - TransitSampler verlässt sich darauf.
+    static const double bewegung[MAX_PLANET] = {
+        1.05,   // Sonne    (1.020)
+        15.5,   // Mond     (15.401)
+        2.3,    // Merkur   (2.203)
+        1.3,    // Venus    (1.259)
+        0.85,   // Mars     (0.792)
+        0.26,   // Jupiter  (0.243)
+        0.14,   // Saturn   (0.134)
+        0.07,   // Uranus   (0.065)
+        0.05,   // Neptun   (0.043)
+        0.05,   // Pluto    (0.041)
+        0.45,   // Wahrer Knoten (0.384)
+        0.12,   // Lilith   (0.112)
+        0.16,   // Chiron   (0.148)
+        0.5,    // Ceres    (0.461)
+        0.65,   // Pallas   (0.612)
+        0.65,   // Juno     (0.599)
+        0.6     // Vesta    (0.543)
+    };
+    if (planet < 0 || planet >= MAX_PLANET) {
+        return 0.0;
+    }
+    return bewegung[planet];
+}
+
+int TransitCalc::stepCount(const QDate& startDatum, const QTime& startZeit,
+                           const QDate& endDatum, const QTime& endZeit,
+                           const TransitStep& schritt) {
+    return schritt.count(toCalDateTime(startDatum, startZeit), toCalDateTime(endDatum, endZeit));
+}
+
+//==============================================================================
+// Transit-Berechnung
+//==============================================================================
+
+int TransitCalc::calcTransit(const Radix& radix, Radix& transit,
+                             const QDate& datum, const QTime& zeit,
+                             const EpheContext& ctx) {
+    return calcTransit(radix, transit, toCalDateTime(datum, zeit), ctx);
+}
+
+int TransitCalc::calcTransit(const Radix& radix, Radix& transit,
+                             const CalDateTime& zeitpunkt,
+                             const EpheContext& ctx) {
+    ASTRO_TIMER("TransitCalc::calcTransit");
+    // Transit-Radix initialisieren
+    transit.clear();
+    transit.allocate(radix.anzahlPlanet);
+    setzeZeitpunkt(radix, transit, zeitpunkt);
     
     // Berechnen
-    return ChartCalc::calculate(transit, nullptr, TYP_TRANSIT);
+    return ChartCalc::calculate(transit, nullptr, TYP_TRANSIT, ctx);
 }
 
 int TransitCalc::calcMultiTransit(const Radix& radix,
@@ -51,17 +399,80 @@ int TransitCalc::calcMultiTransit(const Radix& radix,
                                  const QVector<float>& orbenPlanet,
                                  const QVector<float>& orbenHaus,
                                  bool* abortFlag,
-                                 const std::function<void(int,const QDate&,const QTime&)>& progressCb) {
+                                 const std::function<void(int,const QDate&,const QTime&)>& progressCb,
+                                 const EpheContext& ctx) {
+    return calcMultiTransit(radix, startDatum, startZeit, endDatum, endZeit,
+                            TransitStep::fixed(inkrement), transits, aspekte,
+                            orbenPlanet, orbenHaus, abortFlag, progressCb, ctx);
+}
+
+int TransitCalc::calcMultiTransit(const Radix& radix,
+                                 const QDate& startDatum,
+                                 const QTime& startZeit,
+                                 const QDate& endDatum,
+                                 const QTime& endZeit,
+                                 const TransitStep& schritt,
+                                 QVector<Radix>* transits,
+                                 QVector<TransitAspekt>* aspekte,
+                                 const QVector<float>& orbenPlanet,
+                                 const QVector<float>& orbenHaus,
+                                 bool* abortFlag,
+                                 const std::function<void(int,const QDate&,const QTime&)>& progressCb,
+                                 const EpheContext& ctx) {
+    ASTRO_TIMER("TransitCalc::calcMultiTransit");
     // STRICT LEGACY: Port von sCalcMultiTransit(RADIX*, short)
     // Iteriert vom Start- bis Enddatum mit angegebenem Inkrement und berechnet
     // für jeden Schritt ein Transit-Radix. Zusätzlich werden Aspekt-Sequenzen
     // gesammelt (Planet-Planet und Planet-Haus).
     
-    QDate datum = startDatum;
-    QTime zeit = startZeit;
+    if (!schritt.isValid()) {
+        return ERR_INC;
+    }
+    
+    // Jeder Schritt wird vom Start aus gerechnet (JD + n * Schrittweite),
+    // dadurch summieren sich keine Rundungsfehler auf
+    const CalDateTime start = toCalDateTime(startDatum, startZeit);
+    const double endJD = Calendar::toJD(toCalDateTime(endDatum, endZeit));
+    CalDateTime zeitpunkt = start;
     
     const int numPlanets = radix.anzahlPlanet;
     
+    // Für die Aspekt-Suche genügen die Planeten-Längen - jeder Körper
+    // wird in seinem eigenen Takt berechnet
+    TransitSampler sampler(radix, schritt, start, schritt.count(start, toCalDateTime(endDatum, endZeit)),
+                           orbenPlanet, orbenHaus, ctx);
+    
+    // Transit-Radixe werden nur für die Schritte voll berechnet, auf die eine
+    // Sequenz verweist (Beginn/Ende) sowie für den ersten und letzten;
+    // alle anderen tragen nur den Zeitpunkt (anzahlPlanet == 0)
+    QVector<bool> berechnet;
+    auto schnappschuss = [&](int i) {
+        if (!transits || berechnet[i]) {
+            return static_cast<int>(ERR_OK);
+        }
+        berechnet[i] = true;
+        return calcTransit(radix, (*transits)[i], schritt.advance(start, i), ctx);
+    };
+    
+    // Aspekte des aktuellen Schritts
+    QVector<int16_t> aspPlanet(numPlanets * numPlanets, KEIN_ASP);
+    QVector<int16_t> aspHaus(numPlanets * MAX_HAUS, KEIN_ASP);
+    
+    // Aspekte eines Transit-Planeten zu allen Radix-Planeten und -Häusern;
+    // liefert den kleinsten Abstand einer geprüften Orbis-Grenze
+    auto klassifiziere = [&](int tp, double pos) {
+        double abstand = DEGMAX;
+        for (int rp = 0; rp < numPlanets; ++rp) {
+            aspPlanet[tp * numPlanets + rp] =
+                findeAspekt(pos, radix.planet[rp], orbenPlanet, MAX_PLANET, tp, abstand);
+        }
+        for (int h = 0; h < MAX_HAUS; ++h) {
+            aspHaus[tp * MAX_HAUS + h] =
+                findeAspekt(pos, radix.haus[h], orbenHaus, MAX_HAUS, tp, abstand);
+        }
+        return abstand;
+    };
+    
     // Laufende Sequenzen speichern
     QVector<int16_t> curAspPlanet(numPlanets * numPlanets, KEIN_ASP);
     QVector<int>    startAspPlanet(numPlanets * numPlanets, -1);
@@ -76,38 +487,56 @@ int TransitCalc::calcMultiTransit(const Radix& radix,
         }
         
         // Abbruchbedingung: Datum/Zeit > Ende
-        if (datum > endDatum || (datum == endDatum && zeit > endZeit)) {
+        if (Calendar::toJD(zeitpunkt) > endJD) {
             break;
         }
         
-        Radix transit;
-        int res = calcTransit(radix, transit, datum, zeit);
-        if (res != ERR_OK) {
-            return res;
+        ASTRO_COUNT("TransitCalc::calcMultiTransit/Schritte", 1);
+        
+        sampler.setStep(idx);
+        const double jd = sampler.jd();
+        for (int tp = 0; tp < numPlanets; ++tp) {
+            // Interpolierte Position reicht, solange keine Orbis-Grenze
+            // innerhalb der Fehlerschranke liegt
+            const double abstand = klassifiziere(tp, sampler.position(tp));
+            if (abstand <= sampler.fehler(tp)) {
+                klassifiziere(tp, sampler.refine(tp));
+            }
+        }
+        
+        if (transits) {
+            Radix transit;
+            transit.allocate(0);
+            transit.anzahlPlanet = 0;   // allocate() setzt über clear() zurück
+            setzeZeitpunkt(radix, transit, zeitpunkt);
+            transit.jd = jd;
+            transits->append(transit);
+            berechnet.append(false);
+            if (idx == 0) {
+                if (int res = schnappschuss(idx); res != ERR_OK) {
+                    return res;
+                }
+            }
         }
         
-        // Aspekt-Ermittlung Transit-Planet zu Radix-Planet
+        // Sequenzen Transit-Planet zu Radix-Planet
         for (int tp = 0; tp < numPlanets; ++tp) {
             for (int rp = 0; rp < numPlanets; ++rp) {
                 int pairIdx = tp * numPlanets + rp;
-                
-                int16_t aspFound = KEIN_ASP;
-                static const int aspektWinkel[] = { KONJUNKTION, HALBSEX, SEXTIL, QUADRATUR, TRIGON, QUINCUNX, OPOSITION };
-                
-                for (int a = 0; a < ASPEKTE; ++a) {
-                    int aspekt = aspektWinkel[a];
-                    float orb = (orbenPlanet.size() > a * MAX_PLANET + tp)
-                        ? orbenPlanet[a * MAX_PLANET + tp]
-                        : 8.0f;
-                    
-                    double exakterWinkel;
-                    if (Calculations::checkAspekt(transit.planet[tp], radix.planet[rp], aspekt, orb, exakterWinkel)) {
-                        aspFound = static_cast<int16_t>(aspekt);
-                        break;
-                    }
-                }
+                int16_t aspFound = aspPlanet[pairIdx];
                 
                 if (aspFound != curAspPlanet[pairIdx]) {
+                    // Beginn und Ende der Sequenzen voll berechnen
+                    const int res = (aspFound != KEIN_ASP) ? schnappschuss(idx) : ERR_OK;
+                    if (res != ERR_OK) {
+                        return res;
+                    }
+                    if (curAspPlanet[pairIdx] != KEIN_ASP && idx > 0) {
+                        if (int res2 = schnappschuss(idx - 1); res2 != ERR_OK) {
+                            return res2;
+                        }
+                    }
+                    
                     // Sequenz beenden
                     if (curAspPlanet[pairIdx] != KEIN_ASP && startAspPlanet[pairIdx] >= 0 && aspekte) {
                         TransitAspekt ta;
@@ -118,19 +547,15 @@ int TransitCalc::calcMultiTransit(const Radix& radix,
                         ta.startIndex = startAspPlanet[pairIdx];
                         ta.endIndex = idx - 1;
                         ta.transitIndex = startAspPlanet[pairIdx];
-                        ta.retrograde = swissEph().isRetrograde(tp, transit.jd);
+                        ta.retrograde = ctx.isRetrograde(tp, jd);
                         ta.applying = false;
                         ta.orb = 0.0;
                         
                         // Zeitpunkt vom Start-Transit ableiten
                         if (transits && startAspPlanet[pairIdx] < transits->size()) {
-                            const Radix& trStart = transits->at(startAspPlanet[pairIdx]);
-                            QDate d(trStart.rFix.jahr, trStart.rFix.monat, trStart.rFix.tag);
-                            int h = static_cast<int>(trStart.rFix.zeit);
-                            int m = static_cast<int>(std::round((trStart.rFix.zeit - h) * 60.0));
-                            ta.zeitpunkt = QDateTime(d, QTime(h, m));
+                            ta.zeitpunkt = transitZeitpunkt(transits->at(startAspPlanet[pairIdx]));
                         } else {
-                            ta.zeitpunkt = QDateTime(datum, zeit);
+                            ta.zeitpunkt = toQDateTime(zeitpunkt);
                         }
                         
                         aspekte->append(ta);
@@ -143,28 +568,23 @@ int TransitCalc::calcMultiTransit(const Radix& radix,
             }
         }
         
-        // Aspekt-Ermittlung Transit-Planet zu Radix-Haus
+        // Sequenzen Transit-Planet zu Radix-Haus
         for (int tp = 0; tp < numPlanets; ++tp) {
             for (int h = 0; h < MAX_HAUS; ++h) {
                 int pairIdx = tp * MAX_HAUS + h;
-                
-                int16_t aspFound = KEIN_ASP;
-                static const int aspektWinkel[] = { KONJUNKTION, HALBSEX, SEXTIL, QUADRATUR, TRIGON, QUINCUNX, OPOSITION };
-                
-                for (int a = 0; a < ASPEKTE; ++a) {
-                    int aspekt = aspektWinkel[a];
-                    float orb = (orbenHaus.size() > a * MAX_HAUS + tp)
-                        ? orbenHaus[a * MAX_HAUS + tp]
-                        : 8.0f;
-                    
-                    double exakterWinkel;
-                    if (Calculations::checkAspekt(transit.planet[tp], radix.haus[h], aspekt, orb, exakterWinkel)) {
-                        aspFound = static_cast<int16_t>(aspekt);
-                        break;
-                    }
-                }
+                int16_t aspFound = aspHaus[pairIdx];
                 
                 if (aspFound != curAspHaus[pairIdx]) {
+                    const int res = (aspFound != KEIN_ASP) ? schnappschuss(idx) : ERR_OK;
+                    if (res != ERR_OK) {
+                        return res;
+                    }
+                    if (curAspHaus[pairIdx] != KEIN_ASP && idx > 0) {
+                        if (int res2 = schnappschuss(idx - 1); res2 != ERR_OK) {
+                            return res2;
+                        }
+                    }
+                    
                     if (curAspHaus[pairIdx] != KEIN_ASP && startAspHaus[pairIdx] >= 0 && aspekte) {
                         TransitAspekt ta;
                         ta.transitPlanet = tp;
@@ -174,18 +594,14 @@ int TransitCalc::calcMultiTransit(const Radix& radix,
                         ta.startIndex = startAspHaus[pairIdx];
                         ta.endIndex = idx - 1;
                         ta.transitIndex = startAspHaus[pairIdx];
-                        ta.retrograde = swissEph().isRetrograde(tp, transit.jd);
+                        ta.retrograde = ctx.isRetrograde(tp, jd);
                         ta.applying = false;
                         ta.orb = 0.0;
                         
                         if (transits && startAspHaus[pairIdx] < transits->size()) {
-                            const Radix& trStart = transits->at(startAspHaus[pairIdx]);
-                            QDate d(trStart.rFix.jahr, trStart.rFix.monat, trStart.rFix.tag);
-                            int h0 = static_cast<int>(trStart.rFix.zeit);
-                            int m0 = static_cast<int>(std::round((trStart.rFix.zeit - h0) * 60.0));
-                            ta.zeitpunkt = QDateTime(d, QTime(h0, m0));
+                            ta.zeitpunkt = transitZeitpunkt(transits->at(startAspHaus[pairIdx]));
                         } else {
-                            ta.zeitpunkt = QDateTime(datum, zeit);
+                            ta.zeitpunkt = toQDateTime(zeitpunkt);
                         }
                         
                         aspekte->append(ta);
@@ -197,18 +613,20 @@ int TransitCalc::calcMultiTransit(const Radix& radix,
             }
         }
         
-        if (transits) {
-            transits->append(transit);
-        }
-        
         if (progressCb) {
-            progressCb(idx, datum, zeit);
+            const QDateTime dt = toQDateTime(zeitpunkt);
+            progressCb(idx, dt.date(), dt.time());
         }
         ++idx;
         
         // Nächster Schritt
-        if (incDate(datum, zeit, inkrement, 1) != ERR_OK) {
-            break;
+        zeitpunkt = schritt.advance(start, idx);
+    }
+    
+    // Letzter Schritt: Ende aller laufenden Sequenzen und des Zeitraums
+    if (idx > 0) {
+        if (int res = schnappschuss(idx - 1); res != ERR_OK) {
+            return res;
         }
     }
     
@@ -230,11 +648,7 @@ int TransitCalc::calcMultiTransit(const Radix& radix,
                     ta.applying = false;
                     ta.orb = 0.0;
                     if (transits && startAspPlanet[pairIdx] < transits->size()) {
-                        const Radix& trStart = transits->at(startAspPlanet[pairIdx]);
-                        QDate d(trStart.rFix.jahr, trStart.rFix.monat, trStart.rFix.tag);
-                        int h = static_cast<int>(trStart.rFix.zeit);
-                        int m = static_cast<int>(std::round((trStart.rFix.zeit - h) * 60.0));
-                        ta.zeitpunkt = QDateTime(d, QTime(h, m));
+                        ta.zeitpunkt = transitZeitpunkt(transits->at(startAspPlanet[pairIdx]));
                     }
                     aspekte->append(ta);
                 }
@@ -256,11 +670,7 @@ int TransitCalc::calcMultiTransit(const Radix& radix,
                     ta.applying = false;
                     ta.orb = 0.0;
                     if (transits && startAspHaus[pairIdx] < transits->size()) {
-                        const Radix& trStart = transits->at(startAspHaus[pairIdx]);
-                        QDate d(trStart.rFix.jahr, trStart.rFix.monat, trStart.rFix.tag);
-                        int h0 = static_cast<int>(trStart.rFix.zeit);
-                        int m0 = static_cast<int>(std::round((trStart.rFix.zeit - h0) * 60.0));
-                        ta.zeitpunkt = QDateTime(d, QTime(h0, m0));
+                        ta.zeitpunkt = transitZeitpunkt(transits->at(startAspHaus[pairIdx]));
                     }
                     aspekte->append(ta);
                 }
@@ -277,7 +687,8 @@ int TransitCalc::calcMultiTransit(const Radix& radix,
 
 int TransitCalc::calcRetrograde(int planet, const QDate& startDatum, 
                                 const QDate& endDatum,
-                                QVector<QPair<QDate, QDate>>& perioden) {
+                                QVector<QPair<QDate, QDate>>& perioden,
+                                const EpheContext& ctx) {
     perioden.clear();
     
     // Sonne und Mond sind nie rückläufig
@@ -286,12 +697,10 @@ int TransitCalc::calcRetrograde(int planet, const QDate& startDatum,
     }
     
     // Start-JD berechnen
-    double startJD = Calculations::julianDay(
-        startDatum.day(), startDatum.month(), startDatum.year(), 12.0, true);
-    double endJD = Calculations::julianDay(
-        endDatum.day(), endDatum.month(), endDatum.year(), 12.0, true);
+    double startJD = Calendar::toJD(startDatum.year(), startDatum.month(), startDatum.day(), 12.0);
+    double endJD = Calendar::toJD(endDatum.year(), endDatum.month(), endDatum.day(), 12.0);
     
-    bool wasRetro = swissEph().isRetrograde(planet, startJD);
+    bool wasRetro = ctx.isRetrograde(planet, startJD);
     QDate retroStart;
     
     if (wasRetro) {
@@ -300,40 +709,16 @@ int TransitCalc::calcRetrograde(int planet, const QDate& startDatum,
     
     // Tagesweise durchgehen
     for (double jd = startJD; jd <= endJD; jd += 1.0) {
-        bool isRetro = swissEph().isRetrograde(planet, jd);
+        bool isRetro = ctx.isRetrograde(planet, jd);
         
         if (isRetro && !wasRetro) {
             // Beginn einer Rückläufigkeit
-            // JD in Datum umrechnen
-            int y, m, d;
-            double h;
-            // Vereinfachte Umrechnung
-            double z = jd + 0.5;
-            int a = static_cast<int>(z);
-            int b = a + 1524;
-            int c = static_cast<int>((b - 122.1) / 365.25);
-            int dd = static_cast<int>(365.25 * c);
-            int e = static_cast<int>((b - dd) / 30.6001);
-            d = b - dd - static_cast<int>(30.6001 * e);
-            m = (e < 14) ? e - 1 : e - 13;
-            y = (m > 2) ? c - 4716 : c - 4715;
-            
-            retroStart = QDate(y, m, d);
+            const CalDateTime dt = Calendar::fromJD(jd);
+            retroStart = QDate(dt.jahr, dt.monat, dt.tag);
         } else if (!isRetro && wasRetro) {
             // Ende einer Rückläufigkeit
-            int y, m, d;
-            double z = jd + 0.5;
-            int a = static_cast<int>(z);
-            int b = a + 1524;
-            int c = static_cast<int>((b - 122.1) / 365.25);
-            int dd = static_cast<int>(365.25 * c);
-            int e = static_cast<int>((b - dd) / 30.6001);
-            d = b - dd - static_cast<int>(30.6001 * e);
-            m = (e < 14) ? e - 1 : e - 13;
-            y = (m > 2) ? c - 4716 : c - 4715;
-            
-            QDate retroEnd(y, m, d);
-            perioden.append(qMakePair(retroStart, retroEnd));
+            const CalDateTime dt = Calendar::fromJD(jd);
+            perioden.append(qMakePair(retroStart, QDate(dt.jahr, dt.monat, dt.tag)));
         }
         
         wasRetro = isRetro;
@@ -352,38 +737,21 @@ int TransitCalc::calcRetrograde(int planet, const QDate& startDatum,
 //==============================================================================
 
 int TransitCalc::incDate(QDate& datum, QTime& zeit, int inkrement, int anzahl) {
-    switch (inkrement) {
-        case INC_MINUTEN:
-            zeit = zeit.addSecs(anzahl * 60);
-            if (zeit.hour() < 0) {
-                datum = datum.addDays(-1);
-            }
-            break;
-            
-        case INC_STUNDEN:
-            zeit = zeit.addSecs(anzahl * 3600);
-            break;
-            
-        case INC_TAGE:
-            datum = datum.addDays(anzahl);
-            break;
-            
-        case INC_WOCHEN:
-            datum = datum.addDays(anzahl * 7);
-            break;
-            
-        case INC_MONATE:
-            datum = datum.addMonths(anzahl);
-            break;
-            
-        case INC_JAHRE:
-            datum = datum.addYears(anzahl);
-            break;
-            
-        default:
-            return ERR_INC;
+    CalDateTime dt = toCalDateTime(datum, zeit);
+    int res = incDate(dt, inkrement, anzahl);
+    if (res == ERR_OK) {
+        datum = QDate(dt.jahr, dt.monat, dt.tag);
+        zeit = QTime(dt.stunde, dt.minute, dt.sekunde);
     }
-    
+    return res;
+}
+
+int TransitCalc::incDate(CalDateTime& zeitpunkt, int inkrement, int anzahl) {
+    const TransitStep schritt = TransitStep::fixed(inkrement);
+    if (!schritt.isValid()) {
+        return ERR_INC;
+    }
+    zeitpunkt = schritt.advance(zeitpunkt, anzahl);
     return ERR_OK;
 }
 
@@ -392,48 +760,47 @@ int TransitCalc::incDate(QDate& datum, QTime& zeit, int inkrement, int anzahl) {
 //==============================================================================
 
 double TransitCalc::findExactAspect(double radixPlanet, int transitPlanet,
-                                    int aspekt, double startJD, int richtung) {
+                                    int aspekt, double startJD, int richtung,
+                                    const EpheContext& ctx) {
     const double PRECISION = 0.0001;  // ~8 Sekunden
+    const double GENAU = 0.01;        // Grad - sonst nur Annäherung
     const double MAX_DAYS = 365.0;    // Maximal 1 Jahr suchen
     
-    double jd = startJD;
-    double step = richtung * 1.0;  // 1 Tag
+    auto abstand = [&](double jd) {
+        double diff = std::fabs(Calculations::minDist(ctx.calcPlanetLongitude(transitPlanet, jd),
+                                                      radixPlanet));
+        return std::fabs(diff - aspekt);
+    };
     
-    // Grobe Suche
-    double lastDiff = 999.0;
-    for (int i = 0; i < MAX_DAYS; ++i) {
-        double transitPos = swissEph().calcPlanetLongitude(transitPlanet, jd);
-        if (transitPos < 0) return -1;
+    // Grobe Suche in Tagesschritten
+    double jd = startJD;
+    for (int i = 0; i < MAX_DAYS; ++i, jd += richtung * 1.0) {
+        if (ctx.calcPlanetLongitude(transitPlanet, jd) < 0) return -1;
         
-        double diff = std::fabs(Calculations::minDist(transitPos, radixPlanet));
-        double aspDiff = std::fabs(diff - aspekt);
+        double aspDiff = abstand(jd);
+        if (aspDiff >= 1.0) {
+            continue;
+        }
         
-        if (aspDiff < 1.0) {
-            // Feine Suche
-            step = richtung * 0.01;  // ~15 Minuten
+        // Feine Suche, nie hinter startJD zurück - sonst findet die Suche
+        // ab "letzter Treffer + 1 Tag" denselben Aspekt immer wieder
+        double best = jd;
+        double step = richtung * 0.01;  // ~15 Minuten
+        while (std::fabs(step) > PRECISION && aspDiff >= PRECISION) {
+            double newJD = best + step;
+            double newAspDiff = ((newJD - startJD) * richtung < 0) ? aspDiff : abstand(newJD);
             
-            while (std::fabs(step) > PRECISION) {
-                double newJD = jd + step;
-                double newPos = swissEph().calcPlanetLongitude(transitPlanet, newJD);
-                double newDiff = std::fabs(Calculations::minDist(newPos, radixPlanet));
-                double newAspDiff = std::fabs(newDiff - aspekt);
-                
-                if (newAspDiff < aspDiff) {
-                    jd = newJD;
-                    aspDiff = newAspDiff;
-                } else {
-                    step /= -2.0;  // Richtung wechseln und halbieren
-                }
-                
-                if (aspDiff < PRECISION) {
-                    return jd;
-                }
+            if (newAspDiff < aspDiff) {
+                best = newJD;
+                aspDiff = newAspDiff;
+            } else {
+                step /= -2.0;  // Richtung wechseln und halbieren
             }
-            return jd;
         }
-        
-        lastDiff = aspDiff;
-        jd += step;
+        if (aspDiff < GENAU) {
+            return best;
+        }
+        // Orbis beim Start schon im Ablösen oder Umkehr vor dem Aspekt: weitersuchen
     }
     
     return -1;  // Nicht gefunden
@@ -454,17 +821,16 @@ int TransitCalc::findAspectsInRange(const Radix& radix,
                                     const QDate& startDatum,
                                     const QDate& endDatum,
                                     const QVector<float>& orben,
-                                    QVector<TransitAspekt>& aspekte) {
+                                    QVector<TransitAspekt>& aspekte,
+                                    const EpheContext& ctx) {
     aspekte.clear();
     
     static const int aspektWinkel[] = {
         KONJUNKTION, HALBSEX, SEXTIL, QUADRATUR, TRIGON, QUINCUNX, OPOSITION
     };
     
-    double startJD = Calculations::julianDay(
-        startDatum.day(), startDatum.month(), startDatum.year(), 0.0, true);
-    double endJD = Calculations::julianDay(
-        endDatum.day(), endDatum.month(), endDatum.year(), 24.0, true);
+    double startJD = Calendar::toJD(startDatum.year(), startDatum.month(), startDatum.day(), 0.0);
+    double endJD = Calendar::toJD(endDatum.year(), endDatum.month(), endDatum.day(), 24.0);
     
     // Für jeden Transit-Planeten
     for (int tp = 0; tp < radix.anzahlPlanet; ++tp) {
@@ -479,42 +845,28 @@ int TransitCalc::findAspectsInRange(const Radix& radix,
                             orben[a * MAX_PLANET + tp] : 8.0f;
                 
                 // Suche exakten Aspekt
-                double exactJD = findExactAspect(radixPos, tp, asp, startJD, 1);
+                double exactJD = findExactAspect(radixPos, tp, asp, startJD, 1, ctx);
                 
                 while (exactJD > 0 && exactJD <= endJD) {
                     TransitAspekt ta;
                     
-                    // JD in DateTime umrechnen (vereinfacht)
-                    double z = exactJD + 0.5;
-                    int aa = static_cast<int>(z);
-                    int b = aa + 1524;
-                    int c = static_cast<int>((b - 122.1) / 365.25);
-                    int dd = static_cast<int>(365.25 * c);
-                    int e = static_cast<int>((b - dd) / 30.6001);
-                    int day = b - dd - static_cast<int>(30.6001 * e);
-                    int month = (e < 14) ? e - 1 : e - 13;
-                    int year = (month > 2) ? c - 4716 : c - 4715;
-                    double frac = exactJD - static_cast<int>(exactJD) + 0.5;
-                    if (frac >= 1.0) frac -= 1.0;
-                    int hour = static_cast<int>(frac * 24.0);
-                    int minute = static_cast<int>((frac * 24.0 - hour) * 60.0);
-                    
-                    ta.zeitpunkt = QDateTime(QDate(year, month, day), QTime(hour, minute));
+                    CalDateTime dt = Calendar::fromJD(exactJD);
+                    dt.sekunde = 0;
+                    ta.zeitpunkt = toQDateTime(dt);
                     ta.transitPlanet = tp;
                     ta.radixPlanet = rp;
                     ta.aspekt = asp;
                     ta.orb = 0.0;  // Exakt
-                    ta.retrograde = swissEph().isRetrograde(tp, exactJD);
+                    ta.retrograde = ctx.isRetrograde(tp, exactJD);
                     
                     // Applying/Separating
-                    double lon, lat, dist, speed;
-                    swissEph().calcPlanet(tp, exactJD - 0.01, lon, lat, dist, speed);
-                    ta.applying = isAspectApplying(lon, radixPos, speed, asp);
+                    const PlanetPos vorher = ctx.calcPlanet(tp, exactJD - 0.01);
+                    ta.applying = isAspectApplying(vorher.longitude, radixPos, vorher.speed, asp);
                     
                     aspekte.append(ta);
                     
                     // Nächsten Aspekt suchen
-                    exactJD = findExactAspect(radixPos, tp, asp, exactJD + 1.0, 1);
+                    exactJD = findExactAspect(radixPos, tp, asp, exactJD + 1.0, 1, ctx);
                 }
             }
         }
@@ -7,6 +7,7 @@
 #include <QDateTime>
 #include <functional>
 #include "data_types.h"
+#include "calendar.h"
 #include "chart_calc.h"
 
 namespace astro {
@@ -14,6 +15,61 @@ namespace astro {
 // Forward declaration
 struct TransitAspekt;
 
+/**
+ * @brief Schrittweite eines Multi-Transit-Laufs
+ *
+ * Entweder ein Kalender-Inkrement (INC_*) oder eine beliebige Dauer in
+ * Tagen (z.B. 10 Minuten, 6 Stunden, 3 Tage). Zeitpunkte werden immer vom
+ * Start aus berechnet: JD + n * Dauer, Monate/Jahre über das Kalenderdatum.
+ * Auflösung 1 Sekunde.
+ */
+struct TransitStep {
+    int    inkrement = INC_TAGE;    // INC_* (wenn tage == 0)
+    double tage = 0.0;              // Eigene Schrittweite in Tagen
+
+    static TransitStep fixed(int inkrement) { return { inkrement, 0.0 }; }
+    static TransitStep days(double tage) { return { 0, tage }; }
+    static TransitStep minutes(double anzahl) { return days(anzahl * Calendar::MINUTE); }
+    static TransitStep hours(double anzahl) { return days(anzahl * Calendar::STUNDE); }
+
+    /**
+     * @brief Schrittweite passend zum schnellsten Körper
+     * @param planeten Betrachtete Transit-Planeten
+     * @param orb Kleinster relevanter Orbis in Grad
+     *
+     * Der schnellste Körper durchläuft den Orbis-Bereich (2 x orb) in
+     * mindestens vier Schritten; begrenzt auf 1 Minute bis 30 Tage.
+     */
+    static TransitStep adaptive(const QVector<int>& planeten, double orb);
+
+    /**
+     * @brief Gültige Schrittweite?
+     */
+    bool isValid() const;
+
+    /**
+     * @brief Schritt über das Kalenderdatum (Monate/Jahre)?
+     */
+    bool isCalendar() const {
+        return tage <= 0.0 && (inkrement == INC_MONATE || inkrement == INC_JAHRE);
+    }
+
+    /**
+     * @brief Dauer eines Schritts in Tagen (0 bei Kalender-Schritten)
+     */
+    double duration() const;
+
+    /**
+     * @brief Zeitpunkt nach n Schritten ab start
+     */
+    CalDateTime advance(const CalDateTime& start, int n) const;
+
+    /**
+     * @brief Anzahl Zeitpunkte von start bis ende (inklusive), ohne Iteration
+     */
+    int count(const CalDateTime& start, const CalDateTime& ende) const;
+};
+
 /**
  * @brief Transit-Berechnungen
  * 
@@ -31,17 +87,27 @@ public:
      * @param transit [out] Transit-Radix
      * @param datum Transit-Datum
      * @param zeit Transit-Zeit
+     * @param ctx Ephemeriden-Kontext
      * @return ERR_OK bei Erfolg
      */
     static int calcTransit(const Radix& radix, Radix& transit,
-                          const QDate& datum, const QTime& zeit);
+                          const QDate& datum, const QTime& zeit,
+                          const EpheContext& ctx = EpheContext::current());
+    
+    /**
+     * @brief Berechnet Transit-Positionen für einen Zeitpunkt (Ortszeit des Radix)
+     */
+    static int calcTransit(const Radix& radix, Radix& transit,
+                          const CalDateTime& zeitpunkt,
+                          const EpheContext& ctx = EpheContext::current());
     
     /**
      * @brief Berechnet Multi-Transit (Suche nach Aspekten)
      * @param radix Basis-Radix
      * @param transit Transit-Radix
      * @param inkrement Inkrement-Typ (INC_TAGE, INC_MONATE, etc.)
-     * @return Anzahl gefundener Aspekte
+     * @param ctx Ephemeriden-Kontext (für Worker-Threads)
+     * @return Anzahl berechneter Zeitpunkte, ERR_INC bei ungültigem Inkrement
      * 
      * Port von: sCalcMultiTransit(RADIX*, short)
      */
@@ -56,7 +122,48 @@ public:
                                 const QVector<float>& orbenPlanet = {},
                                 const QVector<float>& orbenHaus = {},
                                 bool* abortFlag = nullptr,
-                                const std::function<void(int,const QDate&,const QTime&)>& progressCb = nullptr);
+                                const std::function<void(int,const QDate&,const QTime&)>& progressCb = nullptr,
+                                const EpheContext& ctx = EpheContext::current());
+    
+    /**
+     * @brief Multi-Transit mit beliebiger Schrittweite
+     * @param schritt Schrittweite (Inkrement, Dauer oder adaptiv)
+     *
+     * Die Aspekt-Suche braucht nur die Planeten-Längen: jeder Körper wird
+     * in seinem eigenen Takt berechnet (aus maximaler Bewegung und kleinstem
+     * Orbis) und dazwischen interpoliert; nahe einer Orbis-Grenze wird exakt
+     * nachgerechnet. Transit-Häuser werden dabei nicht berechnet.
+     *
+     * transits erhält je Schritt einen Eintrag mit Zeitpunkt und jd. Voll
+     * berechnet (ChartCalc) werden nur der erste und letzte Schritt sowie
+     * Beginn und Ende jeder Sequenz; alle anderen haben anzahlPlanet == 0.
+     * Die Zeichen dazwischen liefert SignTimeline::folge().
+     */
+    static int calcMultiTransit(const Radix& radix,
+                                const QDate& startDatum,
+                                const QTime& startZeit,
+                                const QDate& endDatum,
+                                const QTime& endZeit,
+                                const TransitStep& schritt,
+                                QVector<Radix>* transits = nullptr,
+                                QVector<TransitAspekt>* aspekte = nullptr,
+                                const QVector<float>& orbenPlanet = {},
+                                const QVector<float>& orbenHaus = {},
+                                bool* abortFlag = nullptr,
+                                const std::function<void(int,const QDate&,const QTime&)>& progressCb = nullptr,
+                                const EpheContext& ctx = EpheContext::current());
+    
+    /**
+     * @brief Anzahl der Zeitpunkte eines Multi-Transit-Laufs (für Fortschritt)
+     */
+    static int stepCount(const QDate& startDatum, const QTime& startZeit,
+                         const QDate& endDatum, const QTime& endZeit,
+                         const TransitStep& schritt);
+    
+    /**
+     * @brief Maximale Tagesbewegung eines Körpers in Grad
+     */
+    static double maxDailyMotion(int planet);
     
     //==========================================================================
     // Rückläufigkeit
@@ -68,13 +175,15 @@ public:
      * @param startDatum Start-Datum
      * @param endDatum End-Datum
      * @param perioden [out] Liste der Rückläufigkeits-Perioden
+     * @param ctx Ephemeriden-Kontext
      * @return Anzahl der Perioden
      * 
      * Port von: sRucklauf(HWND)
      */
     static int calcRetrograde(int planet, const QDate& startDatum, 
                              const QDate& endDatum,
-                             QVector<QPair<QDate, QDate>>& perioden);
+                             QVector<QPair<QDate, QDate>>& perioden,
+                             const EpheContext& ctx = EpheContext::current());
     
     //==========================================================================
     // Datum-Inkrement
@@ -92,6 +201,14 @@ public:
      */
     static int incDate(QDate& datum, QTime& zeit, int inkrement, int anzahl);
     
+    /**
+     * @brief Inkrementiert einen Zeitpunkt ohne QDate/QTime
+     *
+     * Minuten bis Wochen werden auf dem JD addiert (mit Datumswechsel),
+     * Monate und Jahre über das Kalenderdatum (Tag auf Monatsende begrenzt).
+     */
+    static int incDate(CalDateTime& zeitpunkt, int inkrement, int anzahl);
+    
     //==========================================================================
     // Aspekt-Suche
     //==========================================================================
@@ -103,10 +220,12 @@ public:
      * @param aspekt Gesuchter Aspekt
      * @param startJD Start-JD
      * @param richtung 1 = vorwärts, -1 = rückwärts
+     * @param ctx Ephemeriden-Kontext
      * @return JD des exakten Aspekts, oder -1 wenn nicht gefunden
      */
     static double findExactAspect(double radixPlanet, int transitPlanet,
-                                  int aspekt, double startJD, int richtung);
+                                  int aspekt, double startJD, int richtung,
+                                  const EpheContext& ctx = EpheContext::current());
     
     /**
      * @brief Sucht alle Aspekte in einem Zeitraum
@@ -115,13 +234,15 @@ public:
      * @param endDatum End-Datum
      * @param orben Orben für Aspekte
      * @param aspekte [out] Gefundene Aspekte
+     * @param ctx Ephemeriden-Kontext
      * @return Anzahl gefundener Aspekte
      */
     static int findAspectsInRange(const Radix& radix,
                                   const QDate& startDatum,
                                   const QDate& endDatum,
                                   const QVector<float>& orben,
-                                  QVector<TransitAspekt>& aspekte);
+                                  QVector<TransitAspekt>& aspekte,
+                                  const EpheContext& ctx = EpheContext::current());
     
 private:
     // Hilfsfunktion für Aspekt-Suche
@@ -0,0 +1,435 @@
+/**
+ * @file transit_events.cpp
+ * @brief Implementierung der Transit-Ereignis-Suche
+ */
+
+#include "transit_events.h"
+#include "calculations.h"
+#include "chart_calc.h"
+#include "instrumentation.h"
+#include <algorithm>
+#include <cmath>
+
+namespace astro {
+
+namespace {
+
+constexpr int ASPEKT_WINKEL[ASPEKTE] = {
+    KONJUNKTION, HALBSEX, SEXTIL, QUADRATUR, TRIGON, QUINCUNX, OPOSITION
+};
+
+// Genauigkeit der Nullstellen-Suche (Anteil des Rasterintervalls)
+constexpr double GENAUIGKEIT = 1e-9;
+
+// Orbis für Aspekt a des Körpers tp (Legacy-Indizierung a * stride + tp)
+double orbFuer(const QVector<float>& orben, int stride, int a, int tp) {
+    return (orben.size() > a * stride + tp) ? orben[a * stride + tp] : 8.0f;
+}
+
+/**
+ * Kubisches Hermite-Polynom über ein Rasterintervall, s in [0, 1]:
+ * p(s) = a1 s + a2 s² + a3 s³ mit p(1) = delta, p'(0) = m0, p'(1) = m1
+ * (Steigungen je Intervall, also Geschwindigkeit x Rasterabstand).
+ */
+struct Kubik {
+    double a1 = 0.0;
+    double a2 = 0.0;
+    double a3 = 0.0;
+
+    static Kubik hermite(double delta, double m0, double m1) {
+        return { m0, 3.0 * delta - 2.0 * m0 - m1, m0 + m1 - 2.0 * delta };
+    }
+
+    Kubik operator-(const Kubik& o) const {
+        return { a1 - o.a1, a2 - o.a2, a3 - o.a3 };
+    }
+
+    double wert(double s) const { return s * (a1 + s * (a2 + s * a3)); }
+    double steigung(double s) const { return a1 + s * (2.0 * a2 + 3.0 * a3 * s); }
+};
+
+/**
+ * Verlauf einer Größe über ein Rasterintervall, zerlegt in monotone
+ * Stücke. Die Werte an den Intervall-Enden sind die berechneten (nicht
+ * die des Polynoms) - ein Übergang genau auf einem Rasterpunkt wird so
+ * in beiden angrenzenden Intervallen gleich bewertet.
+ */
+struct Verlauf {
+    Kubik  kubik;
+    double basis = 0.0;     // Wert bei s = 0
+    double stelle[4] = {};  // 0, Extremstellen, 1
+    double wert[4] = {};
+    int    anzahl = 0;
+    double min = 0.0;
+    double max = 0.0;
+
+    void setze(const Kubik& k, double w0, double w1) {
+        kubik = k;
+        basis = w0;
+        anzahl = 0;
+        stelle[anzahl] = 0.0;
+        wert[anzahl++] = w0;
+
+        // Extremstellen: Nullstellen von p'(s) = a1 + 2 a2 s + 3 a3 s²
+        double s[2];
+        int n = 0;
+        const double a = 3.0 * k.a3;
+        const double b = 2.0 * k.a2;
+        const double c = k.a1;
+        if (std::fabs(a) < 1e-15) {
+            if (std::fabs(b) > 1e-15) {
+                s[n++] = -c / b;
+            }
+        } else {
+            const double disk = b * b - 4.0 * a * c;
+            if (disk >= 0.0) {
+                const double w = std::sqrt(disk);
+                s[n++] = (-b - w) / (2.0 * a);
+                s[n++] = (-b + w) / (2.0 * a);
+                if (s[0] > s[1]) {
+                    std::swap(s[0], s[1]);
+                }
+            }
+        }
+        for (int i = 0; i < n; ++i) {
+            if (s[i] > 0.0 && s[i] < 1.0) {
+                stelle[anzahl] = s[i];
+                wert[anzahl++] = w0 + k.wert(s[i]);
+            }
+        }
+
+        stelle[anzahl] = 1.0;
+        wert[anzahl++] = w1;
+        min = *std::min_element(wert, wert + anzahl);
+        max = *std::max_element(wert, wert + anzahl);
+    }
+
+    /**
+     * Alle Stellen, an denen der Verlauf die Schwelle kreuzt, mit Richtung
+     * (aufsteigend = danach >= schwelle)
+     */
+    template <typename F>
+    void kreuzungen(double schwelle, F&& treffer) const {
+        if (schwelle < min || schwelle > max) {
+            return;
+        }
+        for (int i = 0; i + 1 < anzahl; ++i) {
+            const bool vorher = wert[i] >= schwelle;
+            const bool nachher = wert[i + 1] >= schwelle;
+            if (vorher == nachher) {
+                continue;
+            }
+            // Stück ist monoton - Bisektion
+            double lo = stelle[i];
+            double hi = stelle[i + 1];
+            while (hi - lo > GENAUIGKEIT) {
+                const double mitte = 0.5 * (lo + hi);
+                if ((basis + kubik.wert(mitte) >= schwelle) == vorher) {
+                    lo = mitte;
+                } else {
+                    hi = mitte;
+                }
+            }
+            treffer(0.5 * (lo + hi), nachher);
+        }
+    }
+};
+
+/**
+ * Geschwindigkeit über ein Rasterintervall (Ableitung der Kubik, eine
+ * quadratische Funktion) - für Stationen
+ */
+template <typename F>
+void stationen(const Kubik& k, double m0, double m1, F&& treffer) {
+    double stelle[3];
+    double wert[3];
+    int anzahl = 0;
+    stelle[anzahl] = 0.0;
+    wert[anzahl++] = m0;
+    if (std::fabs(k.a3) > 1e-15) {
+        const double scheitel = -k.a2 / (3.0 * k.a3);
+        if (scheitel > 0.0 && scheitel < 1.0) {
+            stelle[anzahl] = scheitel;
+            wert[anzahl++] = k.steigung(scheitel);
+        }
+    }
+    stelle[anzahl] = 1.0;
+    wert[anzahl++] = m1;
+
+    for (int i = 0; i + 1 < anzahl; ++i) {
+        const bool vorher = wert[i] >= 0.0;
+        const bool nachher = wert[i + 1] >= 0.0;
+        if (vorher == nachher) {
+            continue;
+        }
+        double lo = stelle[i];
+        double hi = stelle[i + 1];
+        while (hi - lo > GENAUIGKEIT) {
+            const double mitte = 0.5 * (lo + hi);
+            if ((k.steigung(mitte) >= 0.0) == vorher) {
+                lo = mitte;
+            } else {
+                hi = mitte;
+            }
+        }
+        treffer(0.5 * (lo + hi), !nachher);
+    }
+}
+
+// Stand eines Körpers an einem Rasterpunkt
+struct Stand {
+    double laenge = 0.0;    // Fortlaufend (ohne Sprung bei 360°)
+    double speed = 0.0;     // Grad/Tag
+};
+
+// Kleinstes n mit wert + n * 360 >= untergrenze
+int umlaufAb(double wert, double untergrenze) {
+    return static_cast<int>(std::ceil((untergrenze - wert) / DEGMAX));
+}
+
+} // namespace
+
+//==============================================================================
+// Ereignis-Suche
+//==============================================================================
+
+int TransitEvents::calculate(const Radix& radix, double startJD, double endJD, int arten,
+                             const Sink& sink,
+                             const QVector<float>& orbenPlanet,
+                             const QVector<float>& orbenHaus,
+                             bool* abortFlag,
+                             const EpheContext& ctx) {
+    ASTRO_TIMER("TransitEvents::calculate");
+    if (endJD <= startJD || (arten & EV_ALLE) == 0) {
+        return 0;
+    }
+
+    const int numPlanets = std::min<int>(radix.anzahlPlanet, MAX_PLANET);
+    const int numZiele = (arten & EV_ASPEKT_RADIX) ? std::min<int>(numPlanets, radix.planet.size()) : 0;
+    const int numHaus = (arten & (EV_ASPEKT_HAUS | EV_HAUS)) ? std::min<int>(MAX_HAUS, radix.haus.size()) : 0;
+
+    // Aspekt-Punkte (Winkel mit Vorzeichen) und Orben je Körper
+    struct Punkt {
+        double winkel;      // Abstand zum Ziel, -180..180
+        int16_t aspekt;
+        int a;              // Index in ASPEKT_WINKEL
+    };
+    QVector<Punkt> punkte;
+    for (int a = 0; a < ASPEKTE; ++a) {
+        const int w = ASPEKT_WINKEL[a];
+        punkte.append({ static_cast<double>(w), static_cast<int16_t>(w), a });
+        if (w != KONJUNKTION && w != OPOSITION) {
+            punkte.append({ -static_cast<double>(w), static_cast<int16_t>(w), a });
+        }
+    }
+
+    // Rasterpunkte: startJD + k * RASTER, der letzte genau auf endJD
+    const int intervalle = static_cast<int>(std::ceil((endJD - startJD) / RASTER));
+    auto rasterJD = [&](int k) {
+        return (k >= intervalle) ? endJD : startJD + k * RASTER;
+    };
+
+    QVector<Stand> alt(numPlanets);
+    QVector<Stand> neu(numPlanets);
+    auto berechne = [&](double jd, QVector<Stand>& stand, bool erster) {
+        ASTRO_COUNT("TransitEvents::calculate/Rasterpunkte", 1);
+        for (int tp = 0; tp < numPlanets; ++tp) {
+            const PlanetPos pos = ctx.calcPlanet(tp, jd);
+            if (!pos.ok()) {
+                return false;
+            }
+            stand[tp].speed = pos.speed;
+            stand[tp].laenge = erster ? pos.longitude
+                                      : alt[tp].laenge + Calculations::minDist(
+                                            Calculations::mod360(alt[tp].laenge), pos.longitude);
+        }
+        return true;
+    };
+    if (!berechne(startJD, alt, true)) {
+        return ERR_EPHEM;
+    }
+
+    QVector<Verlauf> verlauf(numPlanets);
+    QVector<TransitEvent> batch;
+    int anzahl = 0;
+
+    for (int k = 0; k < intervalle; ++k) {
+        if (abortFlag && *abortFlag) {
+            break;
+        }
+        const double t0 = rasterJD(k);
+        const double h = rasterJD(k + 1) - t0;
+        if (!berechne(t0 + h, neu, false)) {
+            return ERR_EPHEM;
+        }
+
+        for (int tp = 0; tp < numPlanets; ++tp) {
+            const Kubik kubik = Kubik::hermite(neu[tp].laenge - alt[tp].laenge,
+                                               alt[tp].speed * h, neu[tp].speed * h);
+            verlauf[tp].setze(kubik, alt[tp].laenge, neu[tp].laenge);
+        }
+
+        batch.clear();
+        auto ereignis = [&](double s, TransitEventTyp typ, int art, int tp, int ziel, int16_t aspekt) {
+            const Verlauf& v = verlauf[tp];
+            TransitEvent ev;
+            ev.jd = t0 + s * h;
+            ev.typ = typ;
+            ev.art = static_cast<int8_t>(art);
+            ev.planet = static_cast<int8_t>(tp);
+            ev.ziel = static_cast<int8_t>(ziel);
+            ev.aspekt = aspekt;
+            ev.retrograde = v.kubik.steigung(s) < 0.0;
+            ev.laenge = Calculations::mod360(v.basis + v.kubik.wert(s));
+            batch.append(ev);
+            return &batch.last();
+        };
+
+        // Aspekt-Punkt p zu einem Ziel: Schwellen winkel - orb, winkel, winkel + orb
+        // (Verlauf als Abstand zum Ziel, ziel = 0) bzw. verschoben um die Ziel-Länge
+        auto aspekte = [&](const Verlauf& v, double zielLaenge, double orb, const Punkt& p,
+                           int art, int tp, int ziel) {
+            if (orb <= 0.0) {
+                return;
+            }
+            const double mitte = zielLaenge + p.winkel;
+            for (int n = umlaufAb(mitte, v.min - orb); mitte + n * DEGMAX - orb <= v.max; ++n) {
+                const double exakt = mitte + n * DEGMAX;
+                if (k == 0 && (arten & EV_OFFEN) && v.basis >= exakt - orb && v.basis < exakt + orb) {
+                    ereignis(0.0, TransitEventTyp::AspektBeginn, art, tp, ziel, p.aspekt)->orb =
+                        static_cast<float>(orb);
+                }
+                v.kreuzungen(exakt - orb, [&](double s, bool auf) {
+                    ereignis(s, auf ? TransitEventTyp::AspektBeginn : TransitEventTyp::AspektEnde,
+                             art, tp, ziel, p.aspekt)->orb = static_cast<float>(orb);
+                });
+                v.kreuzungen(exakt, [&](double s, bool) {
+                    ereignis(s, TransitEventTyp::AspektExakt, art, tp, ziel, p.aspekt)->orb =
+                        static_cast<float>(orb);
+                });
+                v.kreuzungen(exakt + orb, [&](double s, bool auf) {
+                    ereignis(s, auf ? TransitEventTyp::AspektEnde : TransitEventTyp::AspektBeginn,
+                             art, tp, ziel, p.aspekt)->orb = static_cast<float>(orb);
+                });
+            }
+        };
+
+        for (int tp = 0; tp < numPlanets; ++tp) {
+            const Verlauf& v = verlauf[tp];
+
+            // Transit zu Radix-Planet und -Haus
+            for (const Punkt& p : punkte) {
+                for (int rp = 0; rp < numZiele; ++rp) {
+                    aspekte(v, radix.planet[rp], orbFuer(orbenPlanet, MAX_PLANET, p.a, tp), p,
+                            EV_ASPEKT_RADIX, tp, rp);
+                }
+                if (arten & EV_ASPEKT_HAUS) {
+                    for (int hs = 0; hs < numHaus; ++hs) {
+                        aspekte(v, radix.haus[hs], orbFuer(orbenHaus, MAX_HAUS, p.a, tp), p,
+                                EV_ASPEKT_HAUS, tp, hs);
+                    }
+                }
+            }
+
+            // Transit zu Transit: Abstand als eigener Verlauf (Orbis des
+            // ersten Körpers wie ChartCalc::calcAspects)
+            if (arten & EV_ASPEKT_TRANSIT) {
+                for (int tq = tp + 1; tq < numPlanets; ++tq) {
+                    Verlauf abstand;
+                    abstand.setze(verlauf[tq].kubik - v.kubik,
+                                  alt[tq].laenge - alt[tp].laenge, neu[tq].laenge - neu[tp].laenge);
+                    for (const Punkt& p : punkte) {
+                        aspekte(abstand, 0.0, orbFuer(orbenPlanet, MAX_PLANET, p.a, tp), p,
+                                EV_ASPEKT_TRANSIT, tp, tq);
+                    }
+                }
+            }
+
+            // Eintritt in Zeichen: Schwellen bei Vielfachen von 30°
+            if (arten & EV_ZEICHEN) {
+                if (k == 0 && (arten & EV_OFFEN)) {
+                    ereignis(0.0, TransitEventTyp::Eintritt, EV_ZEICHEN, tp,
+                             Calculations::getZeichen(Calculations::mod360(v.basis)), KEIN_ASP);
+                }
+                for (int n = static_cast<int>(std::ceil(v.min / 30.0)); n * 30.0 <= v.max; ++n) {
+                    v.kreuzungen(n * 30.0, [&](double s, bool auf) {
+                        const int zeichen = ((auf ? n : n - 1) % 12 + 12) % 12;
+                        ereignis(s, TransitEventTyp::Eintritt, EV_ZEICHEN, tp, zeichen, KEIN_ASP);
+                    });
+                }
+            }
+
+            // Eintritt in Radix-Häuser: Schwellen an den Spitzen
+            if (arten & EV_HAUS) {
+                if (k == 0 && (arten & EV_OFFEN) && numHaus == MAX_HAUS) {
+                    ereignis(0.0, TransitEventTyp::Eintritt, EV_HAUS, tp,
+                             ChartCalc::getHouseOfPlanet(Calculations::mod360(v.basis), radix.haus), KEIN_ASP);
+                }
+                for (int hs = 0; hs < numHaus; ++hs) {
+                    const double spitze = radix.haus[hs];
+                    for (int n = umlaufAb(spitze, v.min); spitze + n * DEGMAX <= v.max; ++n) {
+                        v.kreuzungen(spitze + n * DEGMAX, [&](double s, bool auf) {
+                            const int haus = auf ? hs : (hs + MAX_HAUS - 1) % MAX_HAUS;
+                            ereignis(s, TransitEventTyp::Eintritt, EV_HAUS, tp, haus, KEIN_ASP);
+                        });
+                    }
+                }
+            }
+
+            // Stationen: Vorzeichenwechsel der Geschwindigkeit
+            if (arten & EV_STATION) {
+                if (k == 0 && (arten & EV_OFFEN) && alt[tp].speed < 0.0) {
+                    ereignis(0.0, TransitEventTyp::Station, EV_STATION, tp, tp, KEIN_ASP)->retrograde = true;
+                }
+                stationen(v.kubik, alt[tp].speed * h, neu[tp].speed * h, [&](double s, bool rueck) {
+                    TransitEvent* ev = ereignis(s, TransitEventTyp::Station, EV_STATION, tp, tp, KEIN_ASP);
+                    ev->retrograde = rueck;
+                });
+            }
+        }
+
+        // Alle Ereignisse des Intervalls liegen in [t0, t0 + h]
+        std::stable_sort(batch.begin(), batch.end(), [](const TransitEvent& a, const TransitEvent& b) {
+            return a.jd < b.jd;
+        });
+        for (const TransitEvent& ev : batch) {
+            sink(ev);
+        }
+        anzahl += batch.size();
+
+        std::swap(alt, neu);
+    }
+
+    return anzahl;
+}
+
+int TransitEvents::calculate(const Radix& radix, double startJD, double endJD, int arten,
+                             QVector<TransitEvent>& events,
+                             const QVector<float>& orbenPlanet,
+                             const QVector<float>& orbenHaus,
+                             bool* abortFlag,
+                             const EpheContext& ctx) {
+    events.clear();
+    return calculate(radix, startJD, endJD, arten,
+                     [&events](const TransitEvent& ev) { events.append(ev); },
+                     orbenPlanet, orbenHaus, abortFlag, ctx);
+}
+
+int TransitEvents::calculate(const Radix& radix,
+                             const QDate& startDatum, const QTime& startZeit,
+                             const QDate& endDatum, const QTime& endZeit,
+                             int arten, QVector<TransitEvent>& events,
+                             const QVector<float>& orbenPlanet,
+                             const QVector<float>& orbenHaus,
+                             bool* abortFlag,
+                             const EpheContext& ctx) {
+    auto ut = [&radix](const QDate& datum, const QTime& zeit) {
+        const double lokal = Calendar::toJD(datum.year(), datum.month(), datum.day(),
+                                            zeit.hour() + zeit.minute() / 60.0 + zeit.second() / 3600.0);
+        return Calendar::localToUT(lokal, radix.rFix.zone);
+    };
+    return calculate(radix, ut(startDatum, startZeit), ut(endDatum, endZeit), arten, events,
+                     orbenPlanet, orbenHaus, abortFlag, ctx);
+}
+
+} // namespace astro
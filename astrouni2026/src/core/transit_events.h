@@ -0,0 +1,139 @@
+#pragma once
+/**
+ * @file transit_events.h
+ * @brief Transit-Ereignisse eines Zeitraums in einem Durchlauf
+ *
+ * Aspekte (Transit zu Radix-Planet, zu Radix-Haus/Achse und Transit zu
+ * Transit), Eintritte in Zeichen und Radix-Häuser sowie Stationen aus
+ * einem gemeinsamen Raster: jeder Körper wird je Rasterpunkt genau einmal
+ * berechnet (Länge und Geschwindigkeit). Zwischen den Rasterpunkten wird
+ * kubisch interpoliert (Hermite, Länge und Geschwindigkeit an beiden
+ * Enden); die Zeitpunkte der Ereignisse ergeben sich daraus ohne weitere
+ * Ephemeriden-Aufrufe.
+ */
+
+#include "data_types.h"
+#include "calendar.h"
+#include "ephe_context.h"
+#include <QDateTime>
+#include <QVector>
+#include <functional>
+
+namespace astro {
+
+//==============================================================================
+// Ereignis-Arten (Bitmaske für die Auswahl)
+//==============================================================================
+
+inline constexpr int EV_ASPEKT_RADIX   = 0x1;   // Transit zu Radix-Planet
+inline constexpr int EV_ASPEKT_HAUS    = 0x2;   // Transit zu Radix-Haus (AC = 0, MC = 9)
+inline constexpr int EV_ASPEKT_TRANSIT = 0x4;   // Transit zu Transit (mundan)
+inline constexpr int EV_ZEICHEN        = 0x8;   // Eintritt in ein Zeichen
+inline constexpr int EV_HAUS           = 0x10;  // Eintritt in ein Radix-Haus
+inline constexpr int EV_STATION        = 0x20;  // Stillstand
+inline constexpr int EV_ALLE           = 0x3F;
+
+// Option: Zustand am Anfang als Ereignisse zum Startzeitpunkt melden -
+// Aspekte schon im Orbis als AspektBeginn, rückläufige Körper als Station,
+// Zeichen und Haus als Eintritt
+inline constexpr int EV_OFFEN          = 0x40;
+
+/**
+ * @brief Typ eines Transit-Ereignisses
+ */
+enum class TransitEventTyp : uint8_t {
+    AspektBeginn,   // Eintritt in den Orbis
+    AspektExakt,    // Aspekt exakt
+    AspektEnde,     // Austritt aus dem Orbis
+    Eintritt,       // Eintritt in Zeichen (EV_ZEICHEN) oder Haus (EV_HAUS)
+    Station         // Stillstand; retrograde = wird rückläufig
+};
+
+/**
+ * @brief Ein Transit-Ereignis
+ */
+struct TransitEvent {
+    double          jd = 0.0;           // Zeitpunkt (UT)
+    TransitEventTyp typ = TransitEventTyp::AspektExakt;
+    int8_t          art = 0;            // EV_* (Ziel des Aspekts bzw. Art des Eintritts)
+    int8_t          planet = 0;         // Transit-Körper
+    int8_t          ziel = 0;           // Radix-Planet, Haus, Transit-Körper oder Zeichen
+    int16_t         aspekt = KEIN_ASP;  // Aspekt-Winkel (nur Aspekt-Ereignisse)
+    bool            retrograde = false; // Transit-Körper zum Zeitpunkt rückläufig?
+    double          laenge = 0.0;       // Länge des Transit-Körpers zum Zeitpunkt
+    float           orb = 0.0f;         // Orbis des Aspekts (nur Aspekt-Ereignisse)
+
+    /**
+     * @brief Zeitpunkt in Ortszeit
+     * @param zone Zonen-Offset in Stunden (wie rFix.zone)
+     */
+    CalDateTime zeitpunkt(double zone) const {
+        return Calendar::fromJD(Calendar::utToLocal(jd, zone));
+    }
+};
+
+/**
+ * @brief Ereignis-Suche über einen Zeitraum
+ *
+ * Jeder Aspekt-Winkel wird für sich verfolgt (nicht nur der erste im
+ * Orbis wie bei calcMultiTransit). Ereignisse gibt es nur für Übergänge
+ * innerhalb des Zeitraums - ein Aspekt, der schon am Anfang im Orbis ist,
+ * hat kein AspektBeginn (außer mit EV_OFFEN).
+ */
+class TransitEvents {
+public:
+    // Rasterabstand in Tagen: Zeitpunkte auf Sekunden bis eine Minute genau
+    // (Stationen, bei denen die Geschwindigkeit kaum kippt: wenige Minuten)
+    static constexpr double RASTER = 0.5;
+
+    using Sink = std::function<void(const TransitEvent&)>;
+
+    /**
+     * @brief Sucht alle Ereignisse der gewählten Arten
+     * @param radix Basis-Radix (Planeten und Häuser als Ziele)
+     * @param startJD Beginn (UT)
+     * @param endJD Ende (UT)
+     * @param arten Bitmaske aus EV_*
+     * @param sink Empfänger, Ereignisse zeitlich sortiert
+     * @param orbenPlanet Orben für Aspekte zu Planeten (auch Transit zu Transit)
+     * @param orbenHaus Orben für Aspekte zu Häusern
+     * @param abortFlag Abbruch, wenn auf true gesetzt
+     * @param ctx Ephemeriden-Kontext
+     * @return Anzahl Ereignisse, ERR_EPHEM bei Fehler der Ephemeriden
+     *
+     * Der Sink wird je Rasterintervall mit den Ereignissen dieses
+     * Intervalls aufgerufen - der Strom ist damit insgesamt sortiert und
+     * muss nicht gesammelt werden.
+     */
+    static int calculate(const Radix& radix, double startJD, double endJD, int arten,
+                         const Sink& sink,
+                         const QVector<float>& orbenPlanet = {},
+                         const QVector<float>& orbenHaus = {},
+                         bool* abortFlag = nullptr,
+                         const EpheContext& ctx = EpheContext::current());
+
+    /**
+     * @brief Sucht alle Ereignisse und sammelt sie
+     * @param events [out] Ereignisse, zeitlich sortiert
+     */
+    static int calculate(const Radix& radix, double startJD, double endJD, int arten,
+                         QVector<TransitEvent>& events,
+                         const QVector<float>& orbenPlanet = {},
+                         const QVector<float>& orbenHaus = {},
+                         bool* abortFlag = nullptr,
+                         const EpheContext& ctx = EpheContext::current());
+
+    /**
+     * @brief Wie oben, Zeitraum in Ortszeit des Radix
+     */
+    static int calculate(const Radix& radix,
+                         const QDate& startDatum, const QTime& startZeit,
+                         const QDate& endDatum, const QTime& endZeit,
+                         int arten, QVector<TransitEvent>& events,
+                         const QVector<float>& orbenPlanet = {},
+                         const QVector<float>& orbenHaus = {},
+                         bool* abortFlag = nullptr,
+                         const EpheContext& ctx = EpheContext::current());
+};
+
+} // namespace astro
@@ -0,0 +1,198 @@
+/**
+ * @file transit_table.cpp
+ * @brief Implementierung der Transit-Perioden-Tabelle
+ */
+
+#include "transit_table.h"
+#include "instrumentation.h"
+#include <algorithm>
+#include <utility>
+
+namespace astro {
+
+namespace {
+
+// Eine Periode je Körper, Ziel und Aspekt - die Punkte +winkel und -winkel
+// liegen weiter auseinander als jeder Orbis und überschneiden sich nicht
+quint32 schluessel(const TransitEvent& ev) {
+    return (static_cast<quint32>(static_cast<uint8_t>(ev.art)) << 24)
+         | (static_cast<quint32>(static_cast<uint8_t>(ev.planet)) << 16)
+         | (static_cast<quint32>(static_cast<uint8_t>(ev.ziel)) << 8)
+         | static_cast<quint32>(ev.aspekt / 30);
+}
+
+} // namespace
+
+void TransitTable::clear() {
+    planet.clear();
+    art.clear();
+    ziel.clear();
+    aspekt.clear();
+    beginn.clear();
+    exakt.clear();
+    ende.clear();
+    orb.clear();
+    flags.clear();
+    m_offen.clear();
+}
+
+void TransitTable::reserve(int anzahl) {
+    planet.reserve(anzahl);
+    art.reserve(anzahl);
+    ziel.reserve(anzahl);
+    aspekt.reserve(anzahl);
+    beginn.reserve(anzahl);
+    exakt.reserve(anzahl);
+    ende.reserve(anzahl);
+    orb.reserve(anzahl);
+    flags.reserve(anzahl);
+}
+
+int TransitTable::build(const Radix& radix, double startJD, double endJD, int arten,
+                        const QVector<float>& orbenPlanet,
+                        const QVector<float>& orbenHaus,
+                        bool* abortFlag,
+                        const EpheContext& ctx) {
+    ASTRO_TIMER("TransitTable::build");
+    clear();
+    arten = (arten & (EV_ASPEKT_RADIX | EV_ASPEKT_HAUS | EV_ASPEKT_TRANSIT)) | EV_OFFEN;
+    const int res = TransitEvents::calculate(radix, startJD, endJD, arten,
+                                             [&](const TransitEvent& ev) { add(ev, startJD); },
+                                             orbenPlanet, orbenHaus, abortFlag, ctx);
+    if (res < 0) {
+        clear();
+        return res;
+    }
+    finish(endJD);
+    return size();
+}
+
+int TransitTable::append(const TransitEvent& ev, double anfang) {
+    planet.append(ev.planet);
+    art.append(ev.art);
+    ziel.append(ev.ziel);
+    aspekt.append(ev.aspekt);
+    beginn.append(anfang);
+    exakt.append(0.0);
+    ende.append(0.0);
+    orb.append(ev.orb);
+    flags.append(0);
+    return planet.size() - 1;
+}
+
+void TransitTable::add(const TransitEvent& ev, double startJD) {
+    if (ev.typ != TransitEventTyp::AspektBeginn && ev.typ != TransitEventTyp::AspektExakt
+        && ev.typ != TransitEventTyp::AspektEnde) {
+        return;
+    }
+
+    const quint32 key = schluessel(ev);
+    auto it = m_offen.find(key);
+    if (ev.typ == TransitEventTyp::AspektBeginn) {
+        const int zeile = append(ev, ev.jd);
+        if (ev.jd <= startJD) {
+            flags[zeile] |= TT_OFFEN_BEGINN;    // EV_OFFEN
+        }
+        if (ev.retrograde) {
+            flags[zeile] |= TT_RUECK;
+        }
+        m_offen.insert(key, zeile);
+        return;
+    }
+
+    // Exakt oder Ende ohne Beginn (Strom ohne EV_OFFEN): schon am Anfang im Orbis
+    int zeile;
+    if (it == m_offen.end()) {
+        zeile = append(ev, startJD);
+        flags[zeile] |= TT_OFFEN_BEGINN;
+        it = m_offen.insert(key, zeile);
+    } else {
+        zeile = it.value();
+    }
+
+    if (ev.retrograde) {
+        flags[zeile] |= TT_RUECK;
+    }
+    if (ev.typ == TransitEventTyp::AspektExakt) {
+        if (exakt[zeile] == 0.0) {
+            exakt[zeile] = ev.jd;
+        } else {
+            flags[zeile] |= TT_MEHRFACH;
+        }
+    } else {
+        ende[zeile] = ev.jd;
+        m_offen.erase(it);
+    }
+}
+
+void TransitTable::finish(double endJD) {
+    for (int zeile : std::as_const(m_offen)) {
+        ende[zeile] = endJD;
+        flags[zeile] |= TT_OFFEN_ENDE;
+    }
+    m_offen.clear();
+}
+
+//==============================================================================
+// Rückläufigkeit
+//==============================================================================
+
+int Ruecklauf::calculate(const Radix& radix, double startJD, double endJD,
+                         QVector<RuecklaufPeriode>& perioden,
+                         bool* abortFlag,
+                         const EpheContext& ctx) {
+    ASTRO_TIMER("Ruecklauf::calculate");
+    perioden.clear();
+
+    // Offene Periode je Körper (Index in perioden, -1 = direktläufig)
+    QVector<int> offen(MAX_PLANET, -1);
+    const int res = TransitEvents::calculate(
+        radix, startJD, endJD, EV_STATION | EV_OFFEN,
+        [&](const TransitEvent& ev) {
+            if (ev.retrograde) {
+                RuecklaufPeriode p;
+                p.planet = ev.planet;
+                p.beginn = ev.jd;
+                p.laengeBeginn = ev.laenge;
+                if (ev.jd <= startJD) {
+                    p.flags |= TT_OFFEN_BEGINN;
+                }
+                offen[ev.planet] = perioden.size();
+                perioden.append(p);
+            } else if (offen[ev.planet] >= 0) {
+                RuecklaufPeriode& p = perioden[offen[ev.planet]];
+                p.ende = ev.jd;
+                p.laengeEnde = ev.laenge;
+                offen[ev.planet] = -1;
+            }
+        },
+        {}, {}, abortFlag, ctx);
+    if (res < 0) {
+        perioden.clear();
+        return res;
+    }
+
+    // Am Ende noch rückläufig
+    for (int tp = 0; tp < offen.size(); ++tp) {
+        if (offen[tp] < 0) {
+            continue;
+        }
+        const PlanetPos pos = ctx.calcPlanet(tp, endJD);
+        if (!pos.ok()) {
+            perioden.clear();
+            return ERR_EPHEM;
+        }
+        RuecklaufPeriode& p = perioden[offen[tp]];
+        p.ende = endJD;
+        p.laengeEnde = pos.longitude;
+        p.flags |= TT_OFFEN_ENDE;
+    }
+
+    std::stable_sort(perioden.begin(), perioden.end(),
+                     [](const RuecklaufPeriode& a, const RuecklaufPeriode& b) {
+                         return a.planet < b.planet;
+                     });
+    return perioden.size();
+}
+
+} // namespace astro
@@ -0,0 +1,107 @@
+#pragma once
+/**
+ * @file transit_table.h
+ * @brief Transit-Perioden als spaltenweise Tabelle
+ *
+ * Eine Zeile je Aufenthalt eines Transit-Körpers im Orbis eines Aspekts
+ * (Beginn, erste Exaktheit, Ende), gebildet aus dem Ereignis-Strom von
+ * TransitEvents. Jede Spalte ist ein eigener Vektor fester Breite -
+ * Sortieren und Filtern über viele Zeilen liest nur die benötigten
+ * Spalten und vergleicht Zahlen statt Texte.
+ *
+ * Dazu die Rückläufigkeits-Perioden aller Körper aus den Stationen.
+ */
+
+#include "transit_events.h"
+#include <QHash>
+
+namespace astro {
+
+// Zeilen-Flags
+inline constexpr uint8_t TT_RUECK        = 0x1;  // Transit-Körper zeitweise rückläufig
+inline constexpr uint8_t TT_OFFEN_BEGINN = 0x2;  // Am Anfang des Zeitraums schon im Orbis
+inline constexpr uint8_t TT_OFFEN_ENDE   = 0x4;  // Am Ende des Zeitraums noch im Orbis
+inline constexpr uint8_t TT_MEHRFACH     = 0x8;  // Mehrfach exakt (Rückläufigkeit)
+
+/**
+ * @brief Spaltenweise Tabelle der Transit-Perioden
+ */
+struct TransitTable {
+    QVector<int8_t>  planet;    // Transit-Körper
+    QVector<int8_t>  art;       // EV_ASPEKT_RADIX, EV_ASPEKT_HAUS oder EV_ASPEKT_TRANSIT
+    QVector<int8_t>  ziel;      // Radix-Planet, Haus oder Transit-Körper
+    QVector<int16_t> aspekt;    // Aspekt-Winkel
+    QVector<double>  beginn;    // JD (UT), Anfang des Zeitraums bei TT_OFFEN_BEGINN
+    QVector<double>  exakt;     // JD (UT) der ersten Exaktheit, 0 = nicht exakt
+    QVector<double>  ende;      // JD (UT), Ende des Zeitraums bei TT_OFFEN_ENDE
+    QVector<float>   orb;       // Orbis des Aspekts
+    QVector<uint8_t> flags;     // TT_*
+
+    int size() const { return planet.size(); }
+    void clear();
+    void reserve(int anzahl);
+
+    /**
+     * @brief Rechnet die Perioden eines Zeitraums
+     * @param radix Basis-Radix
+     * @param startJD Beginn (UT)
+     * @param endJD Ende (UT)
+     * @param arten Aspekt-Arten (EV_ASPEKT_*)
+     * @return Anzahl Zeilen, ERR_EPHEM bei Fehler der Ephemeriden
+     */
+    int build(const Radix& radix, double startJD, double endJD, int arten,
+              const QVector<float>& orbenPlanet = {},
+              const QVector<float>& orbenHaus = {},
+              bool* abortFlag = nullptr,
+              const EpheContext& ctx = EpheContext::current());
+
+    /**
+     * @brief Übernimmt ein Aspekt-Ereignis (zeitlich sortiert)
+     *
+     * Für eigene Ereignis-Ströme; build() ruft add() und finish() selbst.
+     */
+    void add(const TransitEvent& ev, double startJD);
+
+    /**
+     * @brief Schließt alle noch offenen Perioden am Ende des Zeitraums
+     */
+    void finish(double endJD);
+
+private:
+    int append(const TransitEvent& ev, double beginn);
+
+    QHash<quint32, int> m_offen;    // Laufende Perioden: Schlüssel -> Zeile
+};
+
+/**
+ * @brief Rückläufigkeit eines Körpers zwischen zwei Stationen
+ */
+struct RuecklaufPeriode {
+    int8_t  planet = 0;
+    uint8_t flags = 0;              // TT_OFFEN_BEGINN, TT_OFFEN_ENDE
+    double  beginn = 0.0;           // JD (UT) der Station R bzw. Anfang des Zeitraums
+    double  ende = 0.0;             // JD (UT) der Station D bzw. Ende des Zeitraums
+    double  laengeBeginn = 0.0;     // Länge zu Beginn
+    double  laengeEnde = 0.0;       // Länge am Ende
+};
+
+class Ruecklauf {
+public:
+    /**
+     * @brief Rückläufigkeits-Perioden aller Körper eines Zeitraums
+     * @param radix Radix (anzahlPlanet bestimmt die Körper)
+     * @param startJD Beginn (UT)
+     * @param endJD Ende (UT)
+     * @param perioden [out] nach Körper, dann Beginn sortiert
+     * @return Anzahl Perioden, ERR_EPHEM bei Fehler der Ephemeriden
+     *
+     * Die Stationen kommen aus dem Geschwindigkeits-Verlauf von
+     * TransitEvents (EV_STATION) - ein Durchlauf für alle Körper.
+     */
+    static int calculate(const Radix& radix, double startJD, double endJD,
+                         QVector<RuecklaufPeriode>& perioden,
+                         bool* abortFlag = nullptr,
+                         const EpheContext& ctx = EpheContext::current());
+};
+
+} // namespace astro
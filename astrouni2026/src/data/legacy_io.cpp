@@ -6,6 +6,8 @@
 #include "legacy_io.h"
 #include <QFile>
 #include <QDataStream>
+#include <QSaveFile>
+#include <QtEndian>
 #include <QDir>
 #include <QTextStream>
 #include <QRegularExpression>
@@ -76,7 +78,171 @@ QColor LegacyIO::legacyToColor(uint32_t legacy) const {
 // INI-Datei
 //==============================================================================
 
-int LegacyIO::readIni(AuInit& auinit) {
+namespace {
+
+// Einstellungsdatei (astroset.dat), alle Werte Little-Endian:
+//   Kopf (32 Bytes): Magic, Version, Kopfgröße, Nutzdatengröße, CRC,
+//                    Planeten/Häuser/Aspekte (Array-Dimensionen)
+//   Nutzdaten:       8 x int16 Einstellungen, 6 Orben-Arrays (float)
+//                    (Einstellungen: Haus, Horo, Rotation, Aspekte, Teilung,
+//                    Optionen, 2 reserviert)
+constexpr quint32 SET_MAGIC = 0x54535541;   // "AUST"
+constexpr quint16 SET_VERSION = 1;
+constexpr int SET_HEADER_SIZE = 32;
+constexpr int SET_WERTE = 8;
+
+constexpr int ORBEN_PLANET = MAX_PLANET * MAX_PLANET * ASPEKTE;
+constexpr int ORBEN_HAUS = MAX_PLANET * MAX_HAUS * ASPEKTE;
+constexpr int SET_PAYLOAD_SIZE = SET_WERTE * int(sizeof(qint16))
+                               + 3 * (ORBEN_PLANET + ORBEN_HAUS) * int(sizeof(float));
+
+} // namespace
+
+int LegacyIO::readIni(AuInit& auinit, bool migrieren) {
+    int result = readSettings(auinit);
+    if (result == ERR_OK) {
+        return ERR_OK;
+    }
+    if (QFile::exists(getFilePath(SETDAT))) {
+        qWarning("LegacyIO::readIni() - %s", qPrintable(m_lastError));
+    }
+
+    // Migration: altes Format (bzw. default.dat) einmal lesen und sofort im
+    // neuen Format ablegen - ab dem nächsten Start genügt ein Lesezugriff
+    result = readLegacyIni(auinit);
+    if (result == ERR_OK && migrieren && writeSettings(auinit) != ERR_OK) {
+        qWarning("LegacyIO::readIni() - %s", qPrintable(m_lastError));
+    }
+    return result;
+}
+
+int LegacyIO::writeIni(const AuInit& auinit) {
+    return writeSettings(auinit);
+}
+
+int LegacyIO::readSettings(AuInit& auinit) {
+    QString filepath = getFilePath(SETDAT);
+    QFile file(filepath);
+
+    if (!file.open(QIODevice::ReadOnly)) {
+        setError(QString("Kann Datei nicht öffnen: %1").arg(filepath));
+        return ERR_FILE;
+    }
+
+    // Ein Zugriff: Datei einblenden, sonst komplett lesen
+    QByteArray buffer;
+    qint64 available = file.size();
+    const uchar* data = file.map(0, available);
+    if (!data) {
+        buffer = file.readAll();
+        data = reinterpret_cast<const uchar*>(buffer.constData());
+        available = buffer.size();
+    }
+
+    // Kopf und Prüfsumme in einem Durchgang validieren, erst dann übernehmen
+    if (available < SET_HEADER_SIZE
+        || qFromLittleEndian<quint32>(data) != SET_MAGIC) {
+        setError(QString("Keine Einstellungsdatei: %1").arg(filepath));
+        return ERR_ORBEN;
+    }
+    if (qFromLittleEndian<quint16>(data + 4) != SET_VERSION
+        || qFromLittleEndian<quint16>(data + 6) != SET_HEADER_SIZE
+        || qFromLittleEndian<quint16>(data + 16) != MAX_PLANET
+        || qFromLittleEndian<quint16>(data + 18) != MAX_HAUS
+        || qFromLittleEndian<quint16>(data + 20) != ASPEKTE) {
+        setError(QString("Einstellungsdatei hat eine andere Version: %1").arg(filepath));
+        return ERR_ORBEN;
+    }
+
+    const quint32 payloadSize = qFromLittleEndian<quint32>(data + 8);
+    const uchar* payload = data + SET_HEADER_SIZE;
+    if (payloadSize != quint32(SET_PAYLOAD_SIZE) || available < SET_HEADER_SIZE + payloadSize) {
+        setError(QString("Einstellungsdatei ist unvollständig: %1").arg(filepath));
+        return ERR_ORBEN;
+    }
+    const quint16 crc = qChecksum(QByteArrayView(payload, payloadSize), Qt::ChecksumIso3309);
+    if (qFromLittleEndian<quint16>(data + 12) != crc) {
+        setError(QString("Prüfsumme der Einstellungsdatei stimmt nicht: %1").arg(filepath));
+        return ERR_ORBEN;
+    }
+
+    qint16 werte[SET_WERTE];
+    qFromLittleEndian<qint16>(payload, SET_WERTE, werte);
+    auinit.sSelHaus = werte[0];
+    auinit.sSelHoro = werte[1];
+    auinit.sRotRadix = werte[2];
+    auinit.sAspekte = werte[3];
+    auinit.sTeilung = werte[4];
+    auinit.sOptionen = werte[5];
+    // werte[6..7] reserviert
+
+    const uchar* pos = payload + SET_WERTE * sizeof(qint16);
+    auto lies = [&pos](QVector<float>& ziel, int anzahl) {
+        ziel.resize(anzahl);
+        qFromLittleEndian<float>(pos, anzahl, ziel.data());
+        pos += anzahl * sizeof(float);
+    };
+    lies(auinit.orbenPlanet, ORBEN_PLANET);
+    lies(auinit.orbenHaus, ORBEN_HAUS);
+    lies(auinit.orbenTPlanet, ORBEN_PLANET);
+    lies(auinit.orbenTHaus, ORBEN_HAUS);
+    lies(auinit.orbenSPlanet, ORBEN_PLANET);
+    lies(auinit.orbenSHaus, ORBEN_HAUS);
+
+    return ERR_OK;
+}
+
+int LegacyIO::writeSettings(const AuInit& auinit) {
+    if (auinit.orbenPlanet.size() != ORBEN_PLANET || auinit.orbenTPlanet.size() != ORBEN_PLANET
+        || auinit.orbenSPlanet.size() != ORBEN_PLANET || auinit.orbenHaus.size() != ORBEN_HAUS
+        || auinit.orbenTHaus.size() != ORBEN_HAUS || auinit.orbenSHaus.size() != ORBEN_HAUS) {
+        setError("Orben haben eine falsche Größe - Einstellungen nicht gespeichert");
+        return ERR_ORBEN;
+    }
+
+    QByteArray data(SET_HEADER_SIZE + SET_PAYLOAD_SIZE, '\0');
+    uchar* kopf = reinterpret_cast<uchar*>(data.data());
+    uchar* payload = kopf + SET_HEADER_SIZE;
+
+    const qint16 werte[SET_WERTE] = {
+        auinit.sSelHaus, auinit.sSelHoro, auinit.sRotRadix, auinit.sAspekte, auinit.sTeilung,
+        auinit.sOptionen, 0, 0
+    };
+    qToLittleEndian<qint16>(werte, SET_WERTE, payload);
+
+    uchar* pos = payload + SET_WERTE * sizeof(qint16);
+    auto schreib = [&pos](const QVector<float>& quelle) {
+        qToLittleEndian<float>(quelle.constData(), quelle.size(), pos);
+        pos += quelle.size() * sizeof(float);
+    };
+    schreib(auinit.orbenPlanet);
+    schreib(auinit.orbenHaus);
+    schreib(auinit.orbenTPlanet);
+    schreib(auinit.orbenTHaus);
+    schreib(auinit.orbenSPlanet);
+    schreib(auinit.orbenSHaus);
+
+    qToLittleEndian<quint32>(SET_MAGIC, kopf);
+    qToLittleEndian<quint16>(SET_VERSION, kopf + 4);
+    qToLittleEndian<quint16>(SET_HEADER_SIZE, kopf + 6);
+    qToLittleEndian<quint32>(SET_PAYLOAD_SIZE, kopf + 8);
+    qToLittleEndian<quint16>(
+        qChecksum(QByteArrayView(payload, SET_PAYLOAD_SIZE), Qt::ChecksumIso3309), kopf + 12);
+    qToLittleEndian<quint16>(MAX_PLANET, kopf + 16);
+    qToLittleEndian<quint16>(MAX_HAUS, kopf + 18);
+    qToLittleEndian<quint16>(ASPEKTE, kopf + 20);
+
+    // Atomar ersetzen - ein Abbruch hinterlässt nie eine halbe Datei
+    QString filepath = getFilePath(SETDAT);
+    QSaveFile file(filepath);
+    if (!file.open(QIODevice::WriteOnly) || file.write(data) != data.size() || !file.commit()) {
+        setError(QString("Kann Datei nicht schreiben: %1").arg(filepath));
+        return ERR_FILE;
+    }
+    return ERR_OK;
+}
+
+int LegacyIO::readLegacyIni(AuInit& auinit) {
     QString filepath = getFilePath(INIDAT);
     QFile file(filepath);
     
@@ -130,61 +296,14 @@ int LegacyIO::readIni(AuInit& auinit) {
     
     if (!hasValidOrbs || bytesRead == 0) {
         // Keine gültigen Orben in astroini.dat - aus default.dat laden
+        qWarning("LegacyIO::readLegacyIni() - %s enthält keine Orben, verwende %s",
+                 qPrintable(filepath), ORBDAT);
         return readDefaultOrben(auinit);
     }
     
     return ERR_OK;
 }
 
-int LegacyIO::writeIni(const AuInit& auinit) {
-    QString filepath = getFilePath(INIDAT);
-    QFile file(filepath);
-    
-    if (!file.open(QIODevice::WriteOnly)) {
-        setError(QString("Kann Datei nicht schreiben: %1").arg(filepath));
-        return ERR_FILE;
-    }
-    
-    // Header schreiben (20 Bytes wie im Legacy)
-    int16_t version = MAIN_VERSION;
-    file.write(reinterpret_cast<const char*>(&version), sizeof(version));
-    file.write(reinterpret_cast<const char*>(&auinit.sSelHaus), sizeof(auinit.sSelHaus));
-    file.write(reinterpret_cast<const char*>(&auinit.sSelHoro), sizeof(auinit.sSelHoro));
-    file.write(reinterpret_cast<const char*>(&auinit.sRotRadix), sizeof(auinit.sRotRadix));
-    file.write(reinterpret_cast<const char*>(&auinit.sAspekte), sizeof(auinit.sAspekte));
-    file.write(reinterpret_cast<const char*>(&auinit.sTeilung), sizeof(auinit.sTeilung));
-    
-    // Padding auf 20 Bytes
-    QByteArray padding(20 - 12, '\0');
-    file.write(padding);
-    
-    // Orben direkt in die gleiche Datei schreiben
-    int sizePlanet = MAX_PLANET * MAX_PLANET * ASPEKTE;
-    int sizeHaus = MAX_PLANET * MAX_HAUS * ASPEKTE;
-    
-    if (auinit.orbenPlanet.size() >= sizePlanet) {
-        file.write(reinterpret_cast<const char*>(auinit.orbenPlanet.constData()), sizePlanet * sizeof(float));
-    }
-    if (auinit.orbenHaus.size() >= sizeHaus) {
-        file.write(reinterpret_cast<const char*>(auinit.orbenHaus.constData()), sizeHaus * sizeof(float));
-    }
-    if (auinit.orbenTPlanet.size() >= sizePlanet) {
-        file.write(reinterpret_cast<const char*>(auinit.orbenTPlanet.constData()), sizePlanet * sizeof(float));
-    }
-    if (auinit.orbenTHaus.size() >= sizeHaus) {
-        file.write(reinterpret_cast<const char*>(auinit.orbenTHaus.constData()), sizeHaus * sizeof(float));
-    }
-    if (auinit.orbenSPlanet.size() >= sizePlanet) {
-        file.write(reinterpret_cast<const char*>(auinit.orbenSPlanet.constData()), sizePlanet * sizeof(float));
-    }
-    if (auinit.orbenSHaus.size() >= sizeHaus) {
-        file.write(reinterpret_cast<const char*>(auinit.orbenSHaus.constData()), sizeHaus * sizeof(float));
-    }
-    
-    file.close();
-    return ERR_OK;
-}
-
 //==============================================================================
 // Orben-Datei
 //==============================================================================
@@ -37,20 +37,26 @@ public:
     QString getDataPath() const;
     
     //==========================================================================
-    // INI-Datei (astroini.dat)
+    // Einstellungen (astroset.dat, Migration aus astroini.dat)
     //==========================================================================
     
     /**
-     * @brief Liest die Initialisierungs-Datei
+     * @brief Liest die Einstellungen
      * @param auinit [out] Einstellungen
+     * @param migrieren false: astroset.dat nicht schreiben (nur lesen,
+     *        z.B. Kommandozeilen-Werkzeuge)
      * @return ERR_OK bei Erfolg
      * 
+     * Liest astroset.dat; fehlt die Datei oder ist sie ungültig, werden
+     * astroini.dat bzw. default.dat gelesen und sofort als astroset.dat
+     * gespeichert (Migration).
+     * 
      * Port von: sReadIni(void)
      */
-    int readIni(AuInit& auinit);
+    int readIni(AuInit& auinit, bool migrieren = true);
     
     /**
-     * @brief Schreibt die Initialisierungs-Datei
+     * @brief Schreibt die Einstellungen (astroset.dat)
      * @param auinit Einstellungen
      * @return ERR_OK bei Erfolg
      * 
@@ -58,6 +64,21 @@ public:
      */
     int writeIni(const AuInit& auinit);
     
+    /**
+     * @brief Liest astroset.dat mit einem Zugriff (Memory-Map bzw. readAll)
+     * @param auinit [out] Einstellungen - nur verändert wenn gültig
+     * @return ERR_OK, ERR_FILE (nicht lesbar) oder ERR_ORBEN (Kennung,
+     *         Version, Dimensionen, Größe oder Prüfsumme falsch)
+     */
+    int readSettings(AuInit& auinit);
+    
+    /**
+     * @brief Schreibt astroset.dat (versioniert, mit CRC, atomar ersetzt)
+     * @param auinit Einstellungen
+     * @return ERR_OK, ERR_ORBEN (Orben-Arrays falsch dimensioniert) oder ERR_FILE
+     */
+    int writeSettings(const AuInit& auinit);
+    
     //==========================================================================
     // Orben-Datei (default.dat)
     //==========================================================================
@@ -159,6 +180,7 @@ private:
     
     // Hilfsfunktionen
     QString getFilePath(const QString& filename) const;
+    int readLegacyIni(AuInit& auinit);
     void setError(const QString& error);
     
     // Legacy-Format Konvertierung
@@ -8,6 +8,10 @@
 #include "chart_widget.h"
 #include "../core/astro_font_provider.h"
 #include "../core/calculations.h"
+#include "../core/chart_pipeline.h"
+#include "../core/instrumentation.h"
+#include "../core/synastry.h"
+#include "glyph_atlas.h"
 #include <QImage>
 #include <QMouseEvent>
 #include <QPainterPath>
@@ -122,6 +126,7 @@ QSize ChartWidget::sizeHint() const { return QSize(600, 600); }
 //==============================================================================
 
 void ChartWidget::paintEvent(QPaintEvent * /*event*/) {
+  ASTRO_TIMER("ChartWidget::paintEvent");
   // Offscreen zeichnen (wie Legacy: Basis-Buffer, später Zoom-Ausschnitt)
   QImage buffer(size(), QImage::Format_ARGB32_Premultiplied);
   buffer.fill(Qt::transparent);
@@ -334,6 +339,20 @@ void ChartWidget::toggleAspectCircle() {
   update();
 }
 
+const SynastrieErgebnis *ChartWidget::kreuzAspekte() const {
+  if (!m_transit) {
+    m_kreuz.reset();
+    return nullptr;
+  }
+  const int typ =
+      (m_radix.horoTyp == TYP_SYNASTRIE) ? TYP_SYNASTRIE : TYP_TRANSIT;
+  if (!m_kreuz || !m_kreuz->passtZu(m_radix, *m_transit, typ,
+                                    ChartPipeline::orbenHash(m_auinit))) {
+    m_kreuz = SynastrieCalc::ergebnis(m_radix, *m_transit, m_auinit, typ);
+  }
+  return m_kreuz.get();
+}
+
 bool ChartWidget::findAspectAtPoint(const QPointF &p, int &idx1, int &idx2,
                                     bool &isTransit) const {
   idx1 = idx2 = -1;
@@ -382,34 +401,17 @@ bool ChartWidget::findAspectAtPoint(const QPointF &p, int &idx1, int &idx2,
     }
   } else {
     // Transit/Synastrie-Aspekte: Transit-Planet zu Radix-Planet
+    // Gleiche Aspekte wie gezeichnet (Orben aus den Einstellungen)
+    const SynastrieErgebnis *kreuz = kreuzAspekte();
     int numTransit = m_transit->anzahlPlanet;
     int numPlanets = m_radix.anzahlPlanet;
     for (int i = 0; i < numTransit; ++i) {
       for (int j = 0; j < numPlanets; ++j) {
+        if (kreuz->planetAspekt(j, i) == KEIN_ASP)
+          continue;
+
         double transitPos = m_transit->planet[i];
         double radixPos = m_radix.planet[j];
-        double diff = std::abs(transitPos - radixPos);
-        if (diff > 180.0)
-          diff = 360.0 - diff;
-
-        int16_t asp = KEIN_ASP;
-        if (diff <= 10.0)
-          asp = KONJUNKTION;
-        else if (std::abs(diff - 30.0) <= 3.0)
-          asp = HALBSEX;
-        else if (std::abs(diff - 60.0) <= 6.0)
-          asp = SEXTIL;
-        else if (std::abs(diff - 90.0) <= 8.0)
-          asp = QUADRATUR;
-        else if (std::abs(diff - 120.0) <= 8.0)
-          asp = TRIGON;
-        else if (std::abs(diff - 150.0) <= 3.0)
-          asp = QUINCUNX;
-        else if (std::abs(diff - 180.0) <= 10.0)
-          asp = OPOSITION;
-
-        if (asp == KEIN_ASP)
-          continue;
 
         QPointF p1 = degreeToPoint(transitPos, m_radiusAsp);
         QPointF p2 = degreeToPoint(radixPos, m_radiusAsp);
@@ -585,7 +587,7 @@ void ChartWidget::drawZodiacSigns(QPainter &painter) {
     // Unicode-Symbol zentriert zeichnen
     QString symbol = astroFont().sternzeichenSymbol(i);
     QRectF rect(pos.x() - 12, pos.y() - 12, 24, 24);
-    painter.drawText(rect, Qt::AlignCenter, symbol);
+    glyphAtlas().drawTextCentered(painter, rect, symbol);
   }
 
   // STRICT LEGACY: Kleine Sternzeichen-Symbole im 3er-Ring (10°-Einteilung)
@@ -626,7 +628,7 @@ void ChartWidget::drawZodiacSigns(QPainter &painter) {
       painter.setPen(elementColors[element]);
       QString symbol = astroFont().sternzeichenSymbol(sStz);
       QRectF rect(pos.x() - 8, pos.y() - 8, 16, 16);
-      painter.drawText(rect, Qt::AlignCenter, symbol);
+      glyphAtlas().drawTextCentered(painter, rect, symbol);
 
       // Zweite Hälfte (gegenüberliegend: +180°)
       int sStz2 = (sStz + 6) % 12;
@@ -635,7 +637,7 @@ void ChartWidget::drawZodiacSigns(QPainter &painter) {
       painter.setPen(elementColors[element2]);
       QString symbol2 = astroFont().sternzeichenSymbol(sStz2);
       QRectF rect2(pos2.x() - 8, pos2.y() - 8, 16, 16);
-      painter.drawText(rect2, Qt::AlignCenter, symbol2);
+      glyphAtlas().drawTextCentered(painter, rect2, symbol2);
 
       dA += PI / 18.0; // 10° Schritt
     }
@@ -701,7 +703,7 @@ void ChartWidget::drawZodiacSigns(QPainter &painter) {
       painter.setPen(elementColors[element]);
       QString symbol = QString::fromUtf8(STERNZEICHEN_SYMBOLS[sStz]);
       QRectF rect(pos.x() - 6, pos.y() - 6, 12, 12);
-      painter.drawText(rect, Qt::AlignCenter, symbol);
+      glyphAtlas().drawTextCentered(painter, rect, symbol);
 
       // Zweite Hälfte (gegenüberliegend: +180°)
       int sStz2 = (sStz + 6) % 12;
@@ -710,7 +712,7 @@ void ChartWidget::drawZodiacSigns(QPainter &painter) {
       painter.setPen(elementColors[element2]);
       QString symbol2 = QString::fromUtf8(STERNZEICHEN_SYMBOLS[sStz2]);
       QRectF rect2(pos2.x() - 6, pos2.y() - 6, 12, 12);
-      painter.drawText(rect2, Qt::AlignCenter, symbol2);
+      glyphAtlas().drawTextCentered(painter, rect2, symbol2);
 
       sZ++;
       sZ %= 12;
@@ -965,7 +967,7 @@ void ChartWidget::drawPlanetSymbol(QPainter &painter, int planet, double angle,
     // Symbol aus AstroFontProvider (immer Unicode), aber mit System-Symbolfont
     // zeichnen
     QString symbol = astroFont().planetSymbol(planet);
-    painter.drawText(rect, Qt::AlignCenter, symbol);
+    glyphAtlas().drawTextCentered(painter, rect, symbol);
   }
 
   // Rückläufigkeits-Symbol (immer System-Font)
@@ -975,8 +977,8 @@ void ChartWidget::drawPlanetSymbol(QPainter &painter, int planet, double angle,
     painter.setFont(retroFont);
     painter.setPen(color);
     QRectF retroRect(pos.x() + 12, pos.y() - 6, 12, 12);
-    painter.drawText(retroRect, Qt::AlignCenter,
-                     astroFont().retrogradeSymbol());
+    glyphAtlas().drawTextCentered(painter, retroRect,
+                                  astroFont().retrogradeSymbol());
   }
 }
 
@@ -1025,6 +1027,7 @@ void ChartWidget::drawAspects(QPainter &painter) {
     // STRICT LEGACY: Synastrie/Transit-Aspekte zeichnen (Transit-Planet zu
     // Radix-Planet)
     int numTransit = m_transit->anzahlPlanet;
+    const SynastrieErgebnis *kreuz = kreuzAspekte();
 
     for (int i = 0; i < numTransit; ++i) {
       for (int j = 0; j < numPlanets; ++j) {
@@ -1042,34 +1045,15 @@ void ChartWidget::drawAspects(QPainter &painter) {
           }
         }
 
-        // Aspekt zwischen Transit-Planet i und Radix-Planet j berechnen
-        double transitPos = m_transit->planet[i];
-        double radixPos = m_radix.planet[j];
-        double diff = std::abs(transitPos - radixPos);
-        if (diff > 180.0)
-          diff = 360.0 - diff;
-
-        // Aspekt prüfen mit konfigurierten Orben aus Einstellungen
-        // Index: [Planet1 * MAX_PLANET + Planet2] * ASPEKTE + Aspekt
-        const QVector<float> &orben = (m_radix.horoTyp == TYP_SYNASTRIE)
-                                          ? m_auinit.orbenSPlanet
-                                          : m_auinit.orbenTPlanet;
-        static const int aspekte[] = { KONJUNKTION, HALBSEX, SEXTIL, QUADRATUR, TRIGON, QUINCUNX, OPOSITION };
-        static const double aspWinkel[] = { 0.0, 30.0, 60.0, 90.0, 120.0, 150.0, 180.0 };
-
-        int16_t asp = KEIN_ASP;
-        for (int a = 0; a < ASPEKTE; ++a) {
-          int idx = (i * MAX_PLANET + j) * ASPEKTE + a;
-          float orb = (idx < orben.size() && orben[idx] > 0.0f) ? orben[idx] : 8.0f;
-          if (std::abs(diff - aspWinkel[a]) <= orb) {
-            asp = aspekte[a];
-            break;
-          }
-        }
-
+        // Aspekt zwischen Transit-Planet i und Radix-Planet j (Orben aus
+        // den Einstellungen, siehe SynastrieCalc)
+        int16_t asp = kreuz->planetAspekt(j, i);
         if (asp == KEIN_ASP)
           continue;
 
+        double transitPos = m_transit->planet[i];
+        double radixPos = m_radix.planet[j];
+
         // Hervorgehobenen Aspekt überspringen (wird später gezeichnet)
         if (i == m_highlightTransitPlanet && j == m_highlightRadixPlanet) {
           continue;
@@ -1140,26 +1124,8 @@ void ChartWidget::drawAspects(QPainter &painter) {
       double transitPos = m_transit->planet[m_highlightTransitPlanet];
       double radixPos = m_radix.planet[m_highlightRadixPlanet];
 
-      // Aspekt berechnen
-      double diff = std::abs(transitPos - radixPos);
-      if (diff > 180.0)
-        diff = 360.0 - diff;
-
-      int asp = KEIN_ASP;
-      if (diff <= 10.0)
-        asp = KONJUNKTION;
-      else if (std::abs(diff - 30.0) <= 5.0)
-        asp = HALBSEX;
-      else if (std::abs(diff - 60.0) <= 8.0)
-        asp = SEXTIL;
-      else if (std::abs(diff - 90.0) <= 10.0)
-        asp = QUADRATUR;
-      else if (std::abs(diff - 120.0) <= 10.0)
-        asp = TRIGON;
-      else if (std::abs(diff - 150.0) <= 5.0)
-        asp = QUINCUNX;
-      else if (std::abs(diff - 180.0) <= 10.0)
-        asp = OPOSITION;
+      int asp = kreuzAspekte()->planetAspekt(m_highlightRadixPlanet,
+                                             m_highlightTransitPlanet);
 
       // Dickere, hellere Linie für Hervorhebung
       QColor color;
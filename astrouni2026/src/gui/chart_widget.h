@@ -10,6 +10,7 @@
 #include <QPainter>
 #include <QFont>
 #include "../core/data_types.h"
+#include <memory>
 
 namespace astro {
 
@@ -120,6 +121,14 @@ private:
     bool findPlanetAtPoint(const QPointF& p, int& planetIdx, bool& isTransit) const;
     int findHouseAtPoint(const QPointF& p) const;
     bool findAspectAtPoint(const QPointF& p, int& idx1, int& idx2, bool& isTransit) const;
+
+    /**
+     * @brief Kreuz-Aspekte Radix x Transit/Partner (nullptr ohne Transit)
+     *
+     * Übernimmt m_radix.synastrieErgebnis, wenn es noch passt, sonst wird
+     * einmal neu gerechnet und bis zur nächsten Änderung behalten.
+     */
+    const SynastrieErgebnis* kreuzAspekte() const;
     void toggleZoom(const QPoint& pos);
     void toggleAspectCircle();
     
@@ -205,6 +214,7 @@ private:
     Radix m_radix;
     const Radix* m_transit;
     AuInit m_auinit;
+    mutable std::shared_ptr<const SynastrieErgebnis> m_kreuz;
     
     // Zeichnungs-Parameter
     QPointF m_center;           // Mittelpunkt
@@ -0,0 +1,147 @@
+#include "diagnostics_dialog.h"
+#include "../../core/analysis_cache.h"
+#include "../../core/chart_cache.h"
+#include "../../core/chart_pipeline.h"
+#include "../../core/ephe_memory.h"
+#include "../../core/instrumentation.h"
+#include <QCheckBox>
+#include <QFileDialog>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QLabel>
+#include <QMessageBox>
+#include <QPushButton>
+#include <QTableWidget>
+#include <QVBoxLayout>
+
+namespace astro {
+
+DiagnosticsDialog::DiagnosticsDialog(QWidget* parent, const ChartPipeline* pipeline)
+    : QDialog(parent)
+    , m_table(new QTableWidget(this))
+    , m_cacheLabel(new QLabel(this))
+    , m_pipelineLabel(new QLabel(this))
+    , m_traceCheck(new QCheckBox(tr("Einzelne Aufrufe aufzeichnen (Chrome-Trace)"), this))
+    , m_pipeline(pipeline) {
+    setWindowTitle(tr("Diagnose"));
+    resize(720, 480);
+
+    auto* layout = new QVBoxLayout(this);
+
+    if (!Instrumentation::enabled()) {
+        layout->addWidget(new QLabel(
+            tr("Messpunkte sind nicht einkompiliert (ASTRO_INSTRUMENTATION=OFF)."), this));
+    }
+
+    m_table->setColumnCount(5);
+    m_table->setHorizontalHeaderLabels({ tr("Messpunkt"), tr("Anzahl"), tr("Gesamt ms"),
+                                         tr("Mittel µs"), tr("Max µs") });
+    m_table->horizontalHeader()->setSectionResizeMode(0, QHeaderView::Stretch);
+    m_table->verticalHeader()->setVisible(false);
+    m_table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_table->setSelectionBehavior(QAbstractItemView::SelectRows);
+    layout->addWidget(m_table);
+
+    layout->addWidget(m_cacheLabel);
+    layout->addWidget(m_pipelineLabel);
+    m_pipelineLabel->setVisible(m_pipeline != nullptr);
+
+    m_traceCheck->setChecked(Instrumentation::isTracing());
+    m_traceCheck->setEnabled(Instrumentation::enabled());
+    connect(m_traceCheck, &QCheckBox::toggled, this, &DiagnosticsDialog::onTracingToggled);
+    layout->addWidget(m_traceCheck);
+
+    auto* buttons = new QHBoxLayout();
+    auto* refreshButton = new QPushButton(tr("Aktualisieren"), this);
+    connect(refreshButton, &QPushButton::clicked, this, &DiagnosticsDialog::refresh);
+    buttons->addWidget(refreshButton);
+
+    auto* resetButton = new QPushButton(tr("Zurücksetzen"), this);
+    connect(resetButton, &QPushButton::clicked, this, &DiagnosticsDialog::onReset);
+    buttons->addWidget(resetButton);
+
+    auto* exportButton = new QPushButton(tr("Trace exportieren..."), this);
+    exportButton->setEnabled(Instrumentation::enabled());
+    connect(exportButton, &QPushButton::clicked, this, &DiagnosticsDialog::onExportTrace);
+    buttons->addWidget(exportButton);
+
+    buttons->addStretch();
+    auto* closeButton = new QPushButton(tr("Schließen"), this);
+    connect(closeButton, &QPushButton::clicked, this, &QDialog::accept);
+    buttons->addWidget(closeButton);
+    layout->addLayout(buttons);
+
+    refresh();
+}
+
+void DiagnosticsDialog::refresh() {
+    const QVector<InstrStat> stats = Instrumentation::snapshot();
+
+    m_table->setRowCount(stats.size());
+    for (int row = 0; row < stats.size(); ++row) {
+        const InstrStat& s = stats[row];
+
+        auto zahl = [](const QString& text) {
+            auto* item = new QTableWidgetItem(text);
+            item->setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
+            return item;
+        };
+
+        m_table->setItem(row, 0, new QTableWidgetItem(s.name));
+        m_table->setItem(row, 1, zahl(QString::number(s.count)));
+        if (s.isTimer) {
+            const double mittel = s.count > 0 ? s.totalNs / 1e3 / s.count : 0.0;
+            m_table->setItem(row, 2, zahl(QString::number(s.totalNs / 1e6, 'f', 2)));
+            m_table->setItem(row, 3, zahl(QString::number(mittel, 'f', 2)));
+            m_table->setItem(row, 4, zahl(QString::number(s.maxNs / 1e3, 'f', 1)));
+        } else {
+            for (int col = 2; col < 5; ++col) {
+                m_table->setItem(row, col, new QTableWidgetItem());
+            }
+        }
+    }
+
+    const ChartCache& charts = chartCache();
+    m_cacheLabel->setText(
+        tr("Chart-Cache: %1 Einträge, Trefferquote %2 %, %3 KB  |  Textanalyse-Cache: %4 Einträge"
+           "  |  Ephemeriden im Speicher: %5 Dateien, %6 KB  |  Trace-Ereignisse: %7")
+            .arg(charts.count())
+            .arg(charts.hitRate() * 100.0, 0, 'f', 0)
+            .arg(charts.memoryUsage() / 1024)
+            .arg(analysisCache().count())
+            .arg(EpheMemory::fileCount())
+            .arg(EpheMemory::totalBytes() / 1024)
+            .arg(Instrumentation::traceEventCount()));
+
+    if (m_pipeline) {
+        m_pipelineLabel->setText(
+            tr("Aktives Horoskop - zuletzt gerechnet: %1  |  gültig: %2")
+                .arg(ChartPipeline::stageNames(m_pipeline->lastStages()),
+                     ChartPipeline::stageNames(m_pipeline->validStages())));
+    }
+}
+
+void DiagnosticsDialog::onReset() {
+    Instrumentation::reset();
+    refresh();
+}
+
+void DiagnosticsDialog::onTracingToggled(bool on) {
+    Instrumentation::setTracing(on);
+}
+
+void DiagnosticsDialog::onExportTrace() {
+    QString filepath = QFileDialog::getSaveFileName(this, tr("Chrome-Trace speichern"),
+                                                    "astrouni_trace.json",
+                                                    tr("Trace (*.json)"));
+    if (filepath.isEmpty()) {
+        return;
+    }
+
+    if (Instrumentation::writeChromeTrace(filepath) != ERR_OK) {
+        QMessageBox::warning(this, tr("Fehler"),
+                             tr("Datei konnte nicht geschrieben werden:\n%1").arg(filepath));
+    }
+}
+
+} // namespace astro
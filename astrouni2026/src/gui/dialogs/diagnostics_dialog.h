@@ -0,0 +1,45 @@
+#pragma once
+/**
+ * @file diagnostics_dialog.h
+ * @brief Diagnose-Dialog: Messpunkte, Caches und Chrome-Trace-Export
+ */
+
+#include <QDialog>
+
+class QCheckBox;
+class QLabel;
+class QTableWidget;
+
+namespace astro {
+
+class ChartPipeline;
+
+/**
+ * @brief Zeigt die gesammelten Zeiten/Zähler (Instrumentation), den
+ *        Zustand der Caches und die zuletzt gelaufenen Pipeline-Stufen an
+ */
+class DiagnosticsDialog : public QDialog {
+    Q_OBJECT
+public:
+    /**
+     * @param parent Parent-Widget
+     * @param pipeline Pipeline des aktiven Horoskops (optional, muss den
+     *                 Dialog überleben)
+     */
+    explicit DiagnosticsDialog(QWidget* parent = nullptr, const ChartPipeline* pipeline = nullptr);
+
+private slots:
+    void refresh();
+    void onReset();
+    void onTracingToggled(bool on);
+    void onExportTrace();
+
+private:
+    QTableWidget* m_table;
+    QLabel* m_cacheLabel;
+    QLabel* m_pipelineLabel;
+    QCheckBox* m_traceCheck;
+    const ChartPipeline* m_pipeline;
+};
+
+} // namespace astro
@@ -7,6 +7,7 @@
 #include "ort_search_dialog.h"
 #include "person_search_dialog.h"
 #include "../../core/calculations.h"
+#include "../../core/chart_cache.h"
 #include "../../core/chart_calc.h"
 #include "../../data/person_db.h"
 
@@ -270,8 +271,8 @@ void PersonDialog::onCalc() {
     
     saveToRadix();
     
-    // Horoskop berechnen
-    int result = ChartCalc::calculate(m_radix, nullptr, m_auinit.sSelHoro);
+    // Horoskop berechnen (oder aus dem Chart-Cache übernehmen)
+    int result = chartCache().calculate(m_radix, m_auinit.sSelHoro);
     
     if (result == ERR_OK) {
         // Aspekte berechnen
@@ -1,45 +1,77 @@
 /**
  * @file retrograde_dialog.cpp
  * @brief Implementierung des Rückläufigkeits-Dialogs
- * 
- * 1:1 Port von DlgRuck aus legacy/autransi.c
+ *
+ * Port von DlgRuck aus legacy/autransi.c
  */
 
 #include "retrograde_dialog.h"
-#include <QVBoxLayout>
+#include "../../core/calendar.h"
+#include "../../core/calculations.h"
+#include "../../core/astro_font_provider.h"
 #include <QHBoxLayout>
+#include <QHeaderView>
+#include <QItemSelectionModel>
 #include <QPushButton>
+#include <QTableWidget>
+#include <QVBoxLayout>
+#include <cmath>
 
 namespace astro {
 
+namespace {
+
+QString zeitText(double jd, double zone) {
+    const CalDateTime dt = Calendar::fromJD(Calendar::utToLocal(jd, zone));
+    return QString("%1.%2.%3 %4:%5")
+        .arg(dt.tag, 2, 10, QChar('0'))
+        .arg(dt.monat, 2, 10, QChar('0'))
+        .arg(dt.jahr, 4, 10, QChar('0'))
+        .arg(dt.stunde, 2, 10, QChar('0'))
+        .arg(dt.minute, 2, 10, QChar('0'));
+}
+
+// Länge im Zeichen, z.B. "17°23' ♌"
+QString laengeText(double laenge) {
+    const double l = Calculations::mod360(laenge);
+    const int zeichen = static_cast<int>(l / 30.0) % 12;
+    const double imZeichen = l - zeichen * 30.0;
+    int grad = static_cast<int>(imZeichen);
+    int minute = static_cast<int>(std::round((imZeichen - grad) * 60.0));
+    if (minute == 60) {
+        ++grad;
+        minute = 0;
+    }
+    return QString("%1°%2' %3")
+        .arg(grad, 2, 10, QChar('0'))
+        .arg(minute, 2, 10, QChar('0'))
+        .arg(astroFont().sternzeichenSymbolUnicode(zeichen));
+}
+
+} // namespace
+
 RetrogradeDialog::RetrogradeDialog(QWidget* parent)
     : QDialog(parent)
-    , m_vonLabel(new QLabel(this))
-    , m_bisLabel(new QLabel(this)) {
-    
+    , m_table(new QTableWidget(this)) {
+
     setWindowTitle(tr("Rückläufigkeit"));
-    setModal(true);
-    
+    setModal(false);
+    setAttribute(Qt::WA_DeleteOnClose);
+    resize(620, 360);
+
     auto* layout = new QVBoxLayout(this);
-    
-    // Von-Zeile (STRICT LEGACY: TA_VON)
-    auto* vonLayout = new QHBoxLayout();
-    vonLayout->addWidget(new QLabel(tr("Von:"), this));
-    m_vonLabel->setMinimumWidth(100);
-    vonLayout->addWidget(m_vonLabel);
-    vonLayout->addStretch();
-    layout->addLayout(vonLayout);
-    
-    // Bis-Zeile (STRICT LEGACY: TA_BIS)
-    auto* bisLayout = new QHBoxLayout();
-    bisLayout->addWidget(new QLabel(tr("Bis:"), this));
-    m_bisLabel->setMinimumWidth(100);
-    bisLayout->addWidget(m_bisLabel);
-    bisLayout->addStretch();
-    layout->addLayout(bisLayout);
-    
-    layout->addStretch();
-    
+
+    // STRICT LEGACY: TA_VON / TA_BIS als Spalten
+    m_table->setColumnCount(6);
+    m_table->setHorizontalHeaderLabels({ tr("Planet"), tr("Von"), tr("in"), tr("Bis"), tr("in"),
+                                         tr("Tage") });
+    m_table->horizontalHeader()->setSectionResizeMode(QHeaderView::ResizeToContents);
+    m_table->horizontalHeader()->setStretchLastSection(true);
+    m_table->verticalHeader()->setVisible(false);
+    m_table->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_table->setSelectionBehavior(QAbstractItemView::SelectRows);
+    layout->addWidget(m_table);
+
     // OK-Button (STRICT LEGACY: PB_Ok)
     auto* buttonLayout = new QHBoxLayout();
     buttonLayout->addStretch();
@@ -48,13 +80,55 @@ RetrogradeDialog::RetrogradeDialog(QWidget* parent)
     connect(okButton, &QPushButton::clicked, this, &QDialog::accept);
     buttonLayout->addWidget(okButton);
     layout->addLayout(buttonLayout);
-    
-    setFixedSize(250, 120);
 }
 
-void RetrogradeDialog::setDaten(const QString& von, const QString& bis) {
-    m_vonLabel->setText(von.isEmpty() ? tr("N/A") : von);
-    m_bisLabel->setText(bis.isEmpty() ? tr("N/A") : bis);
+void RetrogradeDialog::setPerioden(const QVector<RuecklaufPeriode>& perioden, double zone) {
+    const QFont planetFont = astroFont().getPlanetSymbolFont(12);
+
+    m_table->setRowCount(perioden.size());
+    m_planetJeZeile.resize(perioden.size());
+    for (int row = 0; row < perioden.size(); ++row) {
+        const RuecklaufPeriode& p = perioden[row];
+        m_planetJeZeile[row] = p.planet;
+
+        auto* planet = new QTableWidgetItem(astroFont().planetSymbol(p.planet));
+        planet->setFont(planetFont);
+        planet->setTextAlignment(Qt::AlignCenter);
+        m_table->setItem(row, 0, planet);
+
+        // Offene Enden (Anfang/Ende des Zeitraums) ohne Station
+        auto* von = new QTableWidgetItem((p.flags & TT_OFFEN_BEGINN) ? QString("< ") + zeitText(p.beginn, zone)
+                                                                     : zeitText(p.beginn, zone));
+        m_table->setItem(row, 1, von);
+        auto* bis = new QTableWidgetItem((p.flags & TT_OFFEN_ENDE) ? zeitText(p.ende, zone) + QString(" >")
+                                                                   : zeitText(p.ende, zone));
+        m_table->setItem(row, 3, bis);
+
+        m_table->setItem(row, 2, new QTableWidgetItem(laengeText(p.laengeBeginn)));
+        m_table->setItem(row, 4, new QTableWidgetItem(laengeText(p.laengeEnde)));
+
+        auto* tage = new QTableWidgetItem(QString::number(p.ende - p.beginn, 'f', 1));
+        tage->setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
+        m_table->setItem(row, 5, tage);
+    }
+}
+
+void RetrogradeDialog::zeigePlanet(int planet) {
+    m_table->clearSelection();
+    int erste = -1;
+    for (int row = 0; row < m_planetJeZeile.size(); ++row) {
+        if (m_planetJeZeile[row] != planet) {
+            continue;
+        }
+        if (erste < 0) {
+            erste = row;
+        }
+        m_table->selectionModel()->select(m_table->model()->index(row, 0),
+                                          QItemSelectionModel::Select | QItemSelectionModel::Rows);
+    }
+    if (erste >= 0) {
+        m_table->scrollToItem(m_table->item(erste, 0), QAbstractItemView::PositionAtTop);
+    }
 }
 
 } // namespace astro
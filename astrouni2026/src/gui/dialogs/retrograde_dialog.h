@@ -2,36 +2,45 @@
 /**
  * @file retrograde_dialog.h
  * @brief Port des Legacy DlgRuck (Rückläufigkeits-Dialog)
- * 
- * Zeigt Rückläufigkeits-Perioden für einen Planeten an.
+ *
+ * Zeigt die Rückläufigkeits-Perioden aller Körper eines Transit-Laufs an.
  */
 
 #include <QDialog>
-#include <QLabel>
+#include <QVector>
+#include "../../core/transit_table.h"
+
+class QTableWidget;
 
 namespace astro {
 
 /**
  * @brief Rückläufigkeits-Dialog
- * 
+ *
  * Port von: DlgRuck aus legacy/autransi.c
- * Zeigt Von/Bis-Datum für eine Rückläufigkeits-Periode.
+ * Legacy zeigte Von/Bis für eine Periode je Dialog; hier eine Tabelle mit
+ * allen Perioden (Stationen R und D auf die Minute), nicht-modal.
  */
 class RetrogradeDialog : public QDialog {
     Q_OBJECT
 public:
     explicit RetrogradeDialog(QWidget* parent = nullptr);
-    
+
+    /**
+     * @brief Setzt die Perioden
+     * @param perioden nach Körper sortiert (Ruecklauf::calculate)
+     * @param zone Zonen-Offset für die Anzeige in Ortszeit (wie rFix.zone)
+     */
+    void setPerioden(const QVector<RuecklaufPeriode>& perioden, double zone);
+
     /**
-     * @brief Setzt die Von/Bis-Daten
-     * @param von Start-Datum der Rückläufigkeit
-     * @param bis Ende-Datum der Rückläufigkeit
+     * @brief Markiert die Perioden eines Körpers (erste Zeile sichtbar)
      */
-    void setDaten(const QString& von, const QString& bis);
+    void zeigePlanet(int planet);
 
 private:
-    QLabel* m_vonLabel;
-    QLabel* m_bisLabel;
+    QTableWidget* m_table;
+    QVector<int8_t> m_planetJeZeile;
 };
 
 } // namespace astro
@@ -78,6 +78,16 @@ void SettingsDialog::setupUI() {
     
     mainLayout->addWidget(teilungGroup);
     
+    // Optionen-Gruppe
+    QGroupBox* optionenGroup = new QGroupBox(tr("Optionen"), this);
+    QVBoxLayout* optionenLayout = new QVBoxLayout(optionenGroup);
+    
+    m_cacheCheck = new QCheckBox(tr("Berechnete Horoskope für die nächste Sitzung speichern"), this);
+    m_cacheCheck->setToolTip(tr("Nur Geburtsdaten und Positionen, keine Namen"));
+    optionenLayout->addWidget(m_cacheCheck);
+    
+    mainLayout->addWidget(optionenGroup);
+    
     // Buttons
     QHBoxLayout* buttonLayout = new QHBoxLayout();
     
@@ -114,6 +124,8 @@ void SettingsDialog::loadSettings() {
     m_planCheck->setChecked(m_auinit.sAspekte & S_PLAN);
     m_asterCheck->setChecked(m_auinit.sAspekte & S_ASTER);
     m_hausCheck->setChecked(m_auinit.sAspekte & S_HAUS);
+    
+    m_cacheCheck->setChecked(m_auinit.sOptionen & S_CACHE_DATEI);
 }
 
 void SettingsDialog::saveSettings() {
@@ -132,6 +144,9 @@ void SettingsDialog::saveSettings() {
     m_auinit.sTeilung = 0;
     if (m_3erCheck->isChecked()) m_auinit.sTeilung |= S_3er;
     if (m_9erCheck->isChecked()) m_auinit.sTeilung |= S_9er;
+    
+    m_auinit.sOptionen = 0;
+    if (m_cacheCheck->isChecked()) m_auinit.sOptionen |= S_CACHE_DATEI;
 }
 
 void SettingsDialog::onDefault() {
@@ -150,6 +165,8 @@ void SettingsDialog::onDefault() {
     m_planCheck->setChecked(true);
     m_asterCheck->setChecked(false);
     m_hausCheck->setChecked(false);
+    
+    m_cacheCheck->setChecked(false);
 }
 
 void SettingsDialog::onAccept() {
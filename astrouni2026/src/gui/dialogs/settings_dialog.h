@@ -47,6 +47,9 @@ private:
     QCheckBox* m_planCheck;     // Planeten
     QCheckBox* m_asterCheck;    // Asteroiden
     QCheckBox* m_hausCheck;     // Häuser
+    
+    // Optionen
+    QCheckBox* m_cacheCheck;    // Chart-Cache sichern
 };
 
 } // namespace astro
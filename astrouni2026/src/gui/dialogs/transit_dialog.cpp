@@ -181,6 +181,7 @@ void TransitDialog::calculateTransit() {
     m_transits.clear();
     m_transitTexts.clear();
     m_aspekte.clear();
+    m_zeichen.clear();
     
     QDate startDate = m_datumEdit->date();
     QTime startTime = m_zeitEdit->time();
@@ -188,17 +189,9 @@ void TransitDialog::calculateTransit() {
     QTime endTime = m_bisZeitEdit->time();
     int inkrement = m_inkrementGroup->checkedId();
     
-    // Anzahl Schritte berechnen für Progress
-    int steps = 0;
-    {
-        QDate d = startDate;
-        QTime t = startTime;
-        while (d < endDate || (d == endDate && t <= endTime)) {
-            ++steps;
-            if (TransitCalc::incDate(d, t, inkrement, 1) != ERR_OK) break;
-            if (steps > 100000) break;
-        }
-    }
+    // Anzahl Schritte für Progress
+    int steps = TransitCalc::stepCount(startDate, startTime, endDate, endTime,
+                                       TransitStep::fixed(inkrement));
     
     // Progress-Dialog (STRICT LEGACY: DlgTransAbort)
     m_abortFlag = false;
@@ -232,6 +225,11 @@ void TransitDialog::calculateTransit() {
     if (result >= 0 && !m_transits.isEmpty()) {
         m_transitRadix = m_transits.first();
         m_calculated = true;
+        // Zeichen-Eintritte für die Beschreibung der Sequenzen (ohne
+        // Erfolg baut die Ergebnis-Liste sie selbst auf)
+        if (m_transits.size() > 1 && !m_abortFlag) {
+            m_zeichen.build(m_basisRadix, m_transits.first().jd, m_transits.last().jd, &m_abortFlag);
+        }
     } else if (result >= 0 && m_transits.isEmpty()) {
         // Fallback: Einzel-Transit
         result = TransitCalc::calcTransit(m_basisRadix, m_transitRadix, startDate, startTime);
@@ -15,6 +15,7 @@
 #include <QVector>
 #include "../../core/data_types.h"
 #include "../../core/transit_calc.h"
+#include "../../core/sign_timeline.h"
 
 namespace astro {
 
@@ -56,6 +57,7 @@ public:
      * @brief Multi-Transit Metadaten und Auswahl
      */
     const QVector<TransitAspekt>& getTransitAspekte() const { return m_aspekte; }
+    const SignTimeline& getSignTimeline() const { return m_zeichen; }
     QVector<QVector<bool>> getTransSel() const { return m_transSel; }
     QString getVonDatum() const;
     QString getBisDatum() const;
@@ -79,6 +81,7 @@ private:
     QVector<Radix> m_transits;
     QVector<QString> m_transitTexts;
     QVector<TransitAspekt> m_aspekte;
+    SignTimeline m_zeichen;            // Zeichen-Eintritte der Transit-Körper
     QVector<QVector<bool>> m_transSel; // Auswahlmatrix (TransitPlanet x Radix/Haus)
     bool m_abortFlag = false;
     
@@ -0,0 +1,135 @@
+/**
+ * @file glyph_atlas.cpp
+ * @brief Implementierung des Symbol-Zwischenspeichers
+ */
+
+#include "glyph_atlas.h"
+#include "../core/instrumentation.h"
+#include <QFontMetricsF>
+#include <QPaintEngine>
+#include <QtMath>
+
+namespace astro {
+
+namespace {
+
+// Obergrenze, danach wird neu aufgebaut (Zoom-/Font-Wechsel erzeugen neue
+// Schlüssel, die alten werden nicht mehr gebraucht)
+constexpr int MAX_GLYPHEN = 4096;
+
+} // namespace
+
+GlyphAtlas &GlyphAtlas::instance() {
+  static GlyphAtlas atlas;
+  return atlas;
+}
+
+void GlyphAtlas::clear() { m_glyphen.clear(); }
+
+GlyphAtlas::Glyph &GlyphAtlas::glyph(const QPainter &painter,
+                                     const QString &symbol) {
+  const QFont &font = painter.font();
+  QPaintDevice *device = painter.device();
+
+  Schluessel k;
+  k.familie = font.family();
+  k.symbol = symbol;
+  // Pixelgrößen negativ, damit sie nicht mit Punktgrößen zusammenfallen
+  k.groesse = font.pointSizeF() > 0 ? font.pointSizeF() : -font.pixelSize();
+  k.dpi = device ? device->logicalDpiY() : 0;
+  k.gewicht = font.weight();
+  k.kursiv = font.italic();
+
+  auto it = m_glyphen.find(k);
+  if (it != m_glyphen.end()) {
+    ASTRO_COUNT("GlyphAtlas::treffer", 1);
+    return it.value();
+  }
+
+  ASTRO_COUNT("GlyphAtlas::neu", 1);
+  if (m_glyphen.size() >= MAX_GLYPHEN) {
+    m_glyphen.clear();
+  }
+
+  // Font auf die Auflösung des Geräts bringen - wie bei drawText
+  const QFont geraeteFont = device ? QFont(font, device) : font;
+  const QFontMetricsF fm(geraeteFont);
+
+  Glyph g;
+  g.pfad.addText(0.0, 0.0, geraeteFont, symbol);
+  g.umriss = g.pfad.boundingRect().adjusted(-1.0, -1.0, 1.0, 1.0);
+  g.breite = fm.horizontalAdvance(symbol);
+  g.ascent = fm.ascent();
+  g.descent = fm.descent();
+  return m_glyphen.insert(k, g).value();
+}
+
+void GlyphAtlas::zeichne(QPainter &painter, Glyph &g, const QPointF &ursprung) {
+  if (painter.pen().style() == Qt::NoPen || g.pfad.isEmpty()) {
+    return;
+  }
+  const QColor farbe = painter.pen().color();
+
+  // Bild nur, wenn es 1:1 auf die Pixel des Geräts fällt: Raster ohne
+  // Skalierung, oder genau um das Pixel-Verhältnis des Geräts skaliert
+  const QPaintEngine *engine = painter.paintEngine();
+  const QTransform t = painter.deviceTransform();
+  const qreal dpr = painter.device() ? painter.device()->devicePixelRatioF() : 1.0;
+  const bool raster =
+      engine && engine->type() == QPaintEngine::Raster &&
+      (t.type() <= QTransform::TxTranslate ||
+       (t.type() == QTransform::TxScale && qFuzzyCompare(t.m11(), dpr) &&
+        qFuzzyCompare(t.m22(), dpr)));
+
+  if (!raster) {
+    // Vektor (PDF/Drucker) oder gezoomt: Umriss füllen
+    painter.save();
+    painter.setRenderHint(QPainter::Antialiasing, true);
+    painter.translate(ursprung);
+    painter.fillPath(g.pfad, farbe);
+    painter.restore();
+    return;
+  }
+
+  const qreal faktor = t.type() <= QTransform::TxTranslate ? 1.0 : dpr;
+  const quint64 bildKey = (quint64(farbe.rgba()) << 32) |
+                          quint32(qRound(faktor * 100.0));
+  auto it = g.bilder.find(bildKey);
+  if (it == g.bilder.end()) {
+    const QSize groesse(qCeil(g.umriss.width() * faktor),
+                        qCeil(g.umriss.height() * faktor));
+    QImage bild(groesse, QImage::Format_ARGB32_Premultiplied);
+    bild.setDevicePixelRatio(faktor);
+    bild.fill(Qt::transparent);
+    QPainter p(&bild);
+    p.setRenderHint(QPainter::Antialiasing, true);
+    p.translate(-g.umriss.topLeft());
+    p.fillPath(g.pfad, farbe);
+    p.end();
+    it = g.bilder.insert(bildKey, bild);
+  }
+  painter.drawImage(ursprung + g.umriss.topLeft(), it.value());
+}
+
+void GlyphAtlas::drawText(QPainter &painter, const QPointF &pos,
+                          const QString &symbol) {
+  if (symbol.isEmpty()) {
+    return;
+  }
+  zeichne(painter, glyph(painter, symbol), pos);
+}
+
+void GlyphAtlas::drawTextCentered(QPainter &painter, const QRectF &rect,
+                                  const QString &symbol) {
+  if (symbol.isEmpty()) {
+    return;
+  }
+  Glyph &g = glyph(painter, symbol);
+  // Wie Qt::AlignCenter: Vorschub und Zeilenhöhe (ascent + descent) mittig
+  const QPointF ursprung(rect.center().x() - g.breite / 2.0,
+                         rect.center().y() - (g.ascent + g.descent) / 2.0 +
+                             g.ascent);
+  zeichne(painter, g, ursprung);
+}
+
+} // namespace astro
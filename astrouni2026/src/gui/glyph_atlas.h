@@ -0,0 +1,85 @@
+#pragma once
+/**
+ * @file glyph_atlas.h
+ * @brief Zwischenspeicher für Astrologie-Symbole beim Zeichnen
+ *
+ * Planeten-, Sternzeichen- und Aspekt-Symbole werden pro Font, Größe und
+ * Zeichen einmal in einen Umriss (QPainterPath) umgewandelt. Auf Raster-
+ * Geräten ohne Skalierung (Chart-Puffer, Bilder) wird daraus je Farbe und
+ * Pixel-Verhältnis ein Bild, das nur noch kopiert wird; auf Vektor-Geräten
+ * (PDF, Drucker) und bei Skalierung wird der Umriss gefüllt. In beiden
+ * Fällen entfällt das Text-Shaping pro Symbol und Bild.
+ *
+ * Nur im GUI-Thread verwenden.
+ */
+
+#include <QColor>
+#include <QFont>
+#include <QHash>
+#include <QImage>
+#include <QPainter>
+#include <QPainterPath>
+#include <QString>
+
+namespace astro {
+
+class GlyphAtlas {
+public:
+    static GlyphAtlas& instance();
+
+    /**
+     * @brief Wie painter.drawText(rect, Qt::AlignCenter, symbol)
+     *
+     * Font und Farbe kommen wie bei drawText aus painter.font() und
+     * painter.pen().
+     */
+    void drawTextCentered(QPainter& painter, const QRectF& rect, const QString& symbol);
+
+    /**
+     * @brief Wie painter.drawText(pos, symbol) - pos liegt auf der Grundlinie
+     */
+    void drawText(QPainter& painter, const QPointF& pos, const QString& symbol);
+
+    void clear();
+    int size() const { return m_glyphen.size(); }
+
+private:
+    GlyphAtlas() = default;
+
+    struct Schluessel {
+        QString familie;
+        QString symbol;
+        qreal   groesse;    // Punkt- oder Pixelgröße
+        int     dpi;
+        int     gewicht;
+        bool    kursiv;
+
+        bool operator==(const Schluessel& o) const {
+            return groesse == o.groesse && dpi == o.dpi && gewicht == o.gewicht
+                && kursiv == o.kursiv && symbol == o.symbol && familie == o.familie;
+        }
+        friend size_t qHash(const Schluessel& k, size_t seed = 0) {
+            return qHashMulti(seed, k.familie, k.symbol, k.groesse, k.dpi, k.gewicht, k.kursiv);
+        }
+    };
+
+    struct Glyph {
+        QPainterPath pfad;          // Umriss, Ursprung links auf der Grundlinie
+        QRectF       umriss;        // Ausdehnung des Pfads (+ Rand für Kantenglättung)
+        qreal        breite = 0.0;  // Vorschub
+        qreal        ascent = 0.0;
+        qreal        descent = 0.0;
+        QHash<quint64, QImage> bilder;  // Farbe (RGBA) + Pixel-Verhältnis
+    };
+
+    Glyph& glyph(const QPainter& painter, const QString& symbol);
+    void zeichne(QPainter& painter, Glyph& g, const QPointF& ursprung);
+
+    QHash<Schluessel, Glyph> m_glyphen;
+};
+
+inline GlyphAtlas& glyphAtlas() {
+    return GlyphAtlas::instance();
+}
+
+} // namespace astro
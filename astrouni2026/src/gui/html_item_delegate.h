@@ -9,6 +9,7 @@
 #include <QStyledItemDelegate>
 #include <QTextDocument>
 #include <QAbstractTextDocumentLayout>
+#include <QCache>
 #include <QPainter>
 #include <QApplication>
 
@@ -16,11 +17,17 @@ namespace astro {
 
 /**
  * @brief Delegate für HTML-formatierte ListWidget Items
+ *
+ * Das Layout (QTextDocument) einer Zeile wird nach Text und Font
+ * zwischengespeichert - paint() und sizeHint() beim Scrollen und
+ * Neuzeichnen parsen den HTML-Text nicht erneut. Der Schlüssel ist der
+ * Inhalt selbst, bei geänderten Daten ist nichts zu invalidieren.
  */
 class HtmlItemDelegate : public QStyledItemDelegate {
 public:
     explicit HtmlItemDelegate(QObject* parent = nullptr) 
-        : QStyledItemDelegate(parent) {}
+        : QStyledItemDelegate(parent)
+        , m_layouts(LAYOUT_CACHE) {}
     
     void paint(QPainter* painter, const QStyleOptionViewItem& option,
                const QModelIndex& index) const override {
@@ -36,9 +43,7 @@ public:
         }
         
         // HTML-Text rendern
-        QTextDocument doc;
-        doc.setDefaultFont(opt.font);
-        doc.setHtml(opt.text);
+        QTextDocument* doc = layout(opt);
         
         painter->save();
         painter->translate(opt.rect.topLeft());
@@ -49,7 +54,7 @@ public:
             ctx.palette.setColor(QPalette::Text, opt.palette.highlightedText().color());
         }
         
-        doc.documentLayout()->draw(painter, ctx);
+        doc->documentLayout()->draw(painter, ctx);
         painter->restore();
     }
     
@@ -58,12 +63,26 @@ public:
         QStyleOptionViewItem opt = option;
         initStyleOption(&opt, index);
         
-        QTextDocument doc;
-        doc.setDefaultFont(opt.font);
-        doc.setHtml(opt.text);
-        
-        return QSize(doc.idealWidth(), doc.size().height());
+        QTextDocument* doc = layout(opt);
+        return QSize(doc->idealWidth(), doc->size().height());
+    }
+
+private:
+    static constexpr int LAYOUT_CACHE = 512;    // Dokumente (etwa zwei Bildschirmseiten x Fenster)
+    
+    QTextDocument* layout(const QStyleOptionViewItem& opt) const {
+        const QString key = opt.font.key() + QLatin1Char('\n') + opt.text;
+        if (QTextDocument* doc = m_layouts.object(key)) {
+            return doc;
+        }
+        auto* doc = new QTextDocument();
+        doc->setDefaultFont(opt.font);
+        doc->setHtml(opt.text);
+        m_layouts.insert(key, doc);
+        return doc;
     }
+    
+    mutable QCache<QString, QTextDocument> m_layouts;
 };
 
 } // namespace astro
@@ -19,14 +19,18 @@
 #include "dialogs/farben_dialog.h"
 #include "dialogs/settings_dialog.h"
 #include "dialogs/text_editor_dialog.h"
+#include "dialogs/diagnostics_dialog.h"
 #include "../data/legacy_io.h"
 #include "../data/orte_db.h"
 #include "../data/person_db.h"
 #include "../core/swiss_eph.h"
-#include "../core/chart_calc.h"
+#include "../core/chart_cache.h"
+#include "../core/chart_pipeline.h"
+#include "../core/synastry.h"
 #include "../core/astro_font_provider.h"
 
 #include <QMenuBar>
+#include <QStatusBar>
 #include <QMessageBox>
 #include <QApplication>
 #include <QDir>
@@ -109,12 +113,25 @@ MainWindow::MainWindow(QWidget* parent)
     orteDB().load(dataPath + "/" + ORTDAT);
     personDB().load(dataPath);
     
+    // Chart-Cache der letzten Sitzung (nur wenn eingeschaltet, fehlt beim ersten Start)
+    if (m_auinit.sOptionen & S_CACHE_DATEI) {
+        chartCache().load(dataPath + "/" + CACHEDAT);
+    }
+    
     // Farben initialisieren
     initDefaultColors();
 }
 
 MainWindow::~MainWindow() {
     saveSettings();
+    
+    // Ausgeschaltet: auch den Stand einer früheren Sitzung nicht liegen lassen
+    const QString cacheDatei = legacyIO().getDataPath() + "/" + CACHEDAT;
+    if (m_auinit.sOptionen & S_CACHE_DATEI) {
+        chartCache().save(cacheDatei);
+    } else {
+        QFile::remove(cacheDatei);
+    }
 }
 
 //==============================================================================
@@ -177,6 +194,9 @@ void MainWindow::setupActions() {
     
     m_helpAboutAction = new QAction(tr("Ü&ber AstroUniverse"), this);
     connect(m_helpAboutAction, &QAction::triggered, this, &MainWindow::onHelpAbout);
+    
+    m_diagnoseAction = new QAction(tr("&Diagnose..."), this);
+    connect(m_diagnoseAction, &QAction::triggered, this, &MainWindow::onDiagnose);
 }
 
 void MainWindow::setupMenus() {
@@ -206,6 +226,7 @@ void MainWindow::setupMenus() {
     // Hilfe-Menü (Port von MAINMENU -> "&Hilfe")
     m_hilfeMenu = menuBar()->addMenu(tr("&Hilfe"));
     m_hilfeMenu->addAction(m_helpIndexAction);
+    m_hilfeMenu->addAction(m_diagnoseAction);
     m_hilfeMenu->addSeparator();
     m_hilfeMenu->addAction(m_helpAboutAction);
     m_hilfeMenu->setMinimumWidth(250);  // Mindestbreite für vollständige Texte
@@ -244,30 +265,39 @@ void MainWindow::onFileExportPdf() {
         return;
     }
     
-    // PdfExporter erstellen falls noch nicht vorhanden
-    if (!m_pdfExporter) {
-        m_pdfExporter = new PdfExporter(this);
-    }
-    
     const Radix& radix = radixWindow->getRadix();
     
     // Prüfen ob Synastrie/Transit vorhanden
     if (radix.synastrie) {
         if (radix.horoTyp == TYP_TRANSIT) {
             // Transit exportieren
-            m_pdfExporter->exportTransit(radix, *radix.synastrie, m_auinit, 
+            pdfExporter()->exportTransit(radix, *radix.synastrie, m_auinit, 
                                           radixWindow->getChartWidget(), this);
         } else {
             // Synastrie exportieren
-            m_pdfExporter->exportSynastrie(radix, *radix.synastrie, m_auinit, 
+            pdfExporter()->exportSynastrie(radix, *radix.synastrie, m_auinit, 
                                             radixWindow->getChartWidget(), this);
         }
     } else {
         // Radix als PDF exportieren
-        m_pdfExporter->exportRadix(radix, m_auinit, radixWindow->getChartWidget(), this);
+        pdfExporter()->exportRadix(radix, m_auinit, radixWindow->getChartWidget(), this);
     }
 }
 
+PdfExporter* MainWindow::pdfExporter() {
+    if (!m_pdfExporter) {
+        m_pdfExporter = new PdfExporter(this);
+        // Export und Druck laufen nach der Rückkehr noch weiter
+        connect(m_pdfExporter, &PdfExporter::exportFinished, this,
+                [this](const QString& ziel, bool ok) {
+            statusBar()->showMessage(ok ? tr("Fertig: %1").arg(ziel)
+                                        : tr("Fehler beim Schreiben von %1").arg(ziel),
+                                     5000);
+        });
+    }
+    return m_pdfExporter;
+}
+
 void MainWindow::onFilePrint() {
     // Prüfen ob ein Radix-Tab aktiv ist
     RadixWindow* radixWindow = qobject_cast<RadixWindow*>(m_tabWidget->currentWidget());
@@ -277,27 +307,22 @@ void MainWindow::onFilePrint() {
         return;
     }
     
-    // PdfExporter erstellen falls noch nicht vorhanden
-    if (!m_pdfExporter) {
-        m_pdfExporter = new PdfExporter(this);
-    }
-    
     const Radix& radix = radixWindow->getRadix();
     
     // Prüfen ob Synastrie/Transit vorhanden
     if (radix.synastrie) {
         if (radix.horoTyp == TYP_TRANSIT) {
             // Transit drucken
-            m_pdfExporter->printTransit(radix, *radix.synastrie, m_auinit, 
+            pdfExporter()->printTransit(radix, *radix.synastrie, m_auinit, 
                                          radixWindow->getChartWidget(), this);
         } else {
             // Synastrie drucken
-            m_pdfExporter->printSynastrie(radix, *radix.synastrie, m_auinit, 
+            pdfExporter()->printSynastrie(radix, *radix.synastrie, m_auinit, 
                                            radixWindow->getChartWidget(), this);
         }
     } else {
         // Radix drucken
-        m_pdfExporter->printRadix(radix, m_auinit, radixWindow->getChartWidget(), this);
+        pdfExporter()->printRadix(radix, m_auinit, radixWindow->getChartWidget(), this);
     }
 }
 
@@ -316,34 +341,21 @@ void MainWindow::onPersonErfassen() {
     if (dialog.exec() == QDialog::Accepted) {
         // Nur Radix-Tab öffnen wenn berechnet wurde
         if (dialog.wasCalculated()) {
+            // Der Dialog hat einen neuen Radix berechnet
+            m_pipeline.adopt(m_currentRadix, m_auinit, m_auinit.sSelHoro);
+            
             // Bei Synastrie: Zweite Person auswählen
             if (m_auinit.sSelHoro == TYP_SYNASTRIE) {
-                PersonSearchDialog searchDialog2(this);
-                searchDialog2.setWindowTitle(tr("Person 2 auswählen"));
-                if (searchDialog2.exec() != QDialog::Accepted || !searchDialog2.hasSelection()) {
-                    return;  // Abgebrochen
-                }
-                
-                // Zweiten Radix erstellen
-                m_currentRadix.synastrie = std::make_shared<Radix>();
-                m_currentRadix.synastrie->rFix = searchDialog2.getSelectedPerson();
-                m_currentRadix.synastrie->hausSys = m_auinit.sSelHaus;
-                m_currentRadix.synastrie->horoTyp = TYP_SYNASTRIE;
-                
-                // Zweiten Radix berechnen
-                int result2 = ChartCalc::calculate(*m_currentRadix.synastrie, nullptr, TYP_SYNASTRIE);
-                if (result2 != ERR_OK) {
-                    QMessageBox::warning(this, tr("Fehler"), 
-                        tr("Fehler bei der Berechnung der zweiten Person (Code: %1)").arg(result2));
-                    m_currentRadix.synastrie.reset();
+                if (!calcSynastriePartner()) {
                     return;
                 }
-                ChartCalc::calcAspects(*m_currentRadix.synastrie, m_auinit.orbenSPlanet);
                 
-                // Aspekte für Synastrie neu berechnen
-                ChartCalc::calcAspects(m_currentRadix, m_auinit.orbenSPlanet);
-                ChartCalc::calcAngles(m_currentRadix, m_currentRadix.synastrie.get(), TYP_SYNASTRIE);
-                ChartCalc::calcHouseAspects(m_currentRadix, m_auinit.orbenHaus, m_auinit.sAspekte);
+                // Kreuz-Aspekte zum bereits berechneten Radix
+                const Radix* partner = m_currentRadix.synastrie.get();
+                m_currentRadix.synastrieErgebnis = std::make_shared<const SynastrieErgebnis>(
+                    SynastrieCalc::calculate(m_currentRadix, *partner, m_auinit, TYP_SYNASTRIE,
+                                             SynastrieCalc::SYN_ASPEKTE));
+                m_pipeline.adopt(m_currentRadix, m_auinit, TYP_SYNASTRIE, partner);
             }
             
             // Neues Radix-Widget als Tab erstellen
@@ -355,6 +367,29 @@ void MainWindow::onPersonErfassen() {
     }
 }
 
+bool MainWindow::calcSynastriePartner() {
+    PersonSearchDialog searchDialog2(this);
+    searchDialog2.setWindowTitle(tr("Person 2 auswählen"));
+    if (searchDialog2.exec() != QDialog::Accepted || !searchDialog2.hasSelection()) {
+        return false;  // Abgebrochen
+    }
+    
+    // Zweiten Radix erstellen und berechnen (oder aus dem Chart-Cache übernehmen)
+    m_currentRadix.synastrie = std::make_shared<Radix>();
+    m_currentRadix.synastrie->rFix = searchDialog2.getSelectedPerson();
+    m_currentRadix.synastrie->hausSys = m_auinit.sSelHaus;
+    m_currentRadix.synastrie->horoTyp = TYP_SYNASTRIE;
+    
+    int result = chartCache().calculate(*m_currentRadix.synastrie, TYP_SYNASTRIE);
+    if (result != ERR_OK) {
+        QMessageBox::warning(this, tr("Fehler"), 
+            tr("Fehler bei der Berechnung der zweiten Person (Code: %1)").arg(result));
+        m_currentRadix.synastrie.reset();
+        return false;
+    }
+    return true;
+}
+
 void MainWindow::onOrtErfassen() {
     // Port von: DlgOErfassen
     OrtDialog dialog(this);
@@ -388,42 +423,22 @@ void MainWindow::onHoroTyp() {
     m_currentRadix.hausSys = m_auinit.sSelHaus;
     m_currentRadix.horoTyp = m_auinit.sSelHoro;
     m_currentRadix.synastrie.reset();
+    m_pipeline.invalidate();
     
-    // Bei Synastrie: Person 2 auswählen
-    if (m_auinit.sSelHoro == TYP_SYNASTRIE) {
-        PersonSearchDialog searchDialog2(this);
-        searchDialog2.setWindowTitle(tr("Person 2 auswählen"));
-        if (searchDialog2.exec() != QDialog::Accepted || !searchDialog2.hasSelection()) {
-            return;  // Abgebrochen
-        }
-        
-        // Zweiten Radix erstellen
-        m_currentRadix.synastrie = std::make_shared<Radix>();
-        m_currentRadix.synastrie->rFix = searchDialog2.getSelectedPerson();
-        m_currentRadix.synastrie->hausSys = m_auinit.sSelHaus;
-        m_currentRadix.synastrie->horoTyp = TYP_SYNASTRIE;
-        
-        // Zweiten Radix berechnen
-        int result2 = ChartCalc::calculate(*m_currentRadix.synastrie, nullptr, TYP_SYNASTRIE);
-        if (result2 != ERR_OK) {
-            QMessageBox::warning(this, tr("Fehler"), 
-                tr("Fehler bei der Berechnung der zweiten Person (Code: %1)").arg(result2));
-            m_currentRadix.synastrie.reset();
-            return;
-        }
-        ChartCalc::calcAspects(*m_currentRadix.synastrie, m_auinit.orbenSPlanet);
+    // Bei Synastrie: Person 2 auswählen (Kreuz-Aspekte rechnet die Pipeline unten)
+    if (m_auinit.sSelHoro == TYP_SYNASTRIE && !calcSynastriePartner()) {
+        return;
     }
     
     // STRICT LEGACY: Bei Transit erst Basis-Radix berechnen, dann Transit-Dialog öffnen
     if (m_auinit.sSelHoro == TYP_TRANSIT) {
         // Erst Basis-Radix berechnen
-        int result = ChartCalc::calculate(m_currentRadix, nullptr, TYP_RADIX);
+        int result = m_pipeline.run(m_currentRadix, m_auinit, TYP_RADIX);
         if (result != ERR_OK) {
             QMessageBox::warning(this, tr("Fehler"), 
                 tr("Fehler bei der Berechnung des Basis-Radix (Code: %1)").arg(result));
             return;
         }
-        ChartCalc::calcAspects(m_currentRadix, m_auinit.orbenPlanet);
         
         // Transit-Dialog öffnen (Port von DlgTransit)
         TransitDialog transitDialog(this, m_auinit, m_currentRadix);
@@ -435,10 +450,9 @@ void MainWindow::onHoroTyp() {
         m_currentRadix.synastrie = std::make_shared<Radix>(transitDialog.getTransitRadix());
         m_currentRadix.horoTyp = TYP_TRANSIT;
         
-        // Aspekte zwischen Radix und Transit berechnen
-        ChartCalc::calcAspects(m_currentRadix, m_auinit.orbenTPlanet);
-        ChartCalc::calcAngles(m_currentRadix, m_currentRadix.synastrie.get(), TYP_TRANSIT);
-        ChartCalc::calcHouseAspects(m_currentRadix, m_auinit.orbenHaus, m_auinit.sAspekte);
+        // Aspekte zwischen Radix und Transit berechnen (nur Aspekt-Stufe)
+        m_pipeline.calcAspects(m_currentRadix, m_auinit, TYP_TRANSIT,
+                               m_currentRadix.synastrie.get());
         
         // Transit-Auswahl-Dialog (Port von DlgTransEin)
         TransSelDialog transSelDialog(this);
@@ -488,7 +502,8 @@ void MainWindow::onHoroTyp() {
                                    transitDialog.getTransitAspekte(),
                                    transitDialog.getVonDatum(),
                                    transitDialog.getBisDatum(),
-                                   transSel);
+                                   transSel,
+                                   transitDialog.getSignTimeline());
         transitResult->setTransitSelection(transSel);
         
         // Transits kopieren für Lambda (Dialog wird nach Scope zerstört)
@@ -518,21 +533,12 @@ void MainWindow::onHoroTyp() {
         return;
     }
     
-    // Ersten Radix berechnen (Radix oder Synastrie)
-    int result = ChartCalc::calculate(m_currentRadix, 
-        m_currentRadix.synastrie.get(), m_auinit.sSelHoro);
+    // Ersten Radix berechnen (Radix oder Synastrie), inkl. Aspekte mit
+    // passenden Orben und Häuser-Aspekten (nur wenn in den Einstellungen aktiviert)
+    int result = m_pipeline.run(m_currentRadix, m_auinit, m_auinit.sSelHoro,
+                                m_currentRadix.synastrie.get());
     
     if (result == ERR_OK) {
-        // Aspekte mit passenden Orben berechnen
-        if (m_auinit.sSelHoro == TYP_SYNASTRIE) {
-            ChartCalc::calcAspects(m_currentRadix, m_auinit.orbenSPlanet);
-        } else {
-            ChartCalc::calcAspects(m_currentRadix, m_auinit.orbenPlanet);
-        }
-        ChartCalc::calcAngles(m_currentRadix, m_currentRadix.synastrie.get(), m_auinit.sSelHoro);
-        // Häuser-Aspekte (nur wenn in den Einstellungen aktiviert)
-        ChartCalc::calcHouseAspects(m_currentRadix, m_auinit.orbenHaus, m_auinit.sAspekte);
-        
         // Neues Radix-Widget als Tab erstellen
         RadixWindow* radixWidget = new RadixWindow(m_tabWidget, m_auinit, m_currentRadix);
         int tabIndex = m_tabWidget->addTab(radixWidget, radixWidget->getTabTitle());
@@ -759,6 +765,13 @@ void MainWindow::onHelpAbout() {
            "<p>Portiert nach Qt6/C++20</p>"));
 }
 
+void MainWindow::onDiagnose() {
+    // Stufen des aktiven Horoskop-Tabs, sonst die des Hauptfensters
+    RadixWindow* radixWindow = qobject_cast<RadixWindow*>(m_tabWidget->currentWidget());
+    DiagnosticsDialog dialog(this, radixWindow ? &radixWindow->getPipeline() : &m_pipeline);
+    dialog.exec();
+}
+
 //==============================================================================
 // Tab-Verwaltung
 //==============================================================================
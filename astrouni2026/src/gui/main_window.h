@@ -12,6 +12,7 @@
 #include <QList>
 #include <QTabWidget>
 #include "../core/data_types.h"
+#include "../core/chart_pipeline.h"
 
 namespace astro {
 
@@ -68,6 +69,7 @@ private slots:
     // Hilfe-Menü
     void onHelpIndex();
     void onHelpAbout();
+    void onDiagnose();
     
     // Radix-Tabs
     void onTabCloseRequested(int index);
@@ -78,6 +80,17 @@ private:
     void loadSettings();
     void saveSettings();
     
+    /**
+     * @brief Wählt Person 2 der Synastrie und berechnet ihren Radix
+     * @return false bei Abbruch oder Fehler (m_currentRadix.synastrie leer)
+     */
+    bool calcSynastriePartner();
+    
+    /**
+     * @brief PdfExporter (bei Bedarf erzeugt); meldet fertige Exporte in der Statusleiste
+     */
+    PdfExporter* pdfExporter();
+    
     // Menüs
     QMenu* m_fileMenu;
     QMenu* m_erfassenMenu;
@@ -97,10 +110,12 @@ private:
     QAction* m_aspekteAction;
     QAction* m_helpIndexAction;
     QAction* m_helpAboutAction;
+    QAction* m_diagnoseAction;
     
     // Daten
     AuInit m_auinit;
     Radix m_currentRadix;
+    ChartPipeline m_pipeline;   // Stufen von m_currentRadix
     
     // Tab-Widget für Radix-Anzeigen
     QTabWidget* m_tabWidget;
@@ -7,17 +7,27 @@
 #include "../core/astro_font_provider.h"
 #include "../core/astro_text_analyzer.h"
 #include "../core/constants.h"
+#include "../core/instrumentation.h"
+#include "../core/synastry.h"
 #include "chart_widget.h"
+#include "glyph_atlas.h"
 
 #include <QAbstractTextDocumentLayout>
+#include <QCoreApplication>
 #include <QDate>
 #include <QFileDialog>
+#include <QFontMetrics>
+#include <QFuture>
+#include <QFutureWatcher>
 #include <QPainter>
 #include <QPixmap>
+#include <QPointer>
 #include <QPrintDialog>
 #include <QPrinter>
 #include <QTextDocument>
+#include <QtConcurrent>
 #include <cmath>
+#include <memory>
 
 namespace astro {
 
@@ -45,6 +55,162 @@ static const AspLegende aspekte[] = {
     {OPOSITION, "Opposition"},    {QUINCUNX, "Quincunx"},
     {HALBSEX, "Halbsextil"}};
 
+// Planeten-, Zeichen- und Aspekt-Symbole über den Glyph-Cache (kein
+// Text-Shaping je Tabellenzeile); x/y wie bei drawText auf der Grundlinie
+static void drawSymbol(QPainter &painter, int x, int y, const QString &symbol) {
+  glyphAtlas().drawText(painter, QPointF(x, y), symbol);
+}
+
+//==============================================================================
+// Textanalyse-Pipeline
+//==============================================================================
+//
+// Die Textanalyse (HTML-Erzeugung + QTextDocument-Layout) ist der teuerste
+// Teil eines Exports. Sie wird beim Start von renderXxxPage() auf einem
+// Worker-Thread angestoßen. Der GUI-Thread schreibt währenddessen Grafik,
+// Tabellen und Aspekte in den QPrinter und kehrt dann zurück; finishExport()
+// zeichnet das fertig gelayoutete Dokument direkt auf den Drucker, sobald der
+// Worker fertig ist, und schließt das Dokument. Keine QPicture-Aufzeichnung:
+// beim Abspielen skaliert sie die Schriften um.
+
+/**
+ * @brief Fertig gelayoutete Textanalyse für den GUI-Thread
+ *
+ * Das Layout rechnet gegen ein QImage mit der Drucker-Auflösung statt gegen
+ * den QPrinter selbst, damit der Worker den Drucker nicht anfasst.
+ * Seitenumbrüche sind dadurch identisch zum Layout direkt auf dem Drucker.
+ */
+struct PreparedText {
+  QImage metricsDevice;
+  std::unique_ptr<QTextDocument> doc;
+};
+
+using PreparedTextPtr = std::shared_ptr<PreparedText>;
+
+/**
+ * @brief Wo die Textseiten auf dem Drucker landen
+ */
+struct TextFortsetzung {
+  int x = 0;
+  int yErste = 0;  // Erste Textseite (ggf. unter dem Titel)
+  int yFolge = 0;  // Folgeseiten
+  int fussY = 0;   // Grundlinie des Footers
+  int seite = 1;   // Seitennummer der ersten Textseite
+  QFont fussFont;
+};
+
+/**
+ * @brief Layoutet das Analyse-HTML (Worker-Thread)
+ * @param html Analyse-HTML inkl. Druck-Styles
+ * @param dpiX, dpiY Auflösung des Ziel-Druckers
+ * @param pageSize Seitengröße für die Paginierung
+ */
+static PreparedTextPtr layoutAnalysis(const QString &html, int dpiX, int dpiY,
+                                      const QSizeF &pageSize) {
+  auto prepared = std::make_shared<PreparedText>();
+  prepared->metricsDevice = QImage(1, 1, QImage::Format_Mono);
+  prepared->metricsDevice.setDotsPerMeterX(qRound(dpiX / 0.0254));
+  prepared->metricsDevice.setDotsPerMeterY(qRound(dpiY / 0.0254));
+
+  prepared->doc = std::make_unique<QTextDocument>();
+  QTextDocument &doc = *prepared->doc;
+  doc.documentLayout()->setPaintDevice(&prepared->metricsDevice);
+  doc.setDefaultFont(QFont("DejaVu Sans", 9));
+  doc.setHtml(html);
+  doc.setTextWidth(pageSize.width());
+  doc.setPageSize(pageSize);
+
+  // Layout hier erzwingen, nicht erst beim ersten draw() im GUI-Thread
+  doc.pageCount();
+
+  doc.moveToThread(QCoreApplication::instance()->thread());
+  return prepared;
+}
+
+/**
+ * @brief Zeichnet die Textseiten (GUI-Thread, erste Seite ist schon offen)
+ */
+static void drawTextPages(QPainter &painter, QPrinter &printer,
+                          const PreparedText &text, const TextFortsetzung &f) {
+  const QTextDocument &doc = *text.doc;
+  const QString datum = QDate::currentDate().toString("dd.MM.yyyy");
+  const QSizeF pageSize = doc.pageSize();
+  const int totalPages = qMax(1, doc.pageCount());
+  int seite = f.seite;
+  for (int i = 0; i < totalPages; ++i) {
+    if (i > 0) {
+      printer.newPage();
+      seite++;
+    }
+
+    painter.save();
+    painter.translate(f.x, i == 0 ? f.yErste : f.yFolge);
+    painter.setClipRect(QRectF(QPointF(0, 0), pageSize));
+    painter.translate(0, -i * pageSize.height()); // Seite nach oben scrollen
+
+    QAbstractTextDocumentLayout::PaintContext ctx;
+    ctx.clip = QRectF(QPointF(0, i * pageSize.height()), pageSize);
+    doc.documentLayout()->draw(&painter, ctx);
+    painter.restore();
+
+    painter.setFont(f.fussFont);
+    painter.setPen(Qt::gray);
+    painter.drawText(f.x, f.fussY,
+                     QString("Erstellt mit AstroUniverse 2026 am %1 - Seite %2")
+                         .arg(datum)
+                         .arg(seite));
+  }
+}
+
+/**
+ * @brief Ein laufender Export: Drucker, Painter und die ausstehenden Textseiten
+ */
+struct PdfExporter::ExportJob {
+  QPrinter printer{QPrinter::HighResolution};
+  QPainter painter;
+  QFuture<PreparedTextPtr> text;
+  TextFortsetzung fortsetzung;
+  QString ziel;                 // Dateiname bzw. Druckername für die Meldung
+  QPointer<PdfExporter> exporter;
+  bool abgeschlossen = false;
+};
+
+void PdfExporter::completeExport(ExportJob &job) {
+  if (job.abgeschlossen) {
+    return;
+  }
+  job.abgeschlossen = true;
+  drawTextPages(job.painter, job.printer, *job.text.result(), job.fortsetzung);
+  const bool ok = job.painter.end();
+  if (job.exporter) {
+    emit job.exporter->exportFinished(job.ziel, ok);
+  }
+}
+
+void PdfExporter::finishExport(std::shared_ptr<ExportJob> job) {
+  job->exporter = this;
+  job->ziel = job->printer.outputFileName().isEmpty()
+                  ? job->printer.printerName()
+                  : job->printer.outputFileName();
+
+  // Der Watcher hält den Job bis zum Ende; der PdfExporter selbst darf
+  // vorher verschwinden
+  auto *watcher =
+      new QFutureWatcher<PreparedTextPtr>(QCoreApplication::instance());
+  connect(watcher, &QFutureWatcherBase::finished, watcher, [watcher, job]() {
+    completeExport(*job);
+    watcher->deleteLater();
+  });
+  // Beendet sich die Anwendung vorher, auf den Worker warten und das
+  // Dokument noch schließen - sonst bliebe die PDF-Datei abgeschnitten
+  connect(QCoreApplication::instance(), &QCoreApplication::aboutToQuit, watcher,
+          [job]() {
+            job->text.waitForFinished();
+            completeExport(*job);
+          });
+  watcher->setFuture(job->text);
+}
+
 PdfExporter::PdfExporter(QObject *parent) : QObject(parent) {}
 
 bool PdfExporter::exportRadix(const Radix &radix, const AuInit &auinit,
@@ -60,26 +226,27 @@ bool PdfExporter::exportRadix(const Radix &radix, const AuInit &auinit,
   }
 
   // PDF erstellen
-  QPrinter printer(QPrinter::HighResolution);
+  auto job = std::make_shared<ExportJob>();
+  QPrinter &printer = job->printer;
   printer.setOutputFormat(QPrinter::PdfFormat);
   printer.setOutputFileName(fileName);
   printer.setPageSize(QPageSize::A4);
   printer.setPageMargins(QMarginsF(15, 15, 15, 15), QPageLayout::Millimeter);
 
-  QPainter painter;
-  if (!painter.begin(&printer)) {
+  if (!job->painter.begin(&printer)) {
     return false;
   }
 
-  renderPage(painter, printer, radix, auinit, chartWidget);
+  renderPage(*job, radix, auinit, chartWidget);
 
-  painter.end();
+  finishExport(std::move(job));
   return true;
 }
 
 bool PdfExporter::printRadix(const Radix &radix, const AuInit &auinit,
                              ChartWidget *chartWidget, QWidget *parent) {
-  QPrinter printer(QPrinter::HighResolution);
+  auto job = std::make_shared<ExportJob>();
+  QPrinter &printer = job->printer;
   printer.setPageSize(QPageSize::A4);
   printer.setPageMargins(QMarginsF(15, 15, 15, 15), QPageLayout::Millimeter);
 
@@ -90,14 +257,13 @@ bool PdfExporter::printRadix(const Radix &radix, const AuInit &auinit,
     return false;
   }
 
-  QPainter painter;
-  if (!painter.begin(&printer)) {
+  if (!job->painter.begin(&printer)) {
     return false;
   }
 
-  renderPage(painter, printer, radix, auinit, chartWidget);
+  renderPage(*job, radix, auinit, chartWidget);
 
-  painter.end();
+  finishExport(std::move(job));
   return true;
 }
 
@@ -114,27 +280,28 @@ bool PdfExporter::exportSynastrie(const Radix &radix1, const Radix &radix2,
     return false;
   }
 
-  QPrinter printer(QPrinter::HighResolution);
+  auto job = std::make_shared<ExportJob>();
+  QPrinter &printer = job->printer;
   printer.setOutputFormat(QPrinter::PdfFormat);
   printer.setOutputFileName(fileName);
   printer.setPageSize(QPageSize::A4);
   printer.setPageMargins(QMarginsF(10, 10, 10, 10), QPageLayout::Millimeter);
 
-  QPainter painter;
-  if (!painter.begin(&printer)) {
+  if (!job->painter.begin(&printer)) {
     return false;
   }
 
-  renderSynastriePage(painter, printer, radix1, radix2, auinit, chartWidget);
+  renderSynastriePage(*job, radix1, radix2, auinit, chartWidget);
 
-  painter.end();
+  finishExport(std::move(job));
   return true;
 }
 
 bool PdfExporter::printSynastrie(const Radix &radix1, const Radix &radix2,
                                  const AuInit &auinit, ChartWidget *chartWidget,
                                  QWidget *parent) {
-  QPrinter printer(QPrinter::HighResolution);
+  auto job = std::make_shared<ExportJob>();
+  QPrinter &printer = job->printer;
   printer.setPageSize(QPageSize::A4);
   printer.setPageMargins(QMarginsF(10, 10, 10, 10), QPageLayout::Millimeter);
 
@@ -145,14 +312,13 @@ bool PdfExporter::printSynastrie(const Radix &radix1, const Radix &radix2,
     return false;
   }
 
-  QPainter painter;
-  if (!painter.begin(&printer)) {
+  if (!job->painter.begin(&printer)) {
     return false;
   }
 
-  renderSynastriePage(painter, printer, radix1, radix2, auinit, chartWidget);
+  renderSynastriePage(*job, radix1, radix2, auinit, chartWidget);
 
-  painter.end();
+  finishExport(std::move(job));
   return true;
 }
 
@@ -168,27 +334,28 @@ bool PdfExporter::exportTransit(const Radix &radix, const Radix &transit,
     return false;
   }
 
-  QPrinter printer(QPrinter::HighResolution);
+  auto job = std::make_shared<ExportJob>();
+  QPrinter &printer = job->printer;
   printer.setOutputFormat(QPrinter::PdfFormat);
   printer.setOutputFileName(fileName);
   printer.setPageSize(QPageSize::A4);
   printer.setPageMargins(QMarginsF(10, 10, 10, 10), QPageLayout::Millimeter);
 
-  QPainter painter;
-  if (!painter.begin(&printer)) {
+  if (!job->painter.begin(&printer)) {
     return false;
   }
 
-  renderTransitPage(painter, printer, radix, transit, auinit, chartWidget);
+  renderTransitPage(*job, radix, transit, auinit, chartWidget);
 
-  painter.end();
+  finishExport(std::move(job));
   return true;
 }
 
 bool PdfExporter::printTransit(const Radix &radix, const Radix &transit,
                                const AuInit &auinit, ChartWidget *chartWidget,
                                QWidget *parent) {
-  QPrinter printer(QPrinter::HighResolution);
+  auto job = std::make_shared<ExportJob>();
+  QPrinter &printer = job->printer;
   printer.setPageSize(QPageSize::A4);
   printer.setPageMargins(QMarginsF(10, 10, 10, 10), QPageLayout::Millimeter);
 
@@ -199,20 +366,21 @@ bool PdfExporter::printTransit(const Radix &radix, const Radix &transit,
     return false;
   }
 
-  QPainter painter;
-  if (!painter.begin(&printer)) {
+  if (!job->painter.begin(&printer)) {
     return false;
   }
 
-  renderTransitPage(painter, printer, radix, transit, auinit, chartWidget);
+  renderTransitPage(*job, radix, transit, auinit, chartWidget);
 
-  painter.end();
+  finishExport(std::move(job));
   return true;
 }
 
-void PdfExporter::renderPage(QPainter &painter, QPrinter &printer,
-                             const Radix &radix, const AuInit &auinit,
-                             ChartWidget *chartWidget) {
+void PdfExporter::renderPage(ExportJob &job, const Radix &radix,
+                             const AuInit &auinit, ChartWidget *chartWidget) {
+  ASTRO_TIMER("PdfExporter::renderPage");
+  QPainter &painter = job.painter;
+  QPrinter &printer = job.printer;
   QRect pageRect = printer.pageRect(QPrinter::DevicePixel).toRect();
   int pageWidth = pageRect.width();
   int pageHeight = pageRect.height();
@@ -241,6 +409,23 @@ void PdfExporter::renderPage(QPainter &painter, QPrinter &printer,
   int marginY = static_cast<int>(10 * mmToPixelY);
   int y = marginY;
 
+  // Textanalyse parallel vorbereiten (Seitenhöhe ab Titelzeile)
+  const int textTitleHeight = QFontMetrics(titleFont, &printer).height() +
+                              static_cast<int>(5 * mmToPixelY);
+  const QSizeF textPageSize(pageWidth - 2 * marginX,
+                            pageHeight - marginY - textTitleHeight - marginY);
+  const int textDpiX = printer.logicalDpiX();
+  const int textDpiY = printer.logicalDpiY();
+  // Der Export endet erst nach dieser Funktion - Daten kopieren
+  job.text = QtConcurrent::run([=]() {
+    AstroTextAnalyzer analyzer;
+    analyzer.setOrben(&auinit);
+    QString html;
+    HtmlReportSink sink(html, HtmlReportSink::druckStil());
+    analyzer.buildReport(radix, sink);
+    return layoutAnalysis(html, textDpiX, textDpiY, textPageSize);
+  });
+
   // Helper: Farbe anpassen (weiß -> schwarz)
   auto adjustColor = [](QColor c) -> QColor {
     if (c.lightness() > 200)
@@ -351,13 +536,13 @@ void PdfExporter::renderPage(QPainter &painter, QPrinter &printer,
     painter.setFont(symbolFont);
     QString symbol = astroFont().planetSymbol(i);
     painter.setPen(adjustColor(getPlanetColor(i, auinit)));
-    painter.drawText(col1X, posY + painter.fontMetrics().ascent(), symbol);
+    drawSymbol(painter, col1X, posY + painter.fontMetrics().ascent(), symbol);
 
     // Rückläufig?
     if (i < radix.planetTyp.size() && (radix.planetTyp[i] & P_TYP_RUCK)) {
-      painter.drawText(col1X + static_cast<int>(4 * mmToPixelX),
-                       posY + painter.fontMetrics().ascent(),
-                       astroFont().retrogradeSymbol());
+      drawSymbol(painter, col1X + static_cast<int>(4 * mmToPixelX),
+                 posY + painter.fontMetrics().ascent(),
+                 astroFont().retrogradeSymbol());
     }
 
     // Position (Grad/Minuten)
@@ -371,14 +556,14 @@ void PdfExporter::renderPage(QPainter &painter, QPrinter &printer,
     painter.setFont(zodiacFont);
     int zeichen = getZeichen(radix.planet[i]);
     painter.setPen(adjustColor(getZeichenColor(zeichen)));
-    painter.drawText(col1X + static_cast<int>(20 * mmToPixelX),
-                     posY + painter.fontMetrics().ascent(),
-                     astroFont().sternzeichenSymbol(zeichen));
+    drawSymbol(painter, col1X + static_cast<int>(20 * mmToPixelX),
+               posY + painter.fontMetrics().ascent(),
+               astroFont().sternzeichenSymbol(zeichen));
 
     // Legende: Symbol = Name
     painter.setFont(symbolFont);
     painter.setPen(adjustColor(getPlanetColor(i, auinit)));
-    painter.drawText(col3X, posY + painter.fontMetrics().ascent(), symbol);
+    drawSymbol(painter, col3X, posY + painter.fontMetrics().ascent(), symbol);
     painter.setFont(smallFont);
     painter.setPen(Qt::black);
     painter.drawText(col3X + static_cast<int>(5 * mmToPixelX),
@@ -404,9 +589,9 @@ void PdfExporter::renderPage(QPainter &painter, QPrinter &printer,
     painter.setFont(zodiacFont);
     int zeichen = getZeichen(radix.haus[i]);
     painter.setPen(adjustColor(getZeichenColor(zeichen)));
-    painter.drawText(col2X + static_cast<int>(20 * mmToPixelX),
-                     hausY + painter.fontMetrics().ascent(),
-                     astroFont().sternzeichenSymbol(zeichen));
+    drawSymbol(painter, col2X + static_cast<int>(20 * mmToPixelX),
+               hausY + painter.fontMetrics().ascent(),
+               astroFont().sternzeichenSymbol(zeichen));
     hausY += lineHeight;
   }
 
@@ -422,8 +607,8 @@ void PdfExporter::renderPage(QPainter &painter, QPrinter &printer,
   for (int i = 0; i < 12; ++i) {
     painter.setFont(zodiacFont);
     painter.setPen(adjustColor(getZeichenColor(i)));
-    painter.drawText(col3X, posY + painter.fontMetrics().ascent(),
-                     astroFont().sternzeichenSymbol(i));
+    drawSymbol(painter, col3X, posY + painter.fontMetrics().ascent(),
+               astroFont().sternzeichenSymbol(i));
     painter.setFont(smallFont);
     painter.drawText(col3X + static_cast<int>(5 * mmToPixelX),
                      posY + painter.fontMetrics().ascent(), zeichenNames[i]);
@@ -440,8 +625,8 @@ void PdfExporter::renderPage(QPainter &painter, QPrinter &printer,
   for (const auto &asp : aspekte) {
     painter.setFont(symbolFont);
     painter.setPen(adjustColor(getAspektColor(asp.id)));
-    painter.drawText(col3X, posY + painter.fontMetrics().ascent(),
-                     astroFont().aspektSymbol(asp.id));
+    drawSymbol(painter, col3X, posY + painter.fontMetrics().ascent(),
+               astroFont().aspektSymbol(asp.id));
 
     painter.setFont(smallFont);
     painter.setPen(Qt::black);
@@ -521,30 +706,30 @@ void PdfExporter::renderPage(QPainter &painter, QPrinter &printer,
       // Planet1
       painter.setFont(symbolFont);
       painter.setPen(adjustColor(getPlanetColor(i, auinit)));
-      painter.drawText(aspX, aspY + painter.fontMetrics().ascent(), sym1);
+      drawSymbol(painter, aspX, aspY + painter.fontMetrics().ascent(), sym1);
 
       // Zeichen1
       painter.setFont(zodiacFont);
       painter.setPen(adjustColor(getZeichenColor(zeichen1)));
-      painter.drawText(aspX + static_cast<int>(6 * mmToPixelX),
-                       aspY + painter.fontMetrics().ascent(), sign1);
+      drawSymbol(painter, aspX + static_cast<int>(6 * mmToPixelX),
+                 aspY + painter.fontMetrics().ascent(), sign1);
 
       // Aspekt
       painter.setFont(symbolFont);
       painter.setPen(adjustColor(getAspektColor(asp)));
-      painter.drawText(aspX + static_cast<int>(12 * mmToPixelX),
-                       aspY + painter.fontMetrics().ascent(), aspSym);
+      drawSymbol(painter, aspX + static_cast<int>(12 * mmToPixelX),
+                 aspY + painter.fontMetrics().ascent(), aspSym);
 
       // Planet2
       painter.setPen(adjustColor(getPlanetColor(j, auinit)));
-      painter.drawText(aspX + static_cast<int>(18 * mmToPixelX),
-                       aspY + painter.fontMetrics().ascent(), sym2);
+      drawSymbol(painter, aspX + static_cast<int>(18 * mmToPixelX),
+                 aspY + painter.fontMetrics().ascent(), sym2);
 
       // Zeichen2
       painter.setFont(zodiacFont);
       painter.setPen(adjustColor(getZeichenColor(zeichen2)));
-      painter.drawText(aspX + static_cast<int>(24 * mmToPixelX),
-                       aspY + painter.fontMetrics().ascent(), sign2);
+      drawSymbol(painter, aspX + static_cast<int>(24 * mmToPixelX),
+                 aspY + painter.fontMetrics().ascent(), sign2);
 
       // Orb
       painter.setFont(smallFont);
@@ -591,27 +776,6 @@ void PdfExporter::renderPage(QPainter &painter, QPrinter &printer,
   pageNum++;
   y = marginY;
 
-  AstroTextAnalyzer analyzer;
-  analyzer.setOrben(&auinit);
-  QString html = analyzer.analyzeRadix(radix);
-
-  // Font-Namen vom AstroFontProvider holen
-  QString signFont = astroFont().fontName();  // AstroUniverse für Sternzeichen
-  QString planetFont = astroFont().getPlanetSymbolFont().family();  // DejaVu Sans für Planeten/Asteroiden
-  
-  html.replace(
-      "</head>",
-      QString("<style>"
-      "body { font-family: 'DejaVu Sans'; font-size: 9pt; } "
-      "h1 { font-size: 14pt; font-weight: bold; } "
-      "h2 { font-size: 10pt; font-weight: bold; } "
-      "h3 { font-size: 9pt; font-weight: bold; } "
-      "p { font-size: 9pt; } "
-      ".planet-symbol { font-family: '%1'; } "
-      ".sign-symbol { font-family: '%2'; } "
-      ".aspect-symbol { font-family: '%1'; }"
-      "</style></head>").arg(planetFont).arg(signFont));
-
   // Titel für Textanalyse
   painter.setFont(titleFont);
   painter.setPen(Qt::black);
@@ -620,65 +784,9 @@ void PdfExporter::renderPage(QPainter &painter, QPrinter &printer,
                        .arg(radix.rFix.vorname, radix.rFix.name));
   y += painter.fontMetrics().height() + static_cast<int>(5 * mmToPixelY);
 
-  // HTML rendern
-  QTextDocument doc;
-  doc.documentLayout()->setPaintDevice(&printer);
-  doc.setDefaultFont(normalFont);
-  // CSS: gleiche Schriftgrößen wie in den Tabellen (Positionen/Häuser)
-  doc.setDefaultStyleSheet(
-      "body { font-family: 'DejaVu Sans'; font-size: 9pt; } "
-      "h1 { font-size: 14pt; font-weight: bold; } "
-      "h2 { font-size: 10pt; font-weight: bold; } "
-      "h3 { font-size: 9pt; font-weight: bold; } "
-      "p { margin-bottom: 10px; }");
-  doc.setHtml(html);
-  doc.setTextWidth(pageWidth - 2 * marginX);
-
-  const double docPageWidth = static_cast<double>(pageWidth - 2 * marginX);
-  const double docPageHeight =
-      static_cast<double>(pageHeight - y - marginY); // Platz ab aktuellem y
-  doc.setPageSize(QSizeF(docPageWidth, docPageHeight));
-
-  // Wir müssen manuell Positionierung und Umbruch handhaben, wenn es über
-  // mehrere Seiten geht. Einfacher Ansatz: Wir rendern alles in ein Rechteck.
-  // Wenn es zu lang ist, müssten wir eigentlich pagen. QTextDocument
-  // unterstützt das nicht direkt trivial auf QPainter ohne Clip. Aber wir
-  // können den Inhalt "clippen" und auf neuen Seiten weitermalen.
-
-  // Loop für Mehrseitigkeit (seitenweise anhand der QTextDocument-Paginierung)
-  const double sliceHeight = doc.pageSize().height();
-  const int totalPages = qMax(1, doc.pageCount());
-
-  for (int pageIndex = 0; pageIndex < totalPages; ++pageIndex) {
-    if (pageIndex > 0) {
-      printer.newPage();
-      pageNum++;
-      y = marginY; // Auf Folgeseiten oben anfangen
-    }
-
-    painter.save();
-    painter.translate(marginX, y); // Startposition auf der Seite
-
-    QRectF clipRect(0, 0, docPageWidth, sliceHeight);
-    painter.setClipRect(clipRect);
-    painter.translate(0, -pageIndex * sliceHeight); // Seite nach oben scrollen
-
-    QAbstractTextDocumentLayout::PaintContext ctx;
-    ctx.clip = QRectF(0, pageIndex * sliceHeight, clipRect.width(),
-                      clipRect.height());
-    doc.documentLayout()->draw(&painter, ctx);
-
-    painter.restore();
-
-    // Footer malen
-    painter.setFont(smallFont);
-    painter.setPen(Qt::gray);
-    painter.drawText(
-        marginX, pageHeight - marginY,
-        QString("Erstellt mit AstroUniverse 2026 am %1 - Seite %2")
-            .arg(QDate::currentDate().toString("dd.MM.yyyy"))
-            .arg(pageNum));
-  }
+  // Die Textseiten zeichnet finishExport(), sobald der Worker fertig ist
+  job.fortsetzung = {marginX, y, marginY, pageHeight - marginY, pageNum,
+                     smallFont};
 
 }
 
@@ -764,8 +872,11 @@ void PdfExporter::renderPage(QPainter &painter, QPrinter &printer,
   }
 
   void PdfExporter::renderSynastriePage(
-      QPainter & painter, QPrinter & printer, const Radix &radix1,
-      const Radix &radix2, const AuInit &auinit, ChartWidget *chartWidget) {
+      ExportJob & job, const Radix &radix1, const Radix &radix2,
+      const AuInit &auinit, ChartWidget *chartWidget) {
+    ASTRO_TIMER("PdfExporter::renderSynastriePage");
+    QPainter &painter = job.painter;
+    QPrinter &printer = job.printer;
     QRect pageRect = printer.pageRect(QPrinter::DevicePixel).toRect();
     int pageWidth = pageRect.width();
     int pageHeight = pageRect.height();
@@ -822,6 +933,27 @@ void PdfExporter::renderPage(QPainter &painter, QPrinter &printer,
     int marginX = static_cast<int>(10 * mmToPixelX);
     int marginY = static_cast<int>(10 * mmToPixelY);
 
+    // Textanalyse parallel vorbereiten
+    const QSizeF textPageSize(pageWidth - 2 * marginX, pageHeight - 2 * marginY);
+    const int textDpiX = printer.logicalDpiX();
+    const int textDpiY = printer.logicalDpiY();
+    job.text = QtConcurrent::run([=]() {
+      // Temporäres Radix mit synastrie-Pointer für die Analyse erstellen
+      // Synastrie-Analyse erwartet radix.synastrie als Partner-Radix
+      Radix tempRadix = radix1;
+      tempRadix.synastrie = std::make_shared<Radix>(radix2);
+      tempRadix.horoTyp = TYP_SYNASTRIE;
+
+      AstroTextAnalyzer analyzer;
+      analyzer.setOrben(&auinit);
+
+      // Druck-Styles wie bei Radix-Textanalyse
+      QString html;
+      HtmlReportSink sink(html, HtmlReportSink::druckStil());
+      analyzer.buildReport(tempRadix, sink);
+      return layoutAnalysis(html, textDpiX, textDpiY, textPageSize);
+    });
+
     // Header
     painter.setFont(titleFont);
     painter.setPen(Qt::black);
@@ -924,13 +1056,13 @@ void PdfExporter::renderPage(QPainter &painter, QPrinter &printer,
       painter.setFont(symbolFont);
       QString symbol = astroFont().planetSymbol(i);
       painter.setPen(adjustColor(getPlanetColor(i, auinit)));
-      painter.drawText(col1X, posY + painter.fontMetrics().ascent(), symbol);
+      drawSymbol(painter, col1X, posY + painter.fontMetrics().ascent(), symbol);
 
       // Rückläufig?
       if (i < radix1.planetTyp.size() && (radix1.planetTyp[i] & P_TYP_RUCK)) {
-        painter.drawText(col1X + static_cast<int>(4 * mmToPixelX),
-                         posY + painter.fontMetrics().ascent(),
-                         astroFont().retrogradeSymbol());
+        drawSymbol(painter, col1X + static_cast<int>(4 * mmToPixelX),
+                   posY + painter.fontMetrics().ascent(),
+                   astroFont().retrogradeSymbol());
       }
 
       // Position (ohne Sternzeichen)
@@ -944,14 +1076,14 @@ void PdfExporter::renderPage(QPainter &painter, QPrinter &printer,
       painter.setFont(zodiacFont);
       int zeichen = getZeichen(radix1.planet[i]);
       painter.setPen(adjustColor(getZeichenColor(zeichen)));
-      painter.drawText(col1X + static_cast<int>(20 * mmToPixel),
-                       posY + painter.fontMetrics().ascent(),
-                       astroFont().sternzeichenSymbol(zeichen));
+      drawSymbol(painter, col1X + static_cast<int>(20 * mmToPixel),
+                 posY + painter.fontMetrics().ascent(),
+                 astroFont().sternzeichenSymbol(zeichen));
 
       // Legende: Symbol = Name
       painter.setFont(symbolFont);
       painter.setPen(adjustColor(getPlanetColor(i, auinit)));
-      painter.drawText(col3X, posY + painter.fontMetrics().ascent(), symbol);
+      drawSymbol(painter, col3X, posY + painter.fontMetrics().ascent(), symbol);
       painter.setFont(smallFont);
       painter.setPen(Qt::black);
       painter.drawText(col3X + static_cast<int>(5 * mmToPixelX),
@@ -975,9 +1107,9 @@ void PdfExporter::renderPage(QPainter &painter, QPrinter &printer,
       painter.setFont(zodiacFont);
       int zeichen = getZeichen(radix1.haus[i]);
       painter.setPen(adjustColor(getZeichenColor(zeichen)));
-      painter.drawText(col2X + static_cast<int>(20 * mmToPixel),
-                       hausY + painter.fontMetrics().ascent(),
-                       astroFont().sternzeichenSymbol(zeichen));
+      drawSymbol(painter, col2X + static_cast<int>(20 * mmToPixel),
+                 hausY + painter.fontMetrics().ascent(),
+                 astroFont().sternzeichenSymbol(zeichen));
       hausY += lineHeight;
     }
 
@@ -991,8 +1123,8 @@ void PdfExporter::renderPage(QPainter &painter, QPrinter &printer,
     for (int i = 0; i < 12; ++i) {
       painter.setFont(zodiacFont);
       painter.setPen(adjustColor(getZeichenColor(i)));
-      painter.drawText(col3X, posY + painter.fontMetrics().ascent(),
-                       astroFont().sternzeichenSymbol(i));
+      drawSymbol(painter, col3X, posY + painter.fontMetrics().ascent(),
+                 astroFont().sternzeichenSymbol(i));
       painter.setFont(smallFont);
       painter.drawText(col3X + static_cast<int>(5 * mmToPixel),
                        posY + painter.fontMetrics().ascent(), zeichenNames[i]);
@@ -1009,8 +1141,8 @@ void PdfExporter::renderPage(QPainter &painter, QPrinter &printer,
     for (const auto &asp : aspekte) {
       painter.setFont(symbolFont);
       painter.setPen(adjustColor(getAspektColor(asp.id)));
-      painter.drawText(col3X, posY + painter.fontMetrics().ascent(),
-                       astroFont().aspektSymbol(asp.id));
+      drawSymbol(painter, col3X, posY + painter.fontMetrics().ascent(),
+                 astroFont().aspektSymbol(asp.id));
 
       painter.setFont(smallFont);
       painter.setPen(Qt::black);
@@ -1055,13 +1187,13 @@ void PdfExporter::renderPage(QPainter &painter, QPrinter &printer,
       painter.setFont(symbolFont);
       QString symbol = astroFont().planetSymbol(i);
       painter.setPen(adjustColor(getPlanetColor(i, auinit)));
-      painter.drawText(marginX, y + painter.fontMetrics().ascent(), symbol);
+      drawSymbol(painter, marginX, y + painter.fontMetrics().ascent(), symbol);
 
       // Rückläufig?
       if (i < radix2.planetTyp.size() && (radix2.planetTyp[i] & P_TYP_RUCK)) {
-        painter.drawText(marginX + static_cast<int>(4 * mmToPixelX),
-                         y + painter.fontMetrics().ascent(),
-                         astroFont().retrogradeSymbol());
+        drawSymbol(painter, marginX + static_cast<int>(4 * mmToPixelX),
+                   y + painter.fontMetrics().ascent(),
+                   astroFont().retrogradeSymbol());
       }
 
       // Position (ohne Sternzeichen)
@@ -1073,9 +1205,9 @@ void PdfExporter::renderPage(QPainter &painter, QPrinter &printer,
       painter.setFont(zodiacFont);
       int zeichen = getZeichen(radix2.planet[i]);
       painter.setPen(adjustColor(getZeichenColor(zeichen)));
-      painter.drawText(margin + static_cast<int>(20 * mmToPixel),
-                       y + painter.fontMetrics().ascent(),
-                       astroFont().sternzeichenSymbol(zeichen));
+      drawSymbol(painter, margin + static_cast<int>(20 * mmToPixel),
+                 y + painter.fontMetrics().ascent(),
+                 astroFont().sternzeichenSymbol(zeichen));
       y += lineHeight;
     }
 
@@ -1095,118 +1227,92 @@ void PdfExporter::renderPage(QPainter &painter, QPrinter &printer,
     int aspX = marginX;
     int aspY = y;
 
-    for (int i = 0; i < numPlanets1 && i < radix1.planet.size(); ++i) {
-      for (int j = 0; j < numPlanets2 && j < radix2.planet.size(); ++j) {
-        double pos1 = radix1.planet[i];
-        double pos2 = radix2.planet[j];
-        double diff = std::abs(pos1 - pos2);
-        if (diff > 180)
-          diff = 360 - diff;
-
-        int asp = -1;
-        double orb = 0;
-        if (diff < 8) {
-          asp = KONJUNKTION;
-          orb = diff;
-        } else if (std::abs(diff - 30) < 3) {
-          asp = HALBSEX;
-          orb = std::abs(diff - 30);
-        } else if (std::abs(diff - 60) < 6) {
-          asp = SEXTIL;
-          orb = std::abs(diff - 60);
-        } else if (std::abs(diff - 90) < 8) {
-          asp = QUADRATUR;
-          orb = std::abs(diff - 90);
-        } else if (std::abs(diff - 120) < 8) {
-          asp = TRIGON;
-          orb = std::abs(diff - 120);
-        } else if (std::abs(diff - 150) < 3) {
-          asp = QUINCUNX;
-          orb = std::abs(diff - 150);
-        } else if (std::abs(diff - 180) < 8) {
-          asp = OPOSITION;
-          orb = std::abs(diff - 180);
-        }
+    // Kreuz-Aspekte mit den Synastrie-Orben aus den Einstellungen
+    const auto kreuz =
+        SynastrieCalc::ergebnis(radix1, radix2, auinit, TYP_SYNASTRIE);
+    for (const SynastrieAspekt &s : kreuz->aspekte) {
+      const int i = s.planetA;
+      const int j = s.planetB;
+      const int asp = s.aspekt;
+      const double orb = s.orb;
+      double pos1 = radix1.planet[i];
+      double pos2 = radix2.planet[j];
 
-        if (asp < 0)
-          continue;
-
-        // Sternzeichen der Planeten
-        int zeichen1 = getZeichen(pos1);
-        int zeichen2 = getZeichen(pos2);
+      // Sternzeichen der Planeten
+      int zeichen1 = getZeichen(pos1);
+      int zeichen2 = getZeichen(pos2);
 
-        // Symbole: Planet1 Zeichen1 Aspekt Planet2 Zeichen2 (Orb)
-        QString sym1 = astroFont().planetSymbol(i);
-        QString aspSym = astroFont().aspektSymbol(asp);
-        QString sym2 = astroFont().planetSymbol(j);
-        QString sign1 = astroFont().sternzeichenSymbol(zeichen1);
-        QString sign2 = astroFont().sternzeichenSymbol(zeichen2);
+      // Symbole: Planet1 Zeichen1 Aspekt Planet2 Zeichen2 (Orb)
+      QString sym1 = astroFont().planetSymbol(i);
+      QString aspSym = astroFont().aspektSymbol(asp);
+      QString sym2 = astroFont().planetSymbol(j);
+      QString sign1 = astroFont().sternzeichenSymbol(zeichen1);
+      QString sign2 = astroFont().sternzeichenSymbol(zeichen2);
 
-        // Planet1
-        painter.setFont(symbolFont);
-        painter.setPen(adjustColor(getPlanetColor(i, auinit)));
-        painter.drawText(aspX, aspY + painter.fontMetrics().ascent(), sym1);
+      // Planet1
+      painter.setFont(symbolFont);
+      painter.setPen(adjustColor(getPlanetColor(i, auinit)));
+      drawSymbol(painter, aspX, aspY + painter.fontMetrics().ascent(), sym1);
 
-        // Zeichen1
-        painter.setFont(zodiacFont);
-        painter.setPen(adjustColor(getZeichenColor(zeichen1)));
-        painter.drawText(aspX + static_cast<int>(6 * mmToPixelX),
-                         aspY + painter.fontMetrics().ascent(), sign1);
+      // Zeichen1
+      painter.setFont(zodiacFont);
+      painter.setPen(adjustColor(getZeichenColor(zeichen1)));
+      drawSymbol(painter, aspX + static_cast<int>(6 * mmToPixelX),
+                 aspY + painter.fontMetrics().ascent(), sign1);
 
-        // Aspekt
-        painter.setFont(symbolFont);
-        painter.setPen(adjustColor(getAspektColor(asp)));
-        painter.drawText(aspX + static_cast<int>(12 * mmToPixelX),
-                         aspY + painter.fontMetrics().ascent(), aspSym);
+      // Aspekt
+      painter.setFont(symbolFont);
+      painter.setPen(adjustColor(getAspektColor(asp)));
+      drawSymbol(painter, aspX + static_cast<int>(12 * mmToPixelX),
+                 aspY + painter.fontMetrics().ascent(), aspSym);
 
-        // Planet2
-        painter.setPen(adjustColor(getPlanetColor(j, auinit)));
-        painter.drawText(aspX + static_cast<int>(18 * mmToPixelX),
-                         aspY + painter.fontMetrics().ascent(), sym2);
+      // Planet2
+      painter.setPen(adjustColor(getPlanetColor(j, auinit)));
+      drawSymbol(painter, aspX + static_cast<int>(18 * mmToPixelX),
+                 aspY + painter.fontMetrics().ascent(), sym2);
 
-        // Zeichen2
-        painter.setFont(zodiacFont);
-        painter.setPen(adjustColor(getZeichenColor(zeichen2)));
-        painter.drawText(aspX + static_cast<int>(24 * mmToPixelX),
-                         aspY + painter.fontMetrics().ascent(), sign2);
+      // Zeichen2
+      painter.setFont(zodiacFont);
+      painter.setPen(adjustColor(getZeichenColor(zeichen2)));
+      drawSymbol(painter, aspX + static_cast<int>(24 * mmToPixelX),
+                 aspY + painter.fontMetrics().ascent(), sign2);
 
-        // Orb
-        painter.setFont(smallFont);
-        painter.setPen(Qt::black);
-        painter.drawText(aspX + static_cast<int>(30 * mmToPixelX),
-                         aspY + painter.fontMetrics().ascent(),
-                         QString("%1°").arg(orb, 0, 'f', 1));
+      // Orb
+      painter.setFont(smallFont);
+      painter.setPen(Qt::black);
+      painter.drawText(aspX + static_cast<int>(30 * mmToPixelX),
+                       aspY + painter.fontMetrics().ascent(),
+                       QString("%1°").arg(orb, 0, 'f', 1));
 
-        aspY += lineHeight;
+      aspY += lineHeight;
 
-        // Neue Spalte wenn zu weit unten (Synastrie)
-        if (aspY > pageHeight - marginY - lineHeight * 2) {
-          aspCol++;
-          if (aspCol >= 3) { // 3 Spalten wegen mehr Platz für Zeichen
-            // Neue Seite
-            painter.setFont(smallFont);
-            painter.setPen(Qt::gray);
-            painter.drawText(
-                marginX, pageHeight - marginY,
-                QString("Erstellt mit AstroUniverse 2026 - Seite %1")
-                    .arg(pageNum));
+      // Neue Spalte wenn zu weit unten (Synastrie)
+      if (aspY > pageHeight - marginY - lineHeight * 2) {
+        aspCol++;
+        if (aspCol >= 3) { // 3 Spalten wegen mehr Platz für Zeichen
+          // Neue Seite
+          painter.setFont(smallFont);
+          painter.setPen(Qt::gray);
+          painter.drawText(
+              marginX, pageHeight - marginY,
+              QString("Erstellt mit AstroUniverse 2026 - Seite %1")
+                  .arg(pageNum));
 
-            printer.newPage();
-            pageNum++;
-            aspCol = 0;
-            y = marginY;
+          printer.newPage();
+          pageNum++;
+          aspCol = 0;
+          y = marginY;
 
-            painter.setFont(titleFont);
-            painter.setPen(Qt::black);
-            painter.drawText(marginX, y + painter.fontMetrics().ascent(),
-                             QString("Synastrie-Aspekte (Fortsetzung)"));
-            y += painter.fontMetrics().height() +
-                 static_cast<int>(5 * mmToPixelY);
-            aspStartY = y;
-          }
-          aspX = marginX + aspCol * aspColWidth;
-          aspY = aspStartY;
+          painter.setFont(titleFont);
+          painter.setPen(Qt::black);
+          painter.drawText(marginX, y + painter.fontMetrics().ascent(),
+                           QString("Synastrie-Aspekte (Fortsetzung)"));
+          y += painter.fontMetrics().height() +
+               static_cast<int>(5 * mmToPixelY);
+          aspStartY = y;
         }
+        aspX = marginX + aspCol * aspColWidth;
+        aspY = aspStartY;
       }
     }
 
@@ -1223,75 +1329,17 @@ void PdfExporter::renderPage(QPainter &painter, QPrinter &printer,
     pageNum++;
     y = marginY;
 
-    // Temporäres Radix mit synastrie-Pointer für die Analyse erstellen
-    // analyzeSynastry erwartet radix.synastrie als Partner-Radix
-    Radix tempRadix = radix1;
-    tempRadix.synastrie = std::make_shared<Radix>(radix2);
-    tempRadix.horoTyp = TYP_SYNASTRIE;
-
-    AstroTextAnalyzer analyzer;
-    analyzer.setOrben(&auinit);
-    QString html = analyzer.analyzeSynastry(tempRadix);
-
-    // CSS-Styles wie bei Radix-Textanalyse
-    html.replace(
-        "</head>",
-        "<style>"
-        "body { font-family: 'DejaVu Sans'; font-size: 9pt; } "
-        "h1 { font-size: 14pt; font-weight: bold; } "
-        "h2 { font-size: 10pt; font-weight: bold; } "
-        "h3 { font-size: 9pt; font-weight: bold; } "
-        "p { font-size: 9pt; }"
-        "</style></head>");
-
-    QTextDocument doc;
-    doc.documentLayout()->setPaintDevice(&printer);
-    doc.setDefaultFont(QFont("DejaVu Sans", 9));
-    doc.setDefaultStyleSheet(
-        "body { font-family: 'DejaVu Sans'; font-size: 9pt; } "
-        "h1 { font-size: 14pt; font-weight: bold; } "
-        "h2 { font-size: 10pt; font-weight: bold; } "
-        "h3 { font-size: 9pt; font-weight: bold; } "
-        "p { margin-bottom: 10px; }");
-    doc.setHtml(html);
-    doc.setTextWidth(pageWidth - 2 * marginX);
-    doc.setPageSize(QSizeF(pageWidth - 2 * marginX, pageHeight - 2 * marginY));
-
-    // Paging Logic
-    double currentY = 0;
-    double contentHeight = doc.size().height();
-
-    while (currentY < contentHeight) {
-      painter.save();
-      painter.translate(marginX, y);
-      QRectF clipRect(0, 0, pageWidth - 2 * marginX, pageHeight - y - marginY);
-      painter.setClipRect(clipRect);
-      painter.translate(0, -currentY);
-      QAbstractTextDocumentLayout::PaintContext ctx;
-      ctx.clip = QRectF(0, currentY, clipRect.width(), clipRect.height());
-      doc.documentLayout()->draw(&painter, ctx);
-      painter.restore();
-
-      painter.setFont(smallFont);
-      painter.setPen(Qt::gray);
-      painter.drawText(
-          marginX, pageHeight - marginY,
-          QString("Erstellt mit AstroUniverse 2026 am %1 - Seite %2")
-              .arg(QDate::currentDate().toString("dd.MM.yyyy"))
-              .arg(pageNum));
-
-      currentY += (pageHeight - y - marginY);
-      if (currentY < contentHeight) {
-        printer.newPage();
-        pageNum++;
-        y = marginY;
-      }
-    }
+    // Die Textseiten zeichnet finishExport(), sobald der Worker fertig ist
+    job.fortsetzung = {marginX, y, marginY, pageHeight - marginY, pageNum,
+                       smallFont};
   }
 
 void PdfExporter::renderTransitPage(
-      QPainter & painter, QPrinter & printer, const Radix &radix,
-      const Radix &transit, const AuInit &auinit, ChartWidget *chartWidget) {
+      ExportJob & job, const Radix &radix, const Radix &transit,
+      const AuInit &auinit, ChartWidget *chartWidget) {
+    ASTRO_TIMER("PdfExporter::renderTransitPage");
+    QPainter &painter = job.painter;
+    QPrinter &printer = job.printer;
     QRect pageRect = printer.pageRect(QPrinter::DevicePixel).toRect();
     int pageWidth = pageRect.width();
     int pageHeight = pageRect.height();
@@ -1317,6 +1365,27 @@ void PdfExporter::renderTransitPage(
     int marginY = static_cast<int>(10 * mmToPixelY);
     int y = marginY;
 
+    // Textanalyse parallel vorbereiten
+    const QSizeF textPageSize(pageWidth - 2 * marginX, pageHeight - 2 * marginY);
+    const int textDpiX = printer.logicalDpiX();
+    const int textDpiY = printer.logicalDpiY();
+    job.text = QtConcurrent::run([=]() {
+      // Temporäres Radix mit synastrie-Pointer für die Analyse erstellen
+      // Transit-Analyse erwartet radix.synastrie als Transit-Radix
+      Radix tempRadix = radix;
+      tempRadix.synastrie = std::make_shared<Radix>(transit);
+      tempRadix.horoTyp = TYP_TRANSIT;
+
+      AstroTextAnalyzer analyzer;
+      analyzer.setOrben(&auinit);
+
+      // Druck-Styles wie bei Radix-Textanalyse
+      QString html;
+      HtmlReportSink sink(html, HtmlReportSink::druckStil());
+      analyzer.buildReport(tempRadix, sink);
+      return layoutAnalysis(html, textDpiX, textDpiY, textPageSize);
+    });
+
     // Helper: Farbe anpassen (weiß -> schwarz)
     auto adjustColor = [](QColor c) -> QColor {
       if (c.lightness() > 200)
@@ -1434,13 +1503,13 @@ void PdfExporter::renderTransitPage(
       painter.setFont(symbolFont);
       QString symbol = astroFont().planetSymbol(i);
       painter.setPen(adjustColor(getPlanetColor(i, auinit)));
-      painter.drawText(col1X, posY + painter.fontMetrics().ascent(), symbol);
+      drawSymbol(painter, col1X, posY + painter.fontMetrics().ascent(), symbol);
 
       // Rückläufig?
       if (i < radix.planetTyp.size() && (radix.planetTyp[i] & P_TYP_RUCK)) {
-        painter.drawText(col1X + static_cast<int>(4 * mmToPixelX),
-                         posY + painter.fontMetrics().ascent(),
-                         astroFont().retrogradeSymbol());
+        drawSymbol(painter, col1X + static_cast<int>(4 * mmToPixelX),
+                   posY + painter.fontMetrics().ascent(),
+                   astroFont().retrogradeSymbol());
       }
 
       // Position (ohne Sternzeichen)
@@ -1453,14 +1522,14 @@ void PdfExporter::renderTransitPage(
       painter.setFont(zodiacFont);
       int zeichen = getZeichen(radix.planet[i]);
       painter.setPen(adjustColor(getZeichenColor(zeichen)));
-      painter.drawText(col1X + static_cast<int>(20 * mmToPixelX),
-                       posY + painter.fontMetrics().ascent(),
-                       astroFont().sternzeichenSymbol(zeichen));
+      drawSymbol(painter, col1X + static_cast<int>(20 * mmToPixelX),
+                 posY + painter.fontMetrics().ascent(),
+                 astroFont().sternzeichenSymbol(zeichen));
 
       // Legende: Symbol = Name
       painter.setFont(symbolFont);
       painter.setPen(adjustColor(getPlanetColor(i, auinit)));
-      painter.drawText(col3X, posY + painter.fontMetrics().ascent(), symbol);
+      drawSymbol(painter, col3X, posY + painter.fontMetrics().ascent(), symbol);
       painter.setFont(smallFont);
       painter.setPen(Qt::black);
       painter.drawText(col3X + static_cast<int>(5 * mmToPixelX),
@@ -1483,9 +1552,9 @@ void PdfExporter::renderTransitPage(
       painter.setFont(zodiacFont);
       int zeichen = getZeichen(radix.haus[i]);
       painter.setPen(adjustColor(getZeichenColor(zeichen)));
-      painter.drawText(col2X + static_cast<int>(20 * mmToPixelX),
-                       hausY + painter.fontMetrics().ascent(),
-                       astroFont().sternzeichenSymbol(zeichen));
+      drawSymbol(painter, col2X + static_cast<int>(20 * mmToPixelX),
+                 hausY + painter.fontMetrics().ascent(),
+                 astroFont().sternzeichenSymbol(zeichen));
       hausY += lineHeight;
     }
 
@@ -1499,8 +1568,8 @@ void PdfExporter::renderTransitPage(
     for (int i = 0; i < 12; ++i) {
       painter.setFont(zodiacFont);
       painter.setPen(adjustColor(getZeichenColor(i)));
-      painter.drawText(col3X, posY + painter.fontMetrics().ascent(),
-                       astroFont().sternzeichenSymbol(i));
+      drawSymbol(painter, col3X, posY + painter.fontMetrics().ascent(),
+                 astroFont().sternzeichenSymbol(i));
       painter.setFont(smallFont);
       painter.drawText(col3X + static_cast<int>(5 * mmToPixelX),
                        posY + painter.fontMetrics().ascent(), zeichenNames[i]);
@@ -1517,8 +1586,8 @@ void PdfExporter::renderTransitPage(
     for (const auto &asp : aspekte) {
       painter.setFont(symbolFont);
       painter.setPen(adjustColor(getAspektColor(asp.id)));
-      painter.drawText(col3X, posY + painter.fontMetrics().ascent(),
-                       astroFont().aspektSymbol(asp.id));
+      drawSymbol(painter, col3X, posY + painter.fontMetrics().ascent(),
+                 astroFont().aspektSymbol(asp.id));
 
       painter.setFont(smallFont);
       painter.setPen(Qt::black);
@@ -1568,14 +1637,14 @@ void PdfExporter::renderTransitPage(
       painter.setFont(symbolFont);
       QString symbol = astroFont().planetSymbol(i);
       painter.setPen(adjustColor(getPlanetColor(i, auinit)));
-      painter.drawText(marginX + static_cast<int>(4 * mmToPixelX),
-                       y + painter.fontMetrics().ascent(), symbol);
+      drawSymbol(painter, marginX + static_cast<int>(4 * mmToPixelX),
+                 y + painter.fontMetrics().ascent(), symbol);
 
       // Rückläufig?
       if (i < transit.planetTyp.size() && (transit.planetTyp[i] & P_TYP_RUCK)) {
-        painter.drawText(marginX + static_cast<int>(8 * mmToPixelX),
-                         y + painter.fontMetrics().ascent(),
-                         astroFont().retrogradeSymbol());
+        drawSymbol(painter, marginX + static_cast<int>(8 * mmToPixelX),
+                   y + painter.fontMetrics().ascent(),
+                   astroFont().retrogradeSymbol());
       }
 
       // Position (ohne Sternzeichen)
@@ -1588,9 +1657,9 @@ void PdfExporter::renderTransitPage(
       painter.setFont(zodiacFont);
       int zeichen = getZeichen(transit.planet[i]);
       painter.setPen(adjustColor(getZeichenColor(zeichen)));
-      painter.drawText(marginX + static_cast<int>(24 * mmToPixelX),
-                       y + painter.fontMetrics().ascent(),
-                       astroFont().sternzeichenSymbol(zeichen));
+      drawSymbol(painter, marginX + static_cast<int>(24 * mmToPixelX),
+                 y + painter.fontMetrics().ascent(),
+                 astroFont().sternzeichenSymbol(zeichen));
       y += lineHeight;
     }
 
@@ -1668,20 +1737,20 @@ void PdfExporter::renderTransitPage(
         // Planet1
         painter.setFont(symbolFont);
         painter.setPen(adjustColor(getPlanetColor(i, auinit)));
-        painter.drawText(aspX + static_cast<int>(2 * mmToPixelX),
-                         aspY + painter.fontMetrics().ascent(), sym1);
+        drawSymbol(painter, aspX + static_cast<int>(2 * mmToPixelX),
+                   aspY + painter.fontMetrics().ascent(), sym1);
 
         // Zeichen1
         painter.setFont(zodiacFont);
         painter.setPen(adjustColor(getZeichenColor(zeichen1)));
-        painter.drawText(aspX + static_cast<int>(7 * mmToPixelX),
-                         aspY + painter.fontMetrics().ascent(), sign1);
+        drawSymbol(painter, aspX + static_cast<int>(7 * mmToPixelX),
+                   aspY + painter.fontMetrics().ascent(), sign1);
 
         // Aspekt
         painter.setFont(symbolFont);
         painter.setPen(adjustColor(getAspektColor(asp)));
-        painter.drawText(aspX + static_cast<int>(13 * mmToPixelX),
-                         aspY + painter.fontMetrics().ascent(), aspSym);
+        drawSymbol(painter, aspX + static_cast<int>(13 * mmToPixelX),
+                   aspY + painter.fontMetrics().ascent(), aspSym);
 
         // R- prefix
         painter.setFont(smallFont);
@@ -1692,14 +1761,14 @@ void PdfExporter::renderTransitPage(
         // Planet2
         painter.setFont(symbolFont);
         painter.setPen(adjustColor(getPlanetColor(j, auinit)));
-        painter.drawText(aspX + static_cast<int>(21 * mmToPixelX),
-                         aspY + painter.fontMetrics().ascent(), sym2);
+        drawSymbol(painter, aspX + static_cast<int>(21 * mmToPixelX),
+                   aspY + painter.fontMetrics().ascent(), sym2);
 
         // Zeichen2
         painter.setFont(zodiacFont);
         painter.setPen(adjustColor(getZeichenColor(zeichen2)));
-        painter.drawText(aspX + static_cast<int>(27 * mmToPixelX),
-                         aspY + painter.fontMetrics().ascent(), sign2);
+        drawSymbol(painter, aspX + static_cast<int>(27 * mmToPixelX),
+                   aspY + painter.fontMetrics().ascent(), sign2);
 
         // Orb
         painter.setFont(smallFont);
@@ -1755,70 +1824,9 @@ void PdfExporter::renderTransitPage(
     pageNum++;
     y = marginY;
 
-    // Temporäres Radix mit synastrie-Pointer für die Analyse erstellen
-    // analyzeTransit erwartet radix.synastrie als Transit-Radix
-    Radix tempRadix = radix;
-    tempRadix.synastrie = std::make_shared<Radix>(transit);
-    tempRadix.horoTyp = TYP_TRANSIT;
-
-    AstroTextAnalyzer analyzer;
-    analyzer.setOrben(&auinit);
-    // Transit-Analyse: Wir übergeben das kombinierte Radix
-    QString html = analyzer.analyzeTransit(tempRadix);
-
-    // CSS-Styles wie bei Radix-Textanalyse
-    html.replace(
-        "</head>",
-        "<style>"
-        "body { font-family: 'DejaVu Sans'; font-size: 9pt; } "
-        "h1 { font-size: 14pt; font-weight: bold; } "
-        "h2 { font-size: 10pt; font-weight: bold; } "
-        "h3 { font-size: 9pt; font-weight: bold; } "
-        "p { font-size: 9pt; }"
-        "</style></head>");
-
-    QTextDocument doc;
-    doc.documentLayout()->setPaintDevice(&printer);
-    doc.setDefaultFont(QFont("DejaVu Sans", 9));
-    doc.setDefaultStyleSheet(
-        "body { font-family: 'DejaVu Sans'; font-size: 9pt; } "
-        "h1 { font-size: 14pt; font-weight: bold; } "
-        "h2 { font-size: 10pt; font-weight: bold; } "
-        "h3 { font-size: 9pt; font-weight: bold; } "
-        "p { margin-bottom: 10px; }");
-    doc.setHtml(html);
-    doc.setTextWidth(pageWidth - 2 * marginX);
-    doc.setPageSize(QSizeF(pageWidth - 2 * marginX, pageHeight - 2 * marginY));
-
-    double currentY = 0;
-    double contentHeight = doc.size().height();
-
-    while (currentY < contentHeight) {
-      painter.save();
-      painter.translate(marginX, y);
-      QRectF clipRect(0, 0, pageWidth - 2 * marginX, pageHeight - y - marginY);
-      painter.setClipRect(clipRect);
-      painter.translate(0, -currentY);
-      QAbstractTextDocumentLayout::PaintContext ctx;
-      ctx.clip = QRectF(0, currentY, clipRect.width(), clipRect.height());
-      doc.documentLayout()->draw(&painter, ctx);
-      painter.restore();
-
-      painter.setFont(smallFont);
-      painter.setPen(Qt::gray);
-      painter.drawText(
-          marginX, pageHeight - marginY,
-          QString("Erstellt mit AstroUniverse 2026 am %1 - Seite %2")
-              .arg(QDate::currentDate().toString("dd.MM.yyyy"))
-              .arg(pageNum));
-
-      currentY += (pageHeight - y - marginY);
-      if (currentY < contentHeight) {
-        printer.newPage();
-        pageNum++;
-        y = marginY;
-      }
-    }
+    // Die Textseiten zeichnet finishExport(), sobald der Worker fertig ist
+    job.fortsetzung = {marginX, y, marginY, pageHeight - marginY, pageNum,
+                       smallFont};
 }
 
 } // namespace astro
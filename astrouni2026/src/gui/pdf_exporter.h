@@ -11,6 +11,7 @@
 #include <QWidget>
 #include <QPainter>
 #include <QPrinter>
+#include <memory>
 
 #include "../core/data_types.h"
 
@@ -27,6 +28,12 @@ class ChartWidget;
  * - Aspekte-Tabelle
  * - Häuser-Tabelle
  * - Personen-Daten
+ *
+ * Die Textanalyse wird beim Export auf einem Worker-Thread erzeugt und
+ * gelayoutet, während der GUI-Thread die Grafik- und Tabellenseiten in den
+ * QPrinter schreibt. Die Export- und Druckfunktionen kehren danach zurück;
+ * die Textseiten werden angehängt und das Dokument geschlossen, sobald der
+ * Worker fertig ist. Erst dann meldet exportFinished() das Ergebnis.
  */
 class PdfExporter : public QObject {
     Q_OBJECT
@@ -41,7 +48,7 @@ public:
      * @param auinit Die Einstellungen
      * @param chartWidget Das Chart-Widget für die Grafik
      * @param parent Parent-Widget für Dialoge
-     * @return true bei Erfolg
+     * @return true, wenn der Export gestartet wurde
      */
     bool exportRadix(const Radix& radix, const AuInit& auinit, 
                      ChartWidget* chartWidget, QWidget* parent);
@@ -52,7 +59,7 @@ public:
      * @param auinit Die Einstellungen
      * @param chartWidget Das Chart-Widget für die Grafik
      * @param parent Parent-Widget für Dialoge
-     * @return true bei Erfolg
+     * @return true, wenn der Export gestartet wurde
      */
     bool printRadix(const Radix& radix, const AuInit& auinit,
                     ChartWidget* chartWidget, QWidget* parent);
@@ -64,7 +71,7 @@ public:
      * @param auinit Die Einstellungen
      * @param chartWidget Das Chart-Widget für die Grafik
      * @param parent Parent-Widget für Dialoge
-     * @return true bei Erfolg
+     * @return true, wenn der Export gestartet wurde
      */
     bool exportSynastrie(const Radix& radix1, const Radix& radix2,
                          const AuInit& auinit, ChartWidget* chartWidget, QWidget* parent);
@@ -87,6 +94,14 @@ public:
     bool printTransit(const Radix& radix, const Radix& transit,
                       const AuInit& auinit, ChartWidget* chartWidget, QWidget* parent);
 
+signals:
+    /**
+     * @brief Ein gestarteter Export bzw. Druck ist abgeschlossen
+     * @param ziel Dateiname bzw. Druckername
+     * @param ok false, wenn das Dokument nicht geschrieben werden konnte
+     */
+    void exportFinished(const QString& ziel, bool ok);
+
 private:
     /**
      * @brief Generiert das HTML für das PDF
@@ -144,17 +159,30 @@ private:
      */
     QColor getZeichenColor(int zeichen);
 
+    struct ExportJob;
+
+    /**
+     * @brief Hängt die Textseiten an, sobald sie fertig sind, und schließt
+     *        das Dokument (ohne den GUI-Thread zu blockieren)
+     */
+    void finishExport(std::shared_ptr<ExportJob> job);
+
+    /**
+     * @brief Zeichnet die Textseiten, schließt das Dokument und meldet es
+     *        (einmal je Job, auch beim Beenden der Anwendung)
+     */
+    static void completeExport(ExportJob& job);
+
     /**
      * @brief Rendert die Seite mit QPainter
      */
-    void renderPage(QPainter& painter, QPrinter& printer,
-                    const Radix& radix, const AuInit& auinit,
+    void renderPage(ExportJob& job, const Radix& radix, const AuInit& auinit,
                     ChartWidget* chartWidget);
 
     /**
      * @brief Rendert Synastrie-Seite mit QPainter
      */
-    void renderSynastriePage(QPainter& painter, QPrinter& printer,
+    void renderSynastriePage(ExportJob& job,
                               const Radix& radix1, const Radix& radix2,
                               const AuInit& auinit, ChartWidget* chartWidget);
 
@@ -163,7 +191,7 @@ private:
      * Seite 1: Person-Daten + Grafik + Positionen Person
      * Seite 2: Transit-Positionen + Aspekte
      */
-    void renderTransitPage(QPainter& painter, QPrinter& printer,
+    void renderTransitPage(ExportJob& job,
                             const Radix& radix, const Radix& transit,
                             const AuInit& auinit, ChartWidget* chartWidget);
 };
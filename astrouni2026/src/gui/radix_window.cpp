@@ -11,7 +11,8 @@
 #include "../core/calculations.h"
 #include "../core/chart_calc.h"
 #include "../core/astro_font_provider.h"
-#include "../core/astro_text_analyzer.h"
+#include "../core/analysis_cache.h"
+#include "../core/synastry.h"
 
 #include <QHBoxLayout>
 #include <QVBoxLayout>
@@ -23,6 +24,7 @@
 #include <QTextStream>
 #include <QStringConverter>
 #include <QDate>
+#include <QtConcurrent>
 
 namespace astro {
 
@@ -39,11 +41,21 @@ RadixWindow::RadixWindow(QWidget* parent, const AuInit& auinit, const Radix& rad
     , m_showSynastrieAspects(false)  // STRICT LEGACY: LB_A initial auf Radix-Aspekte
     , m_updatingSpinBoxes(false) {
     
+    // Übergebener Radix ist bereits vollständig berechnet
+    m_pipeline.adopt(m_radix, m_auinit, TYP_RADIX, m_radix.synastrie.get());
+    
+    // Beim Durchscrollen der Zeit nur den letzten Stand vorberechnen
+    m_textTimer = new QTimer(this);
+    m_textTimer->setSingleShot(true);
+    m_textTimer->setInterval(300);
+    connect(m_textTimer, &QTimer::timeout, this, &RadixWindow::prefetchTextAnalysis);
+    
     setupUI();
     
     // Initiale Anzeige
     updateDisplay();
     updateTimeSpinBoxes();
+    prefetchTextAnalysis();
 }
 
 RadixWindow::~RadixWindow() {
@@ -190,9 +202,12 @@ void RadixWindow::setupUI() {
     connect(m_neuButton, &QPushButton::clicked, this, &RadixWindow::onNeuClicked);
     spinBoxLayout->addWidget(m_neuButton);
     
+    // Getippte Werte erst mit Enter/Fokuswechsel übernehmen: jede Zwischen-
+    // ziffer wäre ein neues JD und damit eine vollständige Neuberechnung
     m_minuteSpinBox = new QSpinBox(timeScrollWidget);
     m_minuteSpinBox->setRange(0, 59);
     m_minuteSpinBox->setWrapping(true);
+    m_minuteSpinBox->setKeyboardTracking(false);
     connect(m_minuteSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), 
             this, &RadixWindow::onMinuteChanged);
     spinBoxLayout->addWidget(m_minuteSpinBox);
@@ -200,6 +215,7 @@ void RadixWindow::setupUI() {
     m_hourSpinBox = new QSpinBox(timeScrollWidget);
     m_hourSpinBox->setRange(0, 23);
     m_hourSpinBox->setWrapping(true);
+    m_hourSpinBox->setKeyboardTracking(false);
     connect(m_hourSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), 
             this, &RadixWindow::onHourChanged);
     spinBoxLayout->addWidget(m_hourSpinBox);
@@ -207,6 +223,7 @@ void RadixWindow::setupUI() {
     m_daySpinBox = new QSpinBox(timeScrollWidget);
     m_daySpinBox->setRange(1, 31);
     m_daySpinBox->setWrapping(true);
+    m_daySpinBox->setKeyboardTracking(false);
     connect(m_daySpinBox, QOverload<int>::of(&QSpinBox::valueChanged), 
             this, &RadixWindow::onDayChanged);
     spinBoxLayout->addWidget(m_daySpinBox);
@@ -214,12 +231,14 @@ void RadixWindow::setupUI() {
     m_monthSpinBox = new QSpinBox(timeScrollWidget);
     m_monthSpinBox->setRange(1, 12);
     m_monthSpinBox->setWrapping(true);
+    m_monthSpinBox->setKeyboardTracking(false);
     connect(m_monthSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), 
             this, &RadixWindow::onMonthChanged);
     spinBoxLayout->addWidget(m_monthSpinBox);
     
     m_yearSpinBox = new QSpinBox(timeScrollWidget);
     m_yearSpinBox->setRange(1600, 2400);
+    m_yearSpinBox->setKeyboardTracking(false);
     connect(m_yearSpinBox, QOverload<int>::of(&QSpinBox::valueChanged), 
             this, &RadixWindow::onYearChanged);
     spinBoxLayout->addWidget(m_yearSpinBox);
@@ -803,26 +822,9 @@ void RadixWindow::fillAspekteList() {
         const Radix& syn = *m_radix.synastrie;
         int numSyn = qMin(syn.anzahlPlanet, static_cast<int16_t>(syn.planet.size()));
         
-        // Orben aus Einstellungen verwenden
-        // Index: [Planet1 * MAX_PLANET + Planet2] * ASPEKTE + Aspekt
-        const QVector<float>& orben = (m_radix.horoTyp == TYP_SYNASTRIE) ? 
-            m_auinit.orbenSPlanet : m_auinit.orbenTPlanet;
-        static const int aspekte[] = { KONJUNKTION, HALBSEX, SEXTIL, QUADRATUR, TRIGON, QUINCUNX, OPOSITION };
-        static const double aspWinkel[] = { 0.0, 30.0, 60.0, 90.0, 120.0, 150.0, 180.0 };
-        
-        // Lambda für Aspekt-Prüfung mit konfigurierten Orben
-        auto checkAspekt = [&](int p1, int p2, double pos1, double pos2) -> int16_t {
-            double diff = std::abs(pos1 - pos2);
-            if (diff > 180.0) diff = 360.0 - diff;
-            for (int a = 0; a < ASPEKTE; ++a) {
-                int idx = (p1 * MAX_PLANET + p2) * ASPEKTE + a;
-                float orb = (idx < orben.size() && orben[idx] > 0.0f) ? orben[idx] : 8.0f;
-                if (std::abs(diff - aspWinkel[a]) <= orb) {
-                    return aspekte[a];
-                }
-            }
-            return KEIN_ASP;
-        };
+        // Kreuz-Aspekte mit Orben aus Einstellungen (aus der Pipeline, sonst neu)
+        const int kreuzTyp = (m_radix.horoTyp == TYP_SYNASTRIE) ? TYP_SYNASTRIE : TYP_TRANSIT;
+        const auto kreuz = SynastrieCalc::ergebnis(m_radix, syn, m_auinit, kreuzTyp);
         
         // ===== BEREICH 3: Aspekte ZWISCHEN Radix 1 und 2 =====
         QString crossHeader = (m_radix.horoTyp == TYP_SYNASTRIE) 
@@ -847,7 +849,7 @@ void RadixWindow::fillAspekteList() {
                 
                 double pos1 = syn.planet[i];
                 double pos2 = m_radix.planet[j];
-                int16_t asp = checkAspekt(i, j, pos1, pos2);
+                int16_t asp = kreuz->planetAspekt(j, i);
                 
                 if (asp == KEIN_ASP) continue;
                 
@@ -1112,6 +1114,8 @@ void RadixWindow::onNeuClicked() {
     // STRICT LEGACY: "Neu" öffnet den Personen-Erfassungs-Dialog (CM_U_PERSON -> DlgPErfassen)
     PersonDialog dialog(this, m_auinit, m_radix);
     if (dialog.exec() == QDialog::Accepted && dialog.wasCalculated()) {
+        // Neuer Radix aus dem Dialog - bisherige Stufen gelten nicht mehr
+        m_pipeline.adopt(m_radix, m_auinit, TYP_RADIX, m_radix.synastrie.get());
         updateTimeSpinBoxes();
         updateDisplay();
     }
@@ -1166,8 +1170,9 @@ void RadixWindow::updateTimeSpinBoxes() {
     m_updatingSpinBoxes = true;
     
     // Zeit aus Dezimalzahl extrahieren
-    int hour = static_cast<int>(m_radix.rFix.zeit);
-    int minute = static_cast<int>((m_radix.rFix.zeit - hour) * 60.0 + 0.5);
+    int16_t hour = 0;
+    int16_t minute = 0;
+    Calculations::decimalToTime(m_radix.rFix.zeit, hour, minute);
     
     m_minuteSpinBox->setValue(minute);
     m_hourSpinBox->setValue(hour);
@@ -1179,10 +1184,32 @@ void RadixWindow::updateTimeSpinBoxes() {
 }
 
 void RadixWindow::recalculateChart() {
-    // Chart neu berechnen mit geänderten Zeitdaten
-    if (ChartCalc::calculate(m_radix, nullptr, TYP_RADIX) >= 0) {
+    // Datum/Zeit ändern das JD und damit alle Horoskop-Stufen; ein schon
+    // einmal berechneter Zeitpunkt kommt aus dem Chart-Cache
+    if (m_pipeline.calculate(m_radix, TYP_RADIX) >= 0) {
+        m_pipeline.calcAspects(m_radix, m_auinit, m_radix.horoTyp, m_radix.synastrie.get());
         updateDisplay();
+        m_textTimer->start();
+    }
+}
+
+void RadixWindow::prefetchTextAnalysis() {
+    // Textanalyse schon jetzt im Worker-Thread erzeugen, damit der
+    // Textanalyse-Button sie fertig aus dem Cache bekommt. Der Worker
+    // arbeitet auf Kopien - das Fenster kann währenddessen weiterrechnen.
+    // Läuft noch eine Vorberechnung, später erneut versuchen statt eine
+    // zweite zu starten.
+    if (m_textFuture.isRunning()) {
+        m_textTimer->start();
+        return;
     }
+    Radix radix = m_radix;
+    if (radix.synastrie) {
+        radix.synastrie = std::make_shared<Radix>(*radix.synastrie);
+    }
+    m_textFuture = QtConcurrent::run([radix, auinit = m_auinit]() {
+        return analysisCache().analyzeRadix(radix, auinit);
+    });
 }
 
 //==============================================================================
@@ -1201,10 +1228,13 @@ void RadixWindow::onTextAnalyseClicked() {
     QTextBrowser* textBrowser = new QTextBrowser(dialog);
     textBrowser->setOpenExternalLinks(false);
     
-    // Textanalyse generieren mit Orben aus Einstellungen
-    AstroTextAnalyzer analyzer;
-    analyzer.setOrben(&m_auinit);
-    QString analysisHtml = analyzer.analyzeRadix(m_radix);
+    // Läuft die Vorberechnung noch, darauf warten statt doppelt zu rechnen;
+    // eine noch ausstehende wird hier ohnehin direkt erledigt
+    m_textTimer->stop();
+    m_textFuture.waitForFinished();
+    
+    // Textanalyse mit Orben aus Einstellungen (meist schon im Cache)
+    const QString& analysisHtml = m_pipeline.text(m_radix, m_auinit);
     textBrowser->setHtml(analysisHtml);
     
     layout->addWidget(textBrowser);
@@ -1214,17 +1244,30 @@ void RadixWindow::onTextAnalyseClicked() {
     
     QPushButton* pdfButton = new QPushButton(tr("Als PDF exportieren"), dialog);
     connect(pdfButton, &QPushButton::clicked, [this, dialog]() {
-        PdfExporter exporter;
+        // Der Export endet erst nach der Rückkehr - Exporter bis dahin halten
+        PdfExporter* exporter = new PdfExporter(this);
+        connect(exporter, &PdfExporter::exportFinished, this,
+                [this, exporter](const QString& ziel, bool ok) {
+            if (!ok) {
+                QMessageBox::warning(this, tr("PDF Export"),
+                    tr("%1 konnte nicht geschrieben werden.").arg(ziel));
+            }
+            exporter->deleteLater();
+        });
+        bool gestartet;
         if (m_radix.synastrie) {
             if (m_radix.horoTyp == TYP_TRANSIT) {
-                exporter.exportTransit(m_radix, *m_radix.synastrie, m_auinit, 
-                                       m_chartWidget, this);
+                gestartet = exporter->exportTransit(m_radix, *m_radix.synastrie, m_auinit, 
+                                                    m_chartWidget, this);
             } else {
-                exporter.exportSynastrie(m_radix, *m_radix.synastrie, m_auinit, 
-                                          m_chartWidget, this);
+                gestartet = exporter->exportSynastrie(m_radix, *m_radix.synastrie, m_auinit, 
+                                                      m_chartWidget, this);
             }
         } else {
-            exporter.exportRadix(m_radix, m_auinit, m_chartWidget, this);
+            gestartet = exporter->exportRadix(m_radix, m_auinit, m_chartWidget, this);
+        }
+        if (!gestartet) {
+            exporter->deleteLater();
         }
     });
     buttonLayout->addWidget(pdfButton);
@@ -12,7 +12,10 @@
 #include <QSpinBox>
 #include <QLabel>
 #include <QTextBrowser>
+#include <QFuture>
+#include <QTimer>
 #include "../core/data_types.h"
+#include "../core/chart_pipeline.h"
 
 namespace astro {
 
@@ -45,6 +48,11 @@ public:
      */
     ChartWidget* getChartWidget() const { return m_chartWidget; }
     
+    /**
+     * @brief Gibt die Berechnungs-Pipeline zurück (für den Diagnose-Dialog)
+     */
+    const ChartPipeline& getPipeline() const { return m_pipeline; }
+    
     /**
      * @brief Setzt die Radix-Daten
      */
@@ -91,6 +99,13 @@ private:
     AuInit m_auinit;
     Radix m_radix;
     
+    // Inkrementelle Neuberechnung von m_radix
+    ChartPipeline m_pipeline;
+    
+    // Im Hintergrund vorbereitete Textanalyse (landet in analysisCache())
+    QFuture<QString> m_textFuture;
+    QTimer* m_textTimer;        // startet die Vorberechnung erst, wenn die Eingabe ruht
+    
     // Widgets
     ChartWidget* m_chartWidget;
     QListWidget* m_listWidget;
@@ -125,6 +140,7 @@ private:
     // Hilfsfunktion
     void updateTimeSpinBoxes();
     void recalculateChart();
+    void prefetchTextAnalysis();
 };
 
 } // namespace astro
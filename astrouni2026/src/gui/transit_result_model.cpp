@@ -0,0 +1,216 @@
+/**
+ * @file transit_result_model.cpp
+ * @brief Implementierung des Multi-Transit-Listen-Modells
+ */
+
+#include "transit_result_model.h"
+#include "../core/calculations.h"
+#include "../core/constants.h"
+#include "../core/astro_font_provider.h"
+
+namespace astro {
+
+namespace {
+
+// Formatierte Zeilen im Speicher (sichtbare Zeilen plus Scroll-Reserve)
+constexpr int ZEILEN_CACHE = 2000;
+
+int aspektToIndex(int aspekt) {
+    switch (aspekt) {
+        case KONJUNKTION: return 0;
+        case HALBSEX: return 1;
+        case SEXTIL: return 2;
+        case QUADRATUR: return 3;
+        case TRIGON: return 4;
+        case QUINCUNX: return 5;
+        case OPOSITION: return 6;
+        default: return 0;
+    }
+}
+
+QString datumText(const Radix& tr) {
+    return QString("%1.%2.%3")
+        .arg(tr.rFix.tag, 2, 10, QChar('0'))
+        .arg(tr.rFix.monat, 2, 10, QChar('0'))
+        .arg(tr.rFix.jahr, 4, 10, QChar('0'));
+}
+
+QString fontSpan(const QString& family, const QString& text) {
+    return QString("<span style='font-family:\"%1\"'>%2</span>").arg(family, text);
+}
+
+} // namespace
+
+TransitResultModel::TransitResultModel(const Radix& basisRadix, QObject* parent)
+    : QAbstractListModel(parent)
+    , m_basisRadix(basisRadix)
+    , m_html(ZEILEN_CACHE) {
+    connect(&astroFont(), &AstroFontProvider::fontsChanged,
+            this, &TransitResultModel::onFontsChanged);
+}
+
+void TransitResultModel::setResults(const QVector<Radix>& transits,
+                                    const QVector<TransitAspekt>& aspekte,
+                                    const SignTimeline& zeichen) {
+    beginResetModel();
+    m_transits = transits;
+    m_zeichen = zeichen;
+    // Ohne passende Zeitleiste (z.B. Aufbau abgebrochen) hier neu aufbauen
+    if (m_transits.size() > 1 && !m_zeichen.deckt(m_transits.first().jd, m_transits.last().jd)) {
+        m_zeichen.build(m_basisRadix, m_transits.first().jd, m_transits.last().jd);
+    }
+    m_aspekte.clear();
+    m_aspekte.reserve(aspekte.size());
+    for (const TransitAspekt& ta : aspekte) {
+        if (ta.startIndex >= 0 && ta.startIndex < m_transits.size()) {
+            m_aspekte.append(ta);
+        }
+    }
+    m_html.clear();
+    uebernehmeFonts();
+    endResetModel();
+}
+
+void TransitResultModel::uebernehmeFonts() {
+    m_planetFont = astroFont().getPlanetSymbolFont(12).family();
+    m_zodiacFont = astroFont().hasAstroFont() ? astroFont().fontName() : m_planetFont;
+    m_aspektFont = astroFont().getAspektSymbolFont(12).family();
+}
+
+void TransitResultModel::onFontsChanged() {
+    // Zeilen enthalten Symbole und Font-Familien der vorläufigen Auflösung
+    uebernehmeFonts();
+    m_html.clear();
+    if (rowCount() > 0) {
+        emit dataChanged(index(0), index(rowCount() - 1), { Qt::DisplayRole });
+    }
+}
+
+int TransitResultModel::rowCount(const QModelIndex& parent) const {
+    if (parent.isValid()) {
+        return 0;
+    }
+    // Ohne Aspekte eine Zeile "Keine Aspekte gefunden"
+    if (m_aspekte.isEmpty()) {
+        return m_transits.isEmpty() ? 0 : 1;
+    }
+    return m_aspekte.size();
+}
+
+QVariant TransitResultModel::data(const QModelIndex& index, int role) const {
+    if (!index.isValid() || index.row() >= rowCount()) {
+        return QVariant();
+    }
+    const int row = index.row();
+
+    switch (role) {
+        case Qt::DisplayRole: {
+            if (m_aspekte.isEmpty()) {
+                return formatLeer();
+            }
+            if (const QString* html = m_html.object(row)) {
+                return *html;
+            }
+            const QString html = formatRow(row);
+            m_html.insert(row, new QString(html));
+            return html;
+        }
+        case TransitIndexRole:
+            return m_aspekte.isEmpty() ? 0 : m_aspekte.at(row).startIndex;
+        default:
+            return QVariant();
+    }
+}
+
+const TransitAspekt* TransitResultModel::aspekt(int row) const {
+    if (row < 0 || row >= m_aspekte.size()) {
+        return nullptr;
+    }
+    return &m_aspekte.at(row);
+}
+
+QString TransitResultModel::formatRow(int row) const {
+    // STRICT LEGACY: Port von sTextOut/DRW_LB_TXT_TRANSIT aus aulistbo.c
+    // Format: [Transit-Planet][℞] in [Zeichen...] [Aspekt] [Radix-Planet/Haus] in [Zeichen] von [Datum] bis [Datum]
+    const TransitAspekt& ta = m_aspekte.at(row);
+    const int endIdx = qMin(ta.endIndex >= 0 ? ta.endIndex : ta.startIndex, m_transits.size() - 1);
+    const Radix& trStart = m_transits.at(ta.startIndex);
+    const Radix& trEnd   = m_transits.at(endIdx);
+
+    // Transit-Planet mit Retrograde-Symbol
+    QString transitPlanetSym = astroFont().planetSymbol(ta.transitPlanet);
+    bool isRetro = (trStart.planetTyp.size() > ta.transitPlanet) &&
+                   (trStart.planetTyp[ta.transitPlanet] & P_TYP_RUCK);
+    if (isRetro) {
+        transitPlanetSym += QString::fromUtf8("℞");  // Retrograde-Symbol
+    }
+    QString transitPlanet = fontSpan(m_planetFont, transitPlanetSym);
+
+    // Sternzeichen während der Periode sammeln (STRICT LEGACY: alle durchlaufenen Zeichen)
+    // Nur Beginn und Ende sind voll berechnet - die Zeichen dazwischen
+    // kommen aus der Zeitleiste
+    QString transitZeichenRaw;
+    for (int8_t stz : m_zeichen.folge(ta.transitPlanet, trStart, trEnd)) {
+        transitZeichenRaw += astroFont().sternzeichenSymbol(stz);
+    }
+    if (transitZeichenRaw.isEmpty()) {
+        transitZeichenRaw = "?";
+    }
+    QString transitZeichen = fontSpan(m_zodiacFont, transitZeichenRaw);
+
+    // Aspekt-Symbol
+    QString aspekt = fontSpan(m_aspektFont, astroFont().aspektSymbol(aspektToIndex(ta.aspekt)));
+
+    // Radix-Planet oder Haus
+    QString radixObj;
+    QString radixZeichenRaw;
+    if (ta.isHaus) {
+        // Haus (STRICT LEGACY: ⌂1 - ⌂12)
+        radixObj = QString::fromUtf8("⌂%1").arg(ta.radixPlanet + 1);
+        // Sternzeichen des Hauses
+        if (m_basisRadix.stzHaus.size() > ta.radixPlanet) {
+            int8_t stz = m_basisRadix.stzHaus[ta.radixPlanet];
+            if (stz >= 0 && stz < 12) {
+                radixZeichenRaw = astroFont().sternzeichenSymbol(stz);
+            }
+        }
+    } else {
+        // Planet
+        QString radixPlanetSym = astroFont().planetSymbol(ta.radixPlanet);
+        // Retrograde-Symbol für Radix-Planet
+        if (m_basisRadix.planetTyp.size() > ta.radixPlanet &&
+            (m_basisRadix.planetTyp[ta.radixPlanet] & P_TYP_RUCK)) {
+            radixPlanetSym += QString::fromUtf8("℞");
+        }
+        radixObj = fontSpan(m_planetFont, radixPlanetSym);
+        // Sternzeichen des Radix-Planeten
+        if (m_basisRadix.stzPlanet.size() > ta.radixPlanet) {
+            int8_t stz = m_basisRadix.stzPlanet[ta.radixPlanet];
+            if (stz >= 0 && stz < 12) {
+                radixZeichenRaw = astroFont().sternzeichenSymbol(stz);
+            }
+        }
+    }
+    if (radixZeichenRaw.isEmpty()) {
+        radixZeichenRaw = "?";
+    }
+    QString radixZeichen = fontSpan(m_zodiacFont, radixZeichenRaw);
+
+    // STRICT LEGACY Format: [Planet][℞] in [Zeichen] [Aspekt] [Radix] in [Zeichen] von [Datum] bis [Datum]
+    return QString("%1 in %2 %3 %4 in %5 von %6 bis %7")
+        .arg(transitPlanet, transitZeichen, aspekt, radixObj, radixZeichen,
+             datumText(trStart), datumText(trEnd));
+}
+
+QString TransitResultModel::formatLeer() const {
+    const Radix& erster = m_transits.first();
+    int16_t stunde = 0;
+    int16_t minute = 0;
+    Calculations::decimalToTime(erster.rFix.zeit, stunde, minute);
+    QString time = QString("%1:%2")
+        .arg(stunde, 2, 10, QChar('0'))
+        .arg(minute, 2, 10, QChar('0'));
+    return QString("%1 %2 - Keine Aspekte gefunden").arg(datumText(erster), time);
+}
+
+} // namespace astro
@@ -0,0 +1,74 @@
+#pragma once
+/**
+ * @file transit_result_model.h
+ * @brief Listen-Modell für Multi-Transit-Ergebnisse
+ *
+ * Eine Zeile je Aspekt-Sequenz im Legacy-Format (DRW_LB_TXT_TRANSIT).
+ * Der HTML-Text einer Zeile wird erst erzeugt, wenn die Ansicht ihn
+ * anfragt - also nur für sichtbare Zeilen - und dann zwischengespeichert.
+ */
+
+#include <QAbstractListModel>
+#include <QCache>
+#include <QVector>
+#include "../core/data_types.h"
+#include "../core/transit_calc.h"
+#include "../core/sign_timeline.h"
+
+namespace astro {
+
+class TransitResultModel : public QAbstractListModel {
+    Q_OBJECT
+
+public:
+    enum Roles {
+        TransitIndexRole = Qt::UserRole + 1     // startIndex der Sequenz (Grafik)
+    };
+
+    explicit TransitResultModel(const Radix& basisRadix, QObject* parent = nullptr);
+
+    /**
+     * @brief Setzt die Ergebnisse eines Multi-Transit-Laufs
+     *
+     * Sequenzen ohne gültigen startIndex werden übergangen, Zeile und
+     * Aspekt stimmen damit immer überein. Die durchlaufenen Zeichen kommen
+     * aus zeichen (binäre Suche), ohne Zeitachse aus den Schnappschüssen.
+     */
+    void setResults(const QVector<Radix>& transits, const QVector<TransitAspekt>& aspekte,
+                    const SignTimeline& zeichen = SignTimeline());
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+    /**
+     * @brief Aspekt-Sequenz einer Zeile (nullptr für die Leer-Zeile)
+     */
+    const TransitAspekt* aspekt(int row) const;
+
+    const QVector<Radix>& transits() const { return m_transits; }
+
+private slots:
+    /**
+     * @brief Übernimmt die Fonts nach Ende der Font-Suche und baut die Zeilen neu
+     */
+    void onFontsChanged();
+
+private:
+    void uebernehmeFonts();
+    QString formatRow(int row) const;
+    QString formatLeer() const;
+
+    const Radix& m_basisRadix;
+    QVector<Radix> m_transits;
+    QVector<TransitAspekt> m_aspekte;
+    SignTimeline m_zeichen;
+
+    // Font-Familien (einmal je Ergebnis statt je Zeile)
+    QString m_planetFont;
+    QString m_zodiacFont;
+    QString m_aspektFont;
+
+    mutable QCache<int, QString> m_html;
+};
+
+} // namespace astro
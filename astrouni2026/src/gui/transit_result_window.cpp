@@ -7,14 +7,19 @@
 
 #include "transit_result_window.h"
 #include "html_item_delegate.h"
+#include "transit_result_model.h"
+#include "transit_table_window.h"
 #include "dialogs/retrograde_dialog.h"
 #include "../core/constants.h"
 #include "../core/astro_font_provider.h"
+#include "../core/transit_events.h"
+#include "../core/transit_table.h"
 
+#include <QApplication>
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QMessageBox>
-#include <cmath>
+#include <utility>
 
 namespace astro {
 
@@ -61,37 +66,46 @@ void TransitResultWindow::setupUI() {
     connect(m_ruecklaufButton, &QPushButton::clicked, this, &TransitResultWindow::onRuecklaufClicked);
     headerLayout->addWidget(m_ruecklaufButton);
     
+    // Perioden-Tabelle (sortier- und filterbar)
+    m_tabelleButton = new QPushButton(tr("Tabelle"), this);
+    connect(m_tabelleButton, &QPushButton::clicked, this, &TransitResultWindow::onTabelleClicked);
+    headerLayout->addWidget(m_tabelleButton);
+    
     mainLayout->addLayout(headerLayout);
     
-    // Listbox (STRICT LEGACY: hWndLBG mit LBS_OWNERDRAWFIXED)
-    m_listBox = new QListWidget(this);
+    // Listbox (STRICT LEGACY: hWndLBG mit LBS_OWNERDRAWFIXED - feste Zeilenhöhe,
+    // die Ansicht fragt nur sichtbare Zeilen ab)
+    m_model = new TransitResultModel(m_basisRadix, this);
+    m_listBox = new QListView(this);
     m_listBox->setMinimumHeight(200);
+    m_listBox->setUniformItemSizes(true);
+    m_listBox->setEditTriggers(QAbstractItemView::NoEditTriggers);
     m_listBox->setItemDelegate(new HtmlItemDelegate(m_listBox));
-    connect(m_listBox, &QListWidget::itemDoubleClicked, 
-            this, &TransitResultWindow::onListItemDoubleClicked);
+    m_listBox->setModel(m_model);
+    connect(m_listBox, &QListView::doubleClicked, 
+            this, &TransitResultWindow::onListDoubleClicked);
     mainLayout->addWidget(m_listBox);
 }
 
 void TransitResultWindow::setTransits(const QVector<Radix>& transits,
                                       const QVector<TransitAspekt>& aspekte,
                                       const QString& vonDatum, const QString& bisDatum,
-                                      const QVector<QVector<bool>>& transSel) {
-    m_transits = transits;
+                                      const QVector<QVector<bool>>& transSel,
+                                      const SignTimeline& zeichen) {
     m_transSel = transSel;
-    m_aspekte.clear();
     
+    QVector<TransitAspekt> auswahl;
     if (m_transSel.isEmpty()) {
-        m_aspekte = aspekte;
+        auswahl = aspekte;
     } else {
         int radixPlanets = m_basisRadix.planet.size();
-        int radixCount = radixPlanets + MAX_HAUS;
         for (const auto& ta : aspekte) {
             int tIdx = ta.transitPlanet;
             int rIdx = ta.isHaus ? radixPlanets + ta.radixPlanet : ta.radixPlanet;
             if (tIdx >= 0 && tIdx < m_transSel.size() &&
                 rIdx >= 0 && rIdx < m_transSel[tIdx].size() &&
                 m_transSel[tIdx][rIdx]) {
-                m_aspekte.push_back(ta);
+                auswahl.push_back(ta);
             }
         }
     }
@@ -99,7 +113,14 @@ void TransitResultWindow::setTransits(const QVector<Radix>& transits,
     m_vonDatumLabel->setText(vonDatum);
     m_bisDatumLabel->setText(bisDatum);
     
-    buildTransitTexts();
+    m_model->setResults(transits, auswahl, zeichen);
+    
+    // Neuer Lauf: Rückläufigkeit beim nächsten Klick neu rechnen
+    m_ruecklauf.clear();
+    m_ruecklaufBerechnet = false;
+    if (m_ruecklaufDialog) {
+        m_ruecklaufDialog->close();
+    }
 }
 
 QString TransitResultWindow::getTabTitle() const {
@@ -111,233 +132,122 @@ QString TransitResultWindow::getTabTitle() const {
     return tr("Transit: %1").arg(name.isEmpty() ? tr("Unbekannt") : name);
 }
 
-static int aspektToIndex(int aspekt) {
-    switch (aspekt) {
-        case KONJUNKTION: return 0;
-        case HALBSEX: return 1;
-        case SEXTIL: return 2;
-        case QUADRATUR: return 3;
-        case TRIGON: return 4;
-        case QUINCUNX: return 5;
-        case OPOSITION: return 6;
-        default: return 0;
-    }
-}
-
-void TransitResultWindow::buildTransitTexts() {
-    // STRICT LEGACY: Port von sTextOut/DRW_LB_TXT_TRANSIT aus aulistbo.c
-    // Format: [Transit-Planet][℞] in [Zeichen...] [Aspekt] [Radix-Planet/Haus] in [Zeichen] von [Datum] bis [Datum]
-    
-    m_listBox->clear();
-    
-    // Font-Families für HTML
-    QString planetFontFamily = astroFont().getPlanetSymbolFont(12).family();
-    QString zodiacFontFamily = astroFont().hasAstroFont() ? astroFont().fontName() : planetFontFamily;
-    QString aspektFontFamily = astroFont().getAspektSymbolFont(12).family();
-    
-    auto planetSpan = [&](const QString& text) {
-        return QString("<span style='font-family:\"%1\"'>%2</span>").arg(planetFontFamily, text);
-    };
-    auto zodiacSpan = [&](const QString& text) {
-        return QString("<span style='font-family:\"%1\"'>%2</span>").arg(zodiacFontFamily, text);
-    };
-    auto aspektSpan = [&](const QString& text) {
-        return QString("<span style='font-family:\"%1\"'>%2</span>").arg(aspektFontFamily, text);
-    };
-    
-    for (const auto& ta : m_aspekte) {
-        if (ta.startIndex < 0 || ta.startIndex >= m_transits.size()) continue;
-        int endIdx = qMin(ta.endIndex >= 0 ? ta.endIndex : ta.startIndex, m_transits.size() - 1);
-        const Radix& trStart = m_transits.at(ta.startIndex);
-        const Radix& trEnd   = m_transits.at(endIdx);
-        
-        // Transit-Planet mit Retrograde-Symbol
-        QString transitPlanetSym = astroFont().planetSymbol(ta.transitPlanet);
-        bool isRetro = (trStart.planetTyp.size() > ta.transitPlanet) && 
-                       (trStart.planetTyp[ta.transitPlanet] & P_TYP_RUCK);
-        if (isRetro) {
-            transitPlanetSym += QString::fromUtf8("℞");  // Retrograde-Symbol
-        }
-        QString transitPlanet = planetSpan(transitPlanetSym);
-        
-        // Sternzeichen während der Periode sammeln (STRICT LEGACY: alle durchlaufenen Zeichen)
-        QString transitZeichenRaw;
-        int8_t lastStz = -1;
-        for (int i = ta.startIndex; i <= endIdx && i < m_transits.size(); ++i) {
-            const Radix& tr = m_transits.at(i);
-            if (tr.stzPlanet.size() > ta.transitPlanet) {
-                int8_t stz = tr.stzPlanet[ta.transitPlanet];
-                if (stz != lastStz && stz >= 0 && stz < 12) {
-                    transitZeichenRaw += astroFont().sternzeichenSymbol(stz);
-                    lastStz = stz;
-                }
-            }
-        }
-        if (transitZeichenRaw.isEmpty()) {
-            transitZeichenRaw = "?";
-        }
-        QString transitZeichen = zodiacSpan(transitZeichenRaw);
-        
-        // Aspekt-Symbol
-        QString aspekt = aspektSpan(astroFont().aspektSymbol(aspektToIndex(ta.aspekt)));
-        
-        // Radix-Planet oder Haus
-        QString radixObj;
-        QString radixZeichenRaw;
-        if (ta.isHaus) {
-            // Haus (STRICT LEGACY: ⌂1 - ⌂12)
-            radixObj = QString::fromUtf8("⌂%1").arg(ta.radixPlanet + 1);
-            // Sternzeichen des Hauses
-            if (m_basisRadix.stzHaus.size() > ta.radixPlanet) {
-                int8_t stz = m_basisRadix.stzHaus[ta.radixPlanet];
-                if (stz >= 0 && stz < 12) {
-                    radixZeichenRaw = astroFont().sternzeichenSymbol(stz);
-                }
-            }
-        } else {
-            // Planet
-            QString radixPlanetSym = astroFont().planetSymbol(ta.radixPlanet);
-            // Retrograde-Symbol für Radix-Planet
-            if (m_basisRadix.planetTyp.size() > ta.radixPlanet &&
-                (m_basisRadix.planetTyp[ta.radixPlanet] & P_TYP_RUCK)) {
-                radixPlanetSym += QString::fromUtf8("℞");
-            }
-            radixObj = planetSpan(radixPlanetSym);
-            // Sternzeichen des Radix-Planeten
-            if (m_basisRadix.stzPlanet.size() > ta.radixPlanet) {
-                int8_t stz = m_basisRadix.stzPlanet[ta.radixPlanet];
-                if (stz >= 0 && stz < 12) {
-                    radixZeichenRaw = astroFont().sternzeichenSymbol(stz);
-                }
-            }
-        }
-        if (radixZeichenRaw.isEmpty()) {
-            radixZeichenRaw = "?";
-        }
-        QString radixZeichen = zodiacSpan(radixZeichenRaw);
-        
-        // Datum von/bis
-        QString vonDatum = QString("%1.%2.%3")
-            .arg(trStart.rFix.tag, 2, 10, QChar('0'))
-            .arg(trStart.rFix.monat, 2, 10, QChar('0'))
-            .arg(trStart.rFix.jahr, 4, 10, QChar('0'));
-        
-        QString bisDatum;
-        if (endIdx >= 0 && endIdx < m_transits.size()) {
-            bisDatum = QString("%1.%2.%3")
-                .arg(trEnd.rFix.tag, 2, 10, QChar('0'))
-                .arg(trEnd.rFix.monat, 2, 10, QChar('0'))
-                .arg(trEnd.rFix.jahr, 4, 10, QChar('0'));
-        } else {
-            bisDatum = tr("N/A");
-        }
-        
-        // STRICT LEGACY Format: [Planet][℞] in [Zeichen] [Aspekt] [Radix] in [Zeichen] von [Datum] bis [Datum]
-        QString html = QString("%1 in %2 %3 %4 in %5 von %6 bis %7")
-            .arg(transitPlanet, transitZeichen, aspekt, radixObj, radixZeichen, vonDatum, bisDatum);
-        
-        QListWidgetItem* item = new QListWidgetItem(html);
-        m_listBox->addItem(item);
-    }
-    
-    if (m_listBox->count() == 0 && !m_transits.isEmpty()) {
-        const Radix& tr = m_transits.first();
-        QString date = QString("%1.%2.%3")
-            .arg(tr.rFix.tag, 2, 10, QChar('0'))
-            .arg(tr.rFix.monat, 2, 10, QChar('0'))
-            .arg(tr.rFix.jahr, 4, 10, QChar('0'));
-        QString time = QString("%1:%2")
-            .arg(static_cast<int>(tr.rFix.zeit), 2, 10, QChar('0'))
-            .arg(static_cast<int>(std::round((tr.rFix.zeit - static_cast<int>(tr.rFix.zeit)) * 60.0)), 2, 10, QChar('0'));
-        QString text = QString("%1 %2 - Keine Aspekte gefunden").arg(date, time);
-        QListWidgetItem* item = new QListWidgetItem(text);
-        m_listBox->addItem(item);
-    }
-}
-
 void TransitResultWindow::onGrafikClicked() {
     // STRICT LEGACY: PB_UT_GRAF -> RadixCopy + PaintRadixWnd
-    QListWidgetItem* item = m_listBox->currentItem();
-    int row = item ? m_listBox->row(item) : 0;
+    const QModelIndex index = m_listBox->currentIndex();
+    const TransitAspekt* ta = m_model->aspekt(index.isValid() ? index.row() : 0);
     
-    if (row >= 0 && row < m_aspekte.size()) {
-        emit requestGraphic(m_aspekte.at(row).startIndex);
-    } else if (!m_transits.isEmpty()) {
+    if (ta) {
+        emit requestGraphic(ta->startIndex);
+    } else if (!m_model->transits().isEmpty()) {
         emit requestGraphic(0);
     }
 }
 
+bool TransitResultWindow::zeitraum(double& startJD, double& endJD, double& zone) const {
+    const QVector<Radix>& transits = m_model->transits();
+    if (transits.size() < 2) {
+        return false;
+    }
+    startJD = transits.first().jd;
+    endJD = transits.last().jd;
+    zone = transits.first().rFix.zone + transits.first().rFix.sommerzeit;
+    return true;
+}
+
 void TransitResultWindow::onRuecklaufClicked() {
     // STRICT LEGACY: PB_UT_RUCK -> sRucklauf
-    QListWidgetItem* item = m_listBox->currentItem();
-    if (!item) {
-        QMessageBox::information(this, tr("Rückläufigkeit"), 
-            tr("Bitte einen Eintrag auswählen."));
+    // Legacy: ein Dialog je Periode des gewählten Planeten; hier alle Körper
+    // aus den Stationen, in einer Tabelle
+    double startJD = 0.0;
+    double endJD = 0.0;
+    double zone = 0.0;
+    if (!zeitraum(startJD, endJD, zone)) {
         return;
     }
-    
-    int row = m_listBox->row(item);
-    if (row < 0 || row >= m_aspekte.size()) return;
-    
-    int planet = m_aspekte.at(row).transitPlanet;
-    
-    // Rückläufigkeits-Perioden suchen
-    if (m_transits.isEmpty()) return;
-    
-    QString vonDatum = tr("N/A");
-    QString bisDatum = tr("N/A");
-    bool inRetrograde = false;
-    bool foundAny = false;
-    
-    for (int i = 0; i < m_transits.size(); ++i) {
-        const Radix& tr = m_transits.at(i);
-        bool isRetro = (tr.planetTyp.size() > planet) && 
-                       (tr.planetTyp[planet] & P_TYP_RUCK) != 0;
-        
-        if (isRetro && !inRetrograde) {
-            vonDatum = QString("%1.%2.%3")
-                .arg(tr.rFix.tag, 2, 10, QChar('0'))
-                .arg(tr.rFix.monat, 2, 10, QChar('0'))
-                .arg(tr.rFix.jahr, 4, 10, QChar('0'));
-            inRetrograde = true;
-        } else if (!isRetro && inRetrograde) {
-            bisDatum = QString("%1.%2.%3")
-                .arg(tr.rFix.tag, 2, 10, QChar('0'))
-                .arg(tr.rFix.monat, 2, 10, QChar('0'))
-                .arg(tr.rFix.jahr, 4, 10, QChar('0'));
-            
-            RetrogradeDialog dlg(this);
-            dlg.setDaten(vonDatum, bisDatum);
-            dlg.exec();
-            
-            foundAny = true;
-            vonDatum = QObject::tr("N/A");
-            bisDatum = QObject::tr("N/A");
-            inRetrograde = false;
+
+    const bool neuBerechnet = !m_ruecklaufBerechnet;
+    if (neuBerechnet) {
+        QApplication::setOverrideCursor(Qt::WaitCursor);
+        const int res = Ruecklauf::calculate(m_basisRadix, startJD, endJD, m_ruecklauf);
+        QApplication::restoreOverrideCursor();
+        if (res < 0) {
+            QMessageBox::warning(this, tr("Rückläufigkeit"), tr("Fehler bei der Berechnung der Ephemeriden."));
+            return;
         }
+        m_ruecklaufBerechnet = true;
     }
-    
-    if (inRetrograde) {
-        RetrogradeDialog dlg(this);
-        dlg.setDaten(vonDatum, bisDatum);
-        dlg.exec();
-        foundAny = true;
-    }
-    
-    if (!foundAny) {
+
+    if (m_ruecklauf.isEmpty()) {
         QMessageBox::information(this, tr("Rückläufigkeit"),
-            tr("Keine Rückläufigkeit für %1 im gewählten Zeitraum gefunden.")
-                .arg(astroFont().planetSymbol(planet)));
+            tr("Keine Rückläufigkeit im gewählten Zeitraum gefunden."));
+        return;
+    }
+
+    // Ein offener Dialog aus einem früheren Lauf bekommt die neuen Perioden
+    if (!m_ruecklaufDialog) {
+        m_ruecklaufDialog = new RetrogradeDialog(this);
+        m_ruecklaufDialog->setPerioden(m_ruecklauf, zone);
+    } else if (neuBerechnet) {
+        m_ruecklaufDialog->setPerioden(m_ruecklauf, zone);
+    }
+
+    // Gewählter Eintrag: dessen Transit-Planet markieren
+    const QModelIndex index = m_listBox->currentIndex();
+    if (const TransitAspekt* ta = index.isValid() ? m_model->aspekt(index.row()) : nullptr) {
+        m_ruecklaufDialog->zeigePlanet(ta->transitPlanet);
     }
+    m_ruecklaufDialog->show();
+    m_ruecklaufDialog->raise();
+    m_ruecklaufDialog->activateWindow();
 }
 
-void TransitResultWindow::onListItemDoubleClicked(QListWidgetItem* item) {
+void TransitResultWindow::onTabelleClicked() {
+    double startJD = 0.0;
+    double endJD = 0.0;
+    double zone = 0.0;
+    if (!zeitraum(startJD, endJD, zone)) {
+        return;
+    }
+
+    // Auswahlmatrix wie setTransits (Spalten: Radix-Planeten, dann Häuser)
+    const int radixPlanets = m_basisRadix.planet.size();
+    auto gewaehlt = [&](const TransitEvent& ev) {
+        if (m_transSel.isEmpty()) {
+            return true;
+        }
+        const int rIdx = ev.art == EV_ASPEKT_HAUS ? radixPlanets + ev.ziel : ev.ziel;
+        return ev.planet < m_transSel.size() && rIdx < m_transSel[ev.planet].size()
+            && m_transSel[ev.planet][rIdx];
+    };
+
+    TransitTable table;
+    QApplication::setOverrideCursor(Qt::WaitCursor);
+    const int res = TransitEvents::calculate(
+        m_basisRadix, startJD, endJD, EV_ASPEKT_RADIX | EV_ASPEKT_HAUS | EV_OFFEN,
+        [&](const TransitEvent& ev) {
+            if (gewaehlt(ev)) {
+                table.add(ev, startJD);
+            }
+        },
+        m_auinit.orbenTPlanet, m_auinit.orbenTHaus);
+    table.finish(endJD);
+    QApplication::restoreOverrideCursor();
+
+    if (res < 0) {
+        QMessageBox::warning(this, tr("Transite"), tr("Fehler bei der Berechnung der Ephemeriden."));
+        return;
+    }
+
+    auto* window = new TransitTableWindow(this, std::move(table), zone,
+                                          tr("Perioden - %1").arg(getTabTitle()));
+    window->show();
+}
+
+void TransitResultWindow::onListDoubleClicked(const QModelIndex& index) {
     // STRICT LEGACY: Doppelklick -> Grafik anzeigen
-    if (!item) return;
-    
-    int row = m_listBox->row(item);
-    if (row >= 0 && row < m_aspekte.size()) {
-        emit requestGraphic(m_aspekte.at(row).startIndex);
+    if (const TransitAspekt* ta = m_model->aspekt(index.row())) {
+        emit requestGraphic(ta->startIndex);
     }
 }
 
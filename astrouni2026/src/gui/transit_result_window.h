@@ -6,22 +6,30 @@
  * 1:1 Port von WndTransit/TRANSITCLASS aus legacy/astrouni.c
  * 
  * Zeigt Multi-Transit-Ergebnisse mit:
- * - Listbox für Aspekt-Sequenzen (hWndLBG)
+ * - Listbox für Aspekt-Sequenzen (hWndLBG), als Modell/Ansicht: nur
+ *   sichtbare Zeilen werden formatiert und gezeichnet
  * - "Grafik"-Button (PB_UT_GRAF)
- * - "Rückl."-Button (PB_UT_RUCK)
+ * - "Rückl."-Button (PB_UT_RUCK): Rückläufigkeit aller Körper, einmal je Lauf
+ * - "Tabelle"-Button: Perioden mit Beginn/Exakt/Ende als sortierbare Tabelle
  * - Datum-Anzeige "Transite von [Datum] bis [Datum]"
  */
 
 #include <QWidget>
-#include <QListWidget>
+#include <QListView>
+#include <QPointer>
 #include <QLabel>
 #include <QPushButton>
 #include <QVector>
 #include "../core/data_types.h"
 #include "../core/transit_calc.h"
+#include "../core/transit_table.h"
+#include "../core/sign_timeline.h"
 
 namespace astro {
 
+class TransitResultModel;
+class RetrogradeDialog;
+
 class TransitResultWindow : public QWidget {
     Q_OBJECT
     
@@ -35,7 +43,8 @@ public:
     void setTransits(const QVector<Radix>& transits, 
                      const QVector<TransitAspekt>& aspekte,
                      const QString& vonDatum, const QString& bisDatum,
-                     const QVector<QVector<bool>>& transSel = {});
+                     const QVector<QVector<bool>>& transSel = {},
+                     const SignTimeline& zeichen = SignTimeline());
     void setTransitSelection(const QVector<QVector<bool>>& transSel) { m_transSel = transSel; }
     
     /**
@@ -49,23 +58,27 @@ signals:
 private slots:
     void onGrafikClicked();
     void onRuecklaufClicked();
-    void onListItemDoubleClicked(QListWidgetItem* item);
+    void onTabelleClicked();
+    void onListDoubleClicked(const QModelIndex& index);
     
 private:
     void setupUI();
-    void buildTransitTexts();
+    bool zeitraum(double& startJD, double& endJD, double& zone) const;
     
     // Referenzen
     AuInit& m_auinit;
     const Radix& m_basisRadix;
-    QVector<Radix> m_transits;
-    QVector<TransitAspekt> m_aspekte;
     QVector<QVector<bool>> m_transSel; // Auswahlmatrix Transit x Radix/Haus
+    QVector<RuecklaufPeriode> m_ruecklauf;  // Rückläufigkeit aller Körper (einmal je Lauf)
+    bool m_ruecklaufBerechnet = false;
+    QPointer<RetrogradeDialog> m_ruecklaufDialog;
     
     // UI-Elemente (Port von WndTransit)
-    QListWidget* m_listBox;        // hWndLBG
+    TransitResultModel* m_model;   // Aspekt-Sequenzen und Transits
+    QListView* m_listBox;          // hWndLBG
     QPushButton* m_grafikButton;   // PB_UT_GRAF
     QPushButton* m_ruecklaufButton; // PB_UT_RUCK
+    QPushButton* m_tabelleButton;
     QLabel* m_vonDatumLabel;       // TXT_UT_DATUM
     QLabel* m_bisDatumLabel;       // TXT_UT_BDATUM
 };
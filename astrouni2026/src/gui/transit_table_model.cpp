@@ -0,0 +1,283 @@
+/**
+ * @file transit_table_model.cpp
+ * @brief Implementierung von Transit-Perioden-Modell und Proxy
+ */
+
+#include "transit_table_model.h"
+#include "../core/constants.h"
+#include "../core/calendar.h"
+#include "../core/astro_font_provider.h"
+#include <limits>
+#include <utility>
+
+namespace astro {
+
+//==============================================================================
+// TransitTableModel
+//==============================================================================
+
+TransitTableModel::TransitTableModel(QObject* parent)
+    : QAbstractTableModel(parent) {
+}
+
+void TransitTableModel::setTable(TransitTable table, double zone) {
+    beginResetModel();
+    m_table = std::move(table);
+    m_zone = zone;
+    endResetModel();
+}
+
+int TransitTableModel::rowCount(const QModelIndex& parent) const {
+    return parent.isValid() ? 0 : m_table.size();
+}
+
+int TransitTableModel::columnCount(const QModelIndex& parent) const {
+    return parent.isValid() ? 0 : SPALTEN;
+}
+
+QString TransitTableModel::datumText(double jd) const {
+    const CalDateTime dt = Calendar::fromJD(Calendar::utToLocal(jd, m_zone));
+    return QString("%1.%2.%3 %4:%5")
+        .arg(dt.tag, 2, 10, QChar('0'))
+        .arg(dt.monat, 2, 10, QChar('0'))
+        .arg(dt.jahr, 4, 10, QChar('0'))
+        .arg(dt.stunde, 2, 10, QChar('0'))
+        .arg(dt.minute, 2, 10, QChar('0'));
+}
+
+QString TransitTableModel::zielText(int row) const {
+    const int ziel = m_table.ziel[row];
+    if (m_table.art[row] == EV_ASPEKT_HAUS) {
+        // STRICT LEGACY: ⌂1 - ⌂12
+        return QString::fromUtf8("⌂%1").arg(ziel + 1);
+    }
+    return astroFont().planetSymbol(ziel);
+}
+
+QVariant TransitTableModel::data(const QModelIndex& index, int role) const {
+    if (!index.isValid() || index.row() >= m_table.size()) {
+        return QVariant();
+    }
+    const int row = index.row();
+    const uint8_t flags = m_table.flags[row];
+
+    switch (role) {
+        case Qt::DisplayRole:
+            switch (index.column()) {
+                case SP_PLANET: return astroFont().planetSymbol(m_table.planet[row]);
+                case SP_ZIEL:   return zielText(row);
+                case SP_ASPEKT: return astroFont().aspektSymbol(m_table.aspekt[row] / 30);
+                case SP_BEGINN:
+                    return (flags & TT_OFFEN_BEGINN) ? QString("< ") + datumText(m_table.beginn[row])
+                                                     : datumText(m_table.beginn[row]);
+                case SP_EXAKT:
+                    return m_table.exakt[row] != 0.0 ? datumText(m_table.exakt[row]) : QString("-");
+                case SP_ENDE:
+                    return (flags & TT_OFFEN_ENDE) ? datumText(m_table.ende[row]) + QString(" >")
+                                                   : datumText(m_table.ende[row]);
+                case SP_RUECK:
+                    return (flags & TT_RUECK) ? QString::fromUtf8("℞") : QString();
+                case SP_ORB:
+                    return QString::number(m_table.orb[row], 'f', 1);
+                default:
+                    return QVariant();
+            }
+        case Qt::FontRole:
+            switch (index.column()) {
+                case SP_PLANET: return astroFont().getPlanetSymbolFont(12);
+                case SP_ZIEL:
+                    return m_table.art[row] == EV_ASPEKT_HAUS ? QVariant()
+                                                              : QVariant(astroFont().getPlanetSymbolFont(12));
+                case SP_ASPEKT: return astroFont().getAspektSymbolFont(12);
+                default:        return QVariant();
+            }
+        case Qt::TextAlignmentRole:
+            if (index.column() == SP_ORB) {
+                return int(Qt::AlignRight | Qt::AlignVCenter);
+            }
+            return int(Qt::AlignCenter);
+        case Qt::ToolTipRole:
+            if (index.column() == SP_EXAKT && (flags & TT_MEHRFACH)) {
+                return tr("Mehrfach exakt (Rückläufigkeit)");
+            }
+            if (index.column() == SP_BEGINN && (flags & TT_OFFEN_BEGINN)) {
+                return tr("Am Anfang des Zeitraums schon im Orbis");
+            }
+            if (index.column() == SP_ENDE && (flags & TT_OFFEN_ENDE)) {
+                return tr("Am Ende des Zeitraums noch im Orbis");
+            }
+            return QVariant();
+        default:
+            return QVariant();
+    }
+}
+
+QVariant TransitTableModel::headerData(int section, Qt::Orientation orientation, int role) const {
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole) {
+        return QAbstractTableModel::headerData(section, orientation, role);
+    }
+    switch (section) {
+        case SP_PLANET: return tr("Transit");
+        case SP_ZIEL:   return tr("Ziel");
+        case SP_ASPEKT: return tr("Aspekt");
+        case SP_BEGINN: return tr("Beginn");
+        case SP_EXAKT:  return tr("Exakt");
+        case SP_ENDE:   return tr("Ende");
+        case SP_RUECK:  return tr("Rückl.");
+        case SP_ORB:    return tr("Orbis");
+        default:        return QVariant();
+    }
+}
+
+//==============================================================================
+// TransitTableProxy
+//==============================================================================
+
+TransitTableProxy::TransitTableProxy(QObject* parent)
+    : QSortFilterProxyModel(parent) {
+}
+
+void TransitTableProxy::setSourceModel(QAbstractItemModel* sourceModel) {
+    auto* model = qobject_cast<TransitTableModel*>(sourceModel);
+    m_table = model ? &model->table() : nullptr;
+    m_schluessel.clear();
+    QSortFilterProxyModel::setSourceModel(sourceModel);
+}
+
+void TransitTableProxy::sort(int column, Qt::SortOrder order) {
+    if (column >= 0) {
+        for (int i = 0; i < m_schluessel.size(); ++i) {
+            if (m_schluessel[i].column == column) {
+                m_schluessel.remove(i);
+                break;
+            }
+        }
+        m_schluessel.prepend({ column, order });
+        if (m_schluessel.size() > MAX_SCHLUESSEL) {
+            m_schluessel.resize(MAX_SCHLUESSEL);
+        }
+    } else {
+        m_schluessel.clear();
+    }
+    QSortFilterProxyModel::sort(column, order);
+}
+
+void TransitTableProxy::setZeitraum(double vonJD, double bisJD) {
+    if (m_vonJD == vonJD && m_bisJD == bisJD) {
+        return;
+    }
+    m_vonJD = vonJD;
+    m_bisJD = bisJD;
+    invalidateFilter();
+}
+
+void TransitTableProxy::setPlaneten(quint32 maske) {
+    if (m_planeten == maske) {
+        return;
+    }
+    m_planeten = maske;
+    invalidateFilter();
+}
+
+void TransitTableProxy::setAspekte(quint32 maske) {
+    if (m_aspekte == maske) {
+        return;
+    }
+    m_aspekte = maske;
+    invalidateFilter();
+}
+
+void TransitTableProxy::setZielArten(int arten) {
+    if (m_zielArten == arten) {
+        return;
+    }
+    m_zielArten = arten;
+    invalidateFilter();
+}
+
+void TransitTableProxy::setNurRueck(bool nurRueck) {
+    if (m_nurRueck == nurRueck) {
+        return;
+    }
+    m_nurRueck = nurRueck;
+    invalidateFilter();
+}
+
+bool TransitTableProxy::filterAcceptsRow(int sourceRow, const QModelIndex& sourceParent) const {
+    if (!m_table || sourceParent.isValid()) {
+        return QSortFilterProxyModel::filterAcceptsRow(sourceRow, sourceParent);
+    }
+    const TransitTable& t = *m_table;
+    if (m_vonJD > 0.0 && t.ende[sourceRow] < m_vonJD) {
+        return false;
+    }
+    if (m_bisJD > 0.0 && t.beginn[sourceRow] > m_bisJD) {
+        return false;
+    }
+    if (m_planeten && !(m_planeten & (1u << t.planet[sourceRow]))) {
+        return false;
+    }
+    if (m_aspekte && !(m_aspekte & (1u << (t.aspekt[sourceRow] / 30)))) {
+        return false;
+    }
+    if (m_zielArten && !(m_zielArten & t.art[sourceRow])) {
+        return false;
+    }
+    if (m_nurRueck && !(t.flags[sourceRow] & TT_RUECK)) {
+        return false;
+    }
+    return true;
+}
+
+int TransitTableProxy::vergleiche(int column, int links, int rechts) const {
+    const TransitTable& t = *m_table;
+    auto cmp = [](auto a, auto b) { return a < b ? -1 : (b < a ? 1 : 0); };
+    switch (column) {
+        case TransitTableModel::SP_PLANET: return cmp(t.planet[links], t.planet[rechts]);
+        case TransitTableModel::SP_ZIEL: {
+            // Planeten vor Häusern vor Transit-Körpern
+            const int a = cmp(t.art[links], t.art[rechts]);
+            return a != 0 ? a : cmp(t.ziel[links], t.ziel[rechts]);
+        }
+        case TransitTableModel::SP_ASPEKT: return cmp(t.aspekt[links], t.aspekt[rechts]);
+        case TransitTableModel::SP_BEGINN: return cmp(t.beginn[links], t.beginn[rechts]);
+        case TransitTableModel::SP_EXAKT: {
+            // Ohne Exaktheit ans Ende
+            constexpr double OHNE = std::numeric_limits<double>::max();
+            const double a = t.exakt[links] != 0.0 ? t.exakt[links] : OHNE;
+            const double b = t.exakt[rechts] != 0.0 ? t.exakt[rechts] : OHNE;
+            return cmp(a, b);
+        }
+        case TransitTableModel::SP_ENDE:   return cmp(t.ende[links], t.ende[rechts]);
+        case TransitTableModel::SP_RUECK:
+            return cmp(t.flags[links] & TT_RUECK, t.flags[rechts] & TT_RUECK);
+        case TransitTableModel::SP_ORB:    return cmp(t.orb[links], t.orb[rechts]);
+        default:                           return 0;
+    }
+}
+
+bool TransitTableProxy::lessThan(const QModelIndex& left, const QModelIndex& right) const {
+    if (!m_table || m_schluessel.isEmpty()) {
+        return QSortFilterProxyModel::lessThan(left, right);
+    }
+    const int links = left.row();
+    const int rechts = right.row();
+
+    // Die Richtung der ersten Spalte setzt QSortFilterProxyModel selbst um;
+    // weitere Spalten mit anderer Richtung werden hier umgedreht
+    const Qt::SortOrder richtung = m_schluessel.first().order;
+    for (const Schluessel& s : m_schluessel) {
+        int c = vergleiche(s.column, links, rechts);
+        if (c != 0) {
+            if (s.order != richtung) {
+                c = -c;
+            }
+            return c < 0;
+        }
+    }
+    // Gleichstand: nach Beginn, dann Tabellen-Reihenfolge
+    const int c = vergleiche(TransitTableModel::SP_BEGINN, links, rechts);
+    return c != 0 ? c < 0 : links < rechts;
+}
+
+} // namespace astro
@@ -0,0 +1,121 @@
+#pragma once
+/**
+ * @file transit_table_model.h
+ * @brief Tabellen-Modell und Sortier-/Filter-Proxy für Transit-Perioden
+ *
+ * Das Modell zeigt eine TransitTable (eine Zeile je Periode im Orbis).
+ * Der Proxy sortiert und filtert direkt auf den Zahlen-Spalten der
+ * Tabelle - Texte werden nur für die sichtbaren Zellen erzeugt.
+ */
+
+#include <QAbstractTableModel>
+#include <QSortFilterProxyModel>
+#include <QVector>
+#include "../core/transit_table.h"
+
+namespace astro {
+
+class TransitTableModel : public QAbstractTableModel {
+    Q_OBJECT
+
+public:
+    enum Spalte {
+        SP_PLANET = 0,  // Transit-Körper
+        SP_ZIEL,        // Radix-Planet, Haus oder Transit-Körper
+        SP_ASPEKT,
+        SP_BEGINN,
+        SP_EXAKT,
+        SP_ENDE,
+        SP_RUECK,       // Rückläufig während der Periode
+        SP_ORB,         // Orbis des Aspekts
+        SPALTEN
+    };
+
+    explicit TransitTableModel(QObject* parent = nullptr);
+
+    /**
+     * @brief Übernimmt die Perioden
+     * @param zone Zonen-Offset für die Anzeige in Ortszeit (wie rFix.zone)
+     */
+    void setTable(TransitTable table, double zone);
+    const TransitTable& table() const { return m_table; }
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+
+private:
+    QString datumText(double jd) const;
+    QString zielText(int row) const;
+
+    TransitTable m_table;
+    double m_zone = 0.0;
+};
+
+/**
+ * @brief Sortierung nach bis zu drei Spalten und Filter auf Zeitraum,
+ *        Körper, Aspekt und Ziel-Art
+ *
+ * sort() merkt sich die zuletzt gewählten Spalten: ein Klick auf eine
+ * zweite Spalte sortiert nach ihr, bei Gleichheit nach der vorherigen.
+ * Die Filter-Setter filtern nur bei geändertem Wert neu.
+ */
+class TransitTableProxy : public QSortFilterProxyModel {
+    Q_OBJECT
+
+public:
+    static constexpr int MAX_SCHLUESSEL = 3;
+
+    explicit TransitTableProxy(QObject* parent = nullptr);
+
+    void setSourceModel(QAbstractItemModel* sourceModel) override;
+    void sort(int column, Qt::SortOrder order = Qt::AscendingOrder) override;
+
+    /**
+     * @brief Nur Perioden, die den Zeitraum berühren (JD UT, 0 = offen)
+     */
+    void setZeitraum(double vonJD, double bisJD);
+
+    /**
+     * @brief Transit-Körper als Bitmaske (Bit = Planet), 0 = alle
+     */
+    void setPlaneten(quint32 maske);
+
+    /**
+     * @brief Aspekte als Bitmaske (Bit = Winkel / 30), 0 = alle
+     */
+    void setAspekte(quint32 maske);
+
+    /**
+     * @brief Ziel-Arten (EV_ASPEKT_*), 0 = alle
+     */
+    void setZielArten(int arten);
+
+    void setNurRueck(bool nurRueck);
+
+protected:
+    bool filterAcceptsRow(int sourceRow, const QModelIndex& sourceParent) const override;
+    bool lessThan(const QModelIndex& left, const QModelIndex& right) const override;
+
+private:
+    int vergleiche(int column, int links, int rechts) const;
+
+    struct Schluessel {
+        int column;
+        Qt::SortOrder order;
+    };
+
+    const TransitTable* m_table = nullptr;
+    QVector<Schluessel> m_schluessel;   // [0] = zuletzt gewählte Spalte
+
+    double m_vonJD = 0.0;
+    double m_bisJD = 0.0;
+    quint32 m_planeten = 0;
+    quint32 m_aspekte = 0;
+    int m_zielArten = 0;
+    bool m_nurRueck = false;
+};
+
+} // namespace astro
@@ -0,0 +1,174 @@
+/**
+ * @file transit_table_window.cpp
+ * @brief Implementierung des Transit-Perioden-Fensters
+ */
+
+#include "transit_table_window.h"
+#include "transit_table_model.h"
+#include "../core/constants.h"
+#include "../core/calendar.h"
+#include "../core/astro_font_provider.h"
+
+#include <QCheckBox>
+#include <QComboBox>
+#include <QDateEdit>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QLabel>
+#include <QTableView>
+#include <QVBoxLayout>
+#include <algorithm>
+#include <utility>
+
+namespace astro {
+
+namespace {
+
+QDate lokalesDatum(double jd, double zone) {
+    const CalDateTime dt = Calendar::fromJD(Calendar::utToLocal(jd, zone));
+    return QDate(dt.jahr, dt.monat, dt.tag);
+}
+
+// Tagesanfang bzw. -ende in Ortszeit als JD (UT)
+double tagJD(const QDate& datum, double stunde, double zone) {
+    return Calendar::localToUT(Calendar::toJD(datum.year(), datum.month(), datum.day(), stunde), zone);
+}
+
+} // namespace
+
+TransitTableWindow::TransitTableWindow(QWidget* parent, TransitTable table, double zone,
+                                       const QString& titel)
+    : QWidget(parent, Qt::Window)
+    , m_zone(zone) {
+    setAttribute(Qt::WA_DeleteOnClose);
+    setWindowTitle(titel);
+    resize(760, 520);
+
+    int anzahlPlaneten = 0;
+    double vonJD = 0.0;
+    double bisJD = 0.0;
+    if (table.size() > 0) {
+        anzahlPlaneten = *std::max_element(table.planet.cbegin(), table.planet.cend()) + 1;
+        vonJD = *std::min_element(table.beginn.cbegin(), table.beginn.cend());
+        bisJD = *std::max_element(table.ende.cbegin(), table.ende.cend());
+    }
+
+    m_model = new TransitTableModel(this);
+    m_model->setTable(std::move(table), zone);
+    m_proxy = new TransitTableProxy(this);
+    m_proxy->setSourceModel(m_model);
+
+    setupUI(anzahlPlaneten);
+
+    if (vonJD > 0.0) {
+        const QDate von = lokalesDatum(vonJD, zone);
+        const QDate bis = lokalesDatum(bisJD, zone);
+        for (QDateEdit* edit : { m_vonEdit, m_bisEdit }) {
+            edit->setDateRange(von, bis);
+        }
+        m_vonEdit->setDate(von);
+        m_bisEdit->setDate(bis);
+    }
+    onFilterChanged();
+}
+
+void TransitTableWindow::setupUI(int anzahlPlaneten) {
+    auto* mainLayout = new QVBoxLayout(this);
+    mainLayout->setContentsMargins(8, 8, 8, 8);
+
+    // Filter-Leiste
+    auto* filterLayout = new QHBoxLayout();
+
+    filterLayout->addWidget(new QLabel(tr("Von"), this));
+    m_vonEdit = new QDateEdit(this);
+    m_vonEdit->setCalendarPopup(true);
+    m_vonEdit->setDisplayFormat("dd.MM.yyyy");
+    filterLayout->addWidget(m_vonEdit);
+
+    filterLayout->addWidget(new QLabel(tr("bis"), this));
+    m_bisEdit = new QDateEdit(this);
+    m_bisEdit->setCalendarPopup(true);
+    m_bisEdit->setDisplayFormat("dd.MM.yyyy");
+    filterLayout->addWidget(m_bisEdit);
+
+    const QFont planetFont = astroFont().getPlanetSymbolFont(12);
+    m_planetCombo = new QComboBox(this);
+    m_planetCombo->addItem(tr("Alle"), 0u);
+    for (int p = 0; p < anzahlPlaneten; ++p) {
+        m_planetCombo->addItem(astroFont().planetSymbol(p), 1u << p);
+        m_planetCombo->setItemData(m_planetCombo->count() - 1, planetFont, Qt::FontRole);
+    }
+    filterLayout->addWidget(m_planetCombo);
+
+    const QFont aspektFont = astroFont().getAspektSymbolFont(12);
+    m_aspektCombo = new QComboBox(this);
+    m_aspektCombo->addItem(tr("Alle"), 0u);
+    for (int a = 0; a < ASPEKTE; ++a) {
+        m_aspektCombo->addItem(astroFont().aspektSymbol(a), 1u << a);
+        m_aspektCombo->setItemData(m_aspektCombo->count() - 1, aspektFont, Qt::FontRole);
+    }
+    filterLayout->addWidget(m_aspektCombo);
+
+    m_zielCombo = new QComboBox(this);
+    m_zielCombo->addItem(tr("Alle"), 0);
+    m_zielCombo->addItem(tr("Planeten"), EV_ASPEKT_RADIX);
+    m_zielCombo->addItem(tr("Häuser"), EV_ASPEKT_HAUS);
+    filterLayout->addWidget(m_zielCombo);
+
+    m_rueckCheck = new QCheckBox(tr("Nur rückläufig"), this);
+    filterLayout->addWidget(m_rueckCheck);
+
+    filterLayout->addStretch();
+    m_anzahlLabel = new QLabel(this);
+    filterLayout->addWidget(m_anzahlLabel);
+    mainLayout->addLayout(filterLayout);
+
+    connect(m_vonEdit, &QDateEdit::dateChanged, this, &TransitTableWindow::onFilterChanged);
+    connect(m_bisEdit, &QDateEdit::dateChanged, this, &TransitTableWindow::onFilterChanged);
+    for (QComboBox* combo : { m_planetCombo, m_aspektCombo, m_zielCombo }) {
+        connect(combo, &QComboBox::currentIndexChanged, this, &TransitTableWindow::onFilterChanged);
+    }
+    connect(m_rueckCheck, &QCheckBox::toggled, this, &TransitTableWindow::onFilterChanged);
+
+    // Tabelle: feste Zeilenhöhe, die Ansicht fragt nur sichtbare Zellen ab
+    m_view = new QTableView(this);
+    m_view->setModel(m_proxy);
+    m_view->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_view->setSelectionBehavior(QAbstractItemView::SelectRows);
+    m_view->verticalHeader()->setVisible(false);
+    m_view->verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+    m_view->horizontalHeader()->setSectionResizeMode(QHeaderView::Interactive);
+    m_view->horizontalHeader()->setStretchLastSection(true);
+    m_view->setSortingEnabled(true);
+    m_view->sortByColumn(TransitTableModel::SP_BEGINN, Qt::AscendingOrder);
+    for (int col : { TransitTableModel::SP_PLANET, TransitTableModel::SP_ZIEL,
+                     TransitTableModel::SP_ASPEKT, TransitTableModel::SP_RUECK }) {
+        m_view->setColumnWidth(col, 60);
+    }
+    for (int col : { TransitTableModel::SP_BEGINN, TransitTableModel::SP_EXAKT,
+                     TransitTableModel::SP_ENDE }) {
+        m_view->setColumnWidth(col, 130);
+    }
+    mainLayout->addWidget(m_view);
+}
+
+void TransitTableWindow::onFilterChanged() {
+    const QDate von = m_vonEdit->date();
+    const QDate bis = m_bisEdit->date();
+    if (von.isValid() && bis.isValid() && von <= bis) {
+        m_proxy->setZeitraum(tagJD(von, 0.0, m_zone), tagJD(bis, 24.0, m_zone));
+    } else {
+        m_proxy->setZeitraum(0.0, 0.0);
+    }
+    m_proxy->setPlaneten(m_planetCombo->currentData().toUInt());
+    m_proxy->setAspekte(m_aspektCombo->currentData().toUInt());
+    m_proxy->setZielArten(m_zielCombo->currentData().toInt());
+    m_proxy->setNurRueck(m_rueckCheck->isChecked());
+    updateAnzahl();
+}
+
+void TransitTableWindow::updateAnzahl() {
+    m_anzahlLabel->setText(tr("%1 von %2").arg(m_proxy->rowCount()).arg(m_model->rowCount()));
+}
+
+} // namespace astro
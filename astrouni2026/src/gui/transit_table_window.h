@@ -0,0 +1,57 @@
+#pragma once
+/**
+ * @file transit_table_window.h
+ * @brief Fenster mit der Tabelle der Transit-Perioden
+ *
+ * Nicht-modal neben dem Transit-Ergebnis: Spalten sortierbar (Klick auf
+ * den Kopf, bis zu drei Spalten nacheinander), Filter nach Zeitraum,
+ * Transit-Körper, Aspekt, Ziel-Art und Rückläufigkeit.
+ */
+
+#include <QWidget>
+#include "../core/transit_table.h"
+
+class QCheckBox;
+class QComboBox;
+class QDateEdit;
+class QLabel;
+class QTableView;
+
+namespace astro {
+
+class TransitTableModel;
+class TransitTableProxy;
+
+class TransitTableWindow : public QWidget {
+    Q_OBJECT
+
+public:
+    /**
+     * @param table Perioden (JD in UT)
+     * @param zone Zonen-Offset für die Anzeige in Ortszeit (wie rFix.zone)
+     */
+    TransitTableWindow(QWidget* parent, TransitTable table, double zone, const QString& titel);
+
+private slots:
+    void onFilterChanged();
+
+private:
+    void setupUI(int anzahlPlaneten);
+    void updateAnzahl();
+
+    double m_zone;
+
+    TransitTableModel* m_model;
+    TransitTableProxy* m_proxy;
+    QTableView* m_view;
+
+    QDateEdit* m_vonEdit;
+    QDateEdit* m_bisEdit;
+    QComboBox* m_planetCombo;
+    QComboBox* m_aspektCombo;
+    QComboBox* m_zielCombo;
+    QCheckBox* m_rueckCheck;
+    QLabel* m_anzahlLabel;
+};
+
+} // namespace astro
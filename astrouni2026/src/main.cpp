@@ -12,8 +12,10 @@
 
 #include "gui/main_window.h"
 #include "core/swiss_eph.h"
+#include "core/ephe_memory.h"
 #include "core/data_types.h"
 #include "core/astro_font_provider.h"
+#include "core/analysis_cache.h"
 #include "data/legacy_io.h"
 #include "data/orte_db.h"
 
@@ -45,8 +47,24 @@ int main(int argc, char *argv[]) {
         }
     }
     
+    // Single-File-Deployment: Ephemeriden aus den Qt-Ressourcen
+    bool epheEingebettet = false;
+#if ASTRO_EMBED_EPHE
+    if (astro::EpheMemory::isSupported()) {
+        epheEingebettet = astro::EpheMemory::addResources(":/ephe") > 0;
+    } else {
+        // Ohne fmemopen einmalig in den Cache entpacken
+        QString cachePath = astro::EpheMemory::extractResources(":/ephe",
+            QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/ephe");
+        if (!cachePath.isEmpty()) {
+            ephePath = cachePath;
+            epheEingebettet = true;
+        }
+    }
+#endif
+    
     // Prüfen ob Ephemeriden-Verzeichnis existiert
-    if (!QDir(ephePath).exists()) {
+    if (!epheEingebettet && !QDir(ephePath).exists()) {
         ephePath = QDir(appPath).filePath("../swisseph/ephe");
         if (!QDir(ephePath).exists()) {
             QMessageBox::warning(nullptr, "Warnung",
@@ -59,8 +77,24 @@ int main(int argc, char *argv[]) {
     // Swiss Ephemeris initialisieren
     astro::swissEph().setEphePath(ephePath);
     
-    // Astrologie-Font initialisieren (prüft ob AstroUniverse-Font verfügbar ist)
-    astro::astroFont();  // Singleton-Initialisierung mit Konsolenausgabe
+    // .se1 Dateien auf Wunsch in den Speicher holen (ASTRO_EPHE_MEMORY=map|preload, Vorgabe: off)
+    if (!epheEingebettet) {
+        astro::EpheMemory::addDirectory(ephePath, astro::EpheMemory::modusAusUmgebung());
+    }
+    
+    // Sobald die Fonts feststehen: Textanalysen mit vorläufigen Symbolen
+    // verwerfen und mit den endgültigen Symbolen neu zeichnen (vor dem Start
+    // verbinden, damit das Signal nicht verloren geht)
+    QObject::connect(&astro::astroFont(), &astro::AstroFontProvider::fontsChanged, &app, [] {
+        astro::analysisCache().clear();
+        for (QWidget* w : QApplication::allWidgets()) {
+            w->update();
+        }
+    });
+    
+    // Astrologie-Font im Hintergrund suchen, während das Fenster aufgebaut wird
+    // (bis dahin Unicode-Symbole; Ergebnis wird für den nächsten Start gemerkt)
+    astro::astroFont().startDetection();
     
     // Legacy I/O initialisieren
     astro::legacyIO().setDataPath(dataPath);
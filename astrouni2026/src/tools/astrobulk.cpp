@@ -0,0 +1,146 @@
+#include "bulk_chart.h"
+#include "chart_calc.h"
+#include "constants.h"
+#include "legacy_io.h"
+#include "person_db.h"
+#include "swiss_eph.h"
+#include "synastry_search.h"
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QTextStream>
+
+namespace {
+
+void printUsage(const QString& program) {
+    QTextStream err(stderr);
+    err << "Usage: " << program << " /path/to/data output.tsv"
+        << " [--haus N] [--threads N] [--ephe /path/to/ephe]"
+        << " [--synastrie INDEX] [--top N]\n"
+        << "  --haus       house system (default: from astroini.dat)\n"
+        << "  --threads    worker threads (default: all cores)\n"
+        << "  --ephe       Swiss Ephemeris directory\n"
+        << "  --synastrie  rank all persons by synastry with person INDEX\n"
+        << "  --top        length of the ranking (default: 20, 0 = all)\n";
+}
+
+QString findEphePath(const QString& appPath) {
+    const QStringList candidates = {
+        appPath + "/swisseph/ephe",
+        appPath + "/../swisseph/ephe",
+        appPath + "/../swisseph/src/ephe"
+    };
+    for (const QString& path : candidates) {
+        if (QDir(path).exists()) {
+            return path;
+        }
+    }
+    return QString();
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    QCoreApplication app(argc, argv);
+
+    const QStringList args = app.arguments();
+    if (args.size() < 3) {
+        printUsage(args.value(0));
+        return 2;
+    }
+
+    const QString dataPath = args.at(1);
+    const QString outPath = args.at(2);
+    int hausSys = -1;
+    int threads = 0;
+    int synastrie = -1;
+    int top = 20;
+    QString ephePath = findEphePath(QCoreApplication::applicationDirPath());
+
+    for (int i = 3; i < args.size(); ++i) {
+        const QString& arg = args.at(i);
+        if (arg == "--haus" && i + 1 < args.size()) {
+            hausSys = args.at(++i).toInt();
+        } else if (arg == "--threads" && i + 1 < args.size()) {
+            threads = args.at(++i).toInt();
+        } else if (arg == "--ephe" && i + 1 < args.size()) {
+            ephePath = args.at(++i);
+        } else if (arg == "--synastrie" && i + 1 < args.size()) {
+            synastrie = args.at(++i).toInt();
+        } else if (arg == "--top" && i + 1 < args.size()) {
+            top = args.at(++i).toInt();
+        } else {
+            printUsage(args.value(0));
+            return 2;
+        }
+    }
+
+    QTextStream out(stdout);
+    QTextStream err(stderr);
+
+    if (ephePath.isEmpty()) {
+        err << "Warning: no ephemeris directory found, using built-in fallback\n";
+    }
+    astro::swissEph().setEphePath(ephePath);
+
+    astro::legacyIO().setDataPath(dataPath);
+    astro::AuInit auinit;
+    astro::legacyIO().readIni(auinit, false);  // Datenverzeichnis nicht verändern
+    if (hausSys < 0) {
+        hausSys = auinit.sSelHaus;
+    }
+
+    if (astro::personDB().load(dataPath) < 0) {
+        err << "Cannot load person database: " << astro::personDB().getLastError() << "\n";
+        return 3;
+    }
+    const QVector<astro::RadixFix> personen = astro::personDB().getAll();
+
+    const astro::BulkChartResult result =
+        astro::BulkChart::calculate(personen, auinit, hausSys, threads);
+
+    if (astro::BulkChart::writeTable(outPath, personen, result) != astro::ERR_OK) {
+        err << "Cannot write file: " << outPath << "\n";
+        return 3;
+    }
+
+    out << result.rows.size() << " rows (" << result.fehler << " errors) in "
+        << result.elapsedMs << " ms with " << result.threads << " threads: "
+        << QString::number(result.rowsPerSecond(), 'f', 1) << " rows/s\n";
+
+    if (synastrie >= 0) {
+        if (synastrie >= personen.size()) {
+            err << "No person with index " << synastrie << "\n";
+            return 2;
+        }
+        astro::Radix radix;
+        radix.rFix = personen.at(synastrie);
+        radix.hausSys = static_cast<int8_t>(hausSys);
+        if (astro::ChartCalc::calculate(radix, nullptr, astro::TYP_RADIX) != astro::ERR_OK) {
+            err << "Cannot calculate person " << synastrie << "\n";
+            return 3;
+        }
+
+        // Positionen aus der Tabellen-Berechnung übernehmen
+        astro::SynastrieSuche suche;
+        suche.build(result);
+        QElapsedTimer timer;
+        timer.start();
+        const QVector<astro::SynastrieTreffer> rangliste =
+            suche.rangliste(radix, auinit, astro::SynastrieGewichte(), top, synastrie, threads);
+        const qint64 ms = timer.elapsed();
+
+        out << "\nSynastry with " << radix.rFix.vorname << " " << radix.rFix.name
+            << " (" << suche.size() << " persons in " << ms << " ms):\n";
+        for (int i = 0; i < rangliste.size(); ++i) {
+            const astro::SynastrieTreffer& t = rangliste.at(i);
+            const astro::RadixFix& p = personen.at(t.index);
+            out << (i + 1) << "\t" << QString::number(t.punkte, 'f', 1) << "\t"
+                << t.anzahlAspekte << "\t" << t.index << "\t"
+                << p.vorname << " " << p.name << "\n";
+        }
+    }
+
+    return result.fehler > 0 ? 1 : 0;
+}
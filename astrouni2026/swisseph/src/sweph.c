@@ -2356,6 +2356,15 @@ again:
   return(OK);
 }
 
+/*
+ * AstroUniverse: optional hook that serves ephemeris files from memory
+ * (mapped or embedded). Set once before the first calculation; gets the
+ * current ephepath so it can resolve fname like the search below, and
+ * returns NULL for files it does not hold, which are then searched in
+ * ephepath.
+ */
+FILE *(*swi_fopen_hook)(const char *fname, const char *ephepath) = NULL;
+
 /*
  * Alois 2.12.98: inserted error message generation for file not found 
  */
@@ -2372,6 +2381,13 @@ FILE *swi_fopen(int ifno, char *fname, char *ephepath, char *serr)
   } else {
     fnamp = fn; 
   }
+  if (swi_fopen_hook != NULL && strlen(fname) < AS_MAXCH) {
+    fp = swi_fopen_hook(fname, ephepath);
+    if (fp != NULL) {
+      strcpy(fnamp, fname);
+      return fp;
+    }
+  }
   strcpy(s1, ephepath);
   np = swi_cutstr(s1, PATH_SEPARATOR, cpos, 20);
   *s = '\0';
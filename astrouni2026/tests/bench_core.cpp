@@ -0,0 +1,385 @@
+/**
+ * @file bench_core.cpp
+ * @brief Performance-Messungen für die Core-Library
+ *
+ * Kleines Benchmark-Gerüst im Stil von Google Benchmark: jede Messung
+ * wird so oft wiederholt, bis die Mindestlaufzeit erreicht ist. Die
+ * Ergebnisse gehen als Tabelle auf stdout und optional als JSON (gleiches
+ * Schema wie Google Benchmark) in eine Datei, damit Builds verglichen
+ * werden können.
+ *
+ * Aufruf:
+ *   bench_core [--benchmark_filter=REGEX] [--benchmark_out=datei.json]
+ *              [--benchmark_min_time=SEKUNDEN]
+ */
+
+#include <QGuiApplication>
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QRegularExpression>
+#include <QSysInfo>
+#include <QTextStream>
+#include <QThread>
+#include <cmath>
+#include <ctime>
+#include <functional>
+
+#include "../src/core/astro_font_provider.h"
+#include "../src/core/astro_text_analyzer.h"
+#include "../src/core/calculations.h"
+#include "../src/core/chart_calc.h"
+#include "../src/core/swiss_eph.h"
+#include "../src/core/synastry.h"
+#include "../src/core/synastry_search.h"
+#include "../src/core/transit_calc.h"
+#include "../src/core/transit_events.h"
+#include "../src/core/transit_table.h"
+#include "../src/data/orte_db.h"
+
+using namespace astro;
+
+namespace {
+
+// Verhindert, dass der Compiler Ergebnisse wegoptimiert
+volatile double g_sink = 0.0;
+
+template<typename T>
+void doNotOptimize(const T& value) {
+    g_sink = g_sink + static_cast<double>(value);
+}
+
+struct Messung {
+    QString name;
+    qint64  iterations = 0;
+    double  realNs = 0.0;   // je Iteration
+    double  cpuNs = 0.0;    // je Iteration
+};
+
+class Bench {
+public:
+    Bench(const QString& filter, double minTime)
+        : m_filter(filter.isEmpty() ? QStringLiteral(".*") : filter)
+        , m_minTime(minTime) {
+    }
+
+    void run(const QString& name, const std::function<void()>& fn) {
+        if (!m_filter.match(name).hasMatch()) {
+            return;
+        }
+
+        // Iterationen verdoppeln/hochrechnen bis die Mindestlaufzeit erreicht ist
+        qint64 n = 1;
+        double realS = 0.0;
+        double cpuS = 0.0;
+        for (;;) {
+            QElapsedTimer timer;
+            const std::clock_t cpuStart = std::clock();
+            timer.start();
+            for (qint64 i = 0; i < n; ++i) {
+                fn();
+            }
+            realS = timer.nsecsElapsed() / 1e9;
+            cpuS = static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+
+            if (realS >= m_minTime || n >= 1000000000LL) {
+                break;
+            }
+            const double faktor = realS > 0.0 ? (m_minTime * 1.4) / realS : 100.0;
+            n = qMax(n * 2, static_cast<qint64>(n * qMin(faktor, 100.0)));
+        }
+
+        Messung m;
+        m.name = name;
+        m.iterations = n;
+        m.realNs = realS * 1e9 / n;
+        m.cpuNs = cpuS * 1e9 / n;
+        m_messungen.append(m);
+
+        QTextStream out(stdout);
+        out << qSetFieldWidth(48) << Qt::left << name
+            << qSetFieldWidth(16) << Qt::right << QString::number(m.realNs, 'f', 0) + " ns"
+            << QString::number(m.cpuNs, 'f', 0) + " ns"
+            << qSetFieldWidth(12) << n
+            << qSetFieldWidth(0) << "\n";
+        out.flush();
+    }
+
+    QJsonDocument toJson() const {
+        QJsonObject context;
+        context["date"] = QDateTime::currentDateTime().toString(Qt::ISODate);
+        context["host_name"] = QSysInfo::machineHostName();
+        context["executable"] = QCoreApplication::applicationFilePath();
+        context["num_cpus"] = QThread::idealThreadCount();
+        context["qt_version"] = QString::fromLatin1(qVersion());
+#ifdef NDEBUG
+        context["library_build_type"] = "release";
+#else
+        context["library_build_type"] = "debug";
+#endif
+
+        QJsonArray benchmarks;
+        for (const Messung& m : m_messungen) {
+            QJsonObject b;
+            b["name"] = m.name;
+            b["run_name"] = m.name;
+            b["run_type"] = "iteration";
+            b["iterations"] = m.iterations;
+            b["real_time"] = m.realNs;
+            b["cpu_time"] = m.cpuNs;
+            b["time_unit"] = "ns";
+            benchmarks.append(b);
+        }
+
+        QJsonObject root;
+        root["context"] = context;
+        root["benchmarks"] = benchmarks;
+        return QJsonDocument(root);
+    }
+
+private:
+    QRegularExpression m_filter;
+    double m_minTime;
+    QVector<Messung> m_messungen;
+};
+
+void initSampleRadix(Radix& radix, int hausSys) {
+    // 04.04.1918, 02:20, Wien (wie Demo-Datensatz)
+    radix.clear();
+    radix.hausSys = static_cast<int8_t>(hausSys);
+    radix.rFix.tag = 4;
+    radix.rFix.monat = 4;
+    radix.rFix.jahr = 1918;
+    radix.rFix.zeit = 2.333333333;
+    radix.rFix.laenge = 16.3667;
+    radix.rFix.breite = 48.2000;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    // Textanalyse braucht Fonts - ohne Bildschirm offscreen arbeiten
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QGuiApplication app(argc, argv);
+
+    QString filter;
+    QString outFile;
+    double minTime = 0.5;
+    for (const QString& arg : app.arguments().mid(1)) {
+        if (arg.startsWith("--benchmark_filter=")) {
+            filter = arg.section('=', 1);
+        } else if (arg.startsWith("--benchmark_out=")) {
+            outFile = arg.section('=', 1);
+        } else if (arg.startsWith("--benchmark_min_time=")) {
+            minTime = arg.section('=', 1).toDouble();
+        } else {
+            QTextStream(stderr) << "Unknown argument: " << arg << "\n";
+            return 2;
+        }
+    }
+
+    const QString appPath = QCoreApplication::applicationDirPath();
+    swissEph().setEphePath(appPath + "/../swisseph/ephe");
+
+    Bench bench(filter, minTime);
+    AuInit auinit;
+
+    Radix radix;
+    initSampleRadix(radix, TYP_PLACIDUS);
+    ChartCalc::calculate(radix, nullptr, TYP_RADIX);
+    ChartCalc::calcAspects(radix, auinit.orbenPlanet);
+    ChartCalc::calcAngles(radix, nullptr, TYP_RADIX);
+
+    //==========================================================================
+    // Kalender
+    //==========================================================================
+
+    bench.run("Calculations/julianDay", [] {
+        doNotOptimize(Calculations::julianDay(4, 4, 1918, 2.333333333, true));
+    });
+
+    //==========================================================================
+    // Horoskop
+    //==========================================================================
+
+    static const struct { int typ; const char* name; } haeuser[] = {
+        { TYP_KOCH,          "Koch" },
+        { TYP_PLACIDUS,      "Placidus" },
+        { TYP_EQUAL,         "Equal" },
+        { TYP_EQUALMID,      "EqualMid" },
+        { TYP_WHOLE,         "Whole" },
+        { TYP_TOPOZEN,       "Topozentrisch" },
+        { TYP_CAMPANUS,      "Campanus" },
+        { TYP_MERIDIAN,      "Meridian" },
+        { TYP_REGIOMONTANUS, "Regiomontanus" },
+        { TYP_PORPHYRY,      "Porphyry" },
+        { TYP_PORPHYRYN,     "PorphyryN" },
+        { TYP_MORINUS,       "Morinus" },
+        { TYP_ALCABIT,       "Alcabit" },
+        { TYP_NULL,          "Null" },
+    };
+    for (const auto& h : haeuser) {
+        Radix r;
+        initSampleRadix(r, h.typ);
+        bench.run(QString("ChartCalc/calculate/%1").arg(h.name), [&r] {
+            doNotOptimize(ChartCalc::calculate(r, nullptr, TYP_RADIX));
+        });
+    }
+
+    bench.run("ChartCalc/calcAspects", [&] {
+        ChartCalc::calcAspects(radix, auinit.orbenPlanet);
+        doNotOptimize(radix.aspPlanet[1]);
+    });
+
+    bench.run("ChartCalc/calcHouseAspects", [&] {
+        ChartCalc::calcHouseAspects(radix, auinit.orbenHaus, auinit.sAspekte);
+        doNotOptimize(radix.aspHaus[0]);
+    });
+
+    Radix partner;
+    initSampleRadix(partner, TYP_PLACIDUS);
+    partner.rFix.jahr = 1950;
+    ChartCalc::calculate(partner, nullptr, TYP_RADIX);
+
+    bench.run("SynastrieCalc/calculate/aspekte", [&] {
+        doNotOptimize(SynastrieCalc::calculate(radix, partner, auinit, TYP_SYNASTRIE,
+                                               SynastrieCalc::SYN_ASPEKTE).aspekte.size());
+    });
+
+    bench.run("SynastrieCalc/calculate/alle", [&] {
+        doNotOptimize(SynastrieCalc::calculate(radix, partner, auinit).davisonResult);
+    });
+
+    // Synastrie-Suche über 50000 künstliche Personen
+    BulkChartResult personen;
+    personen.rows.resize(50000);
+    for (int i = 0; i < personen.rows.size(); ++i) {
+        personen.rows[i].index = i;
+        for (int p = 0; p < MAX_PLANET; ++p) {
+            personen.rows[i].planet[p] = std::fmod(i * 37.7 + p * 101.3 + i * p * 0.61, 360.0);
+        }
+    }
+    SynastrieSuche suche;
+    suche.build(personen);
+
+    bench.run("SynastrieSuche/rangliste/50000", [&] {
+        doNotOptimize(suche.rangliste(radix, auinit, SynastrieGewichte(), 100).size());
+    });
+
+    bench.run("SynastrieSuche/rangliste/50000/1thread", [&] {
+        doNotOptimize(suche.rangliste(radix, auinit, SynastrieGewichte(), 100, -1, 1).size());
+    });
+
+    //==========================================================================
+    // Transite (jeweils ein Jahr)
+    //==========================================================================
+
+    const QDate von(2024, 1, 1);
+    const QDate bis(2025, 1, 1);
+    const QTime mitternacht(0, 0);
+
+    static const struct { int inkrement; const char* name; } schritte[] = {
+        { INC_MINUTEN, "minute" },
+        { INC_STUNDEN, "hour" },
+        { INC_TAGE,    "day" },
+    };
+    for (const auto& s : schritte) {
+        bench.run(QString("TransitCalc/calcMultiTransit/%1/1y").arg(s.name), [&] {
+            QVector<TransitAspekt> aspekte;
+            doNotOptimize(TransitCalc::calcMultiTransit(radix, von, mitternacht, bis, mitternacht,
+                                                        s.inkrement, nullptr, &aspekte,
+                                                        auinit.orbenTPlanet, auinit.orbenTHaus));
+        });
+    }
+
+    // Langsame Planeten über Jahrzehnte: ohne Transit-Radix im eigenen Takt
+    bench.run("TransitCalc/calcMultiTransit/day/30y", [&] {
+        QVector<TransitAspekt> aspekte;
+        doNotOptimize(TransitCalc::calcMultiTransit(radix, von, mitternacht, von.addYears(30), mitternacht,
+                                                    INC_TAGE, nullptr, &aspekte,
+                                                    auinit.orbenTPlanet, auinit.orbenTHaus));
+    });
+
+    bench.run("TransitEvents/calculate/1y", [&] {
+        QVector<TransitEvent> events;
+        doNotOptimize(TransitEvents::calculate(radix, von, mitternacht, bis, mitternacht, EV_ALLE, events,
+                                               auinit.orbenTPlanet, auinit.orbenTHaus));
+    });
+
+    bench.run("TransitTable/build/10y", [&] {
+        const double startJD = Calendar::toJD(von.year(), von.month(), von.day(), 0.0);
+        TransitTable table;
+        doNotOptimize(table.build(radix, startJD, startJD + 3652.5,
+                                  EV_ASPEKT_RADIX | EV_ASPEKT_HAUS | EV_ASPEKT_TRANSIT,
+                                  auinit.orbenTPlanet, auinit.orbenTHaus));
+    });
+
+    bench.run("TransitCalc/findAspectsInRange/1y", [&] {
+        QVector<TransitAspekt> aspekte;
+        doNotOptimize(TransitCalc::findAspectsInRange(radix, von, bis, auinit.orbenTPlanet, aspekte));
+    });
+
+    bench.run("TransitCalc/calcRetrograde/Merkur/1y", [&] {
+        QVector<QPair<QDate, QDate>> perioden;
+        doNotOptimize(TransitCalc::calcRetrograde(P_MERKUR, von, bis, perioden));
+    });
+
+    //==========================================================================
+    // Orte-Datenbank
+    //==========================================================================
+
+    if (orteDB().loadAll(appPath + "/../data") > 0) {
+        bench.run("OrteDB/search/Wien", [] {
+            doNotOptimize(orteDB().search("Wien").size());
+        });
+        bench.run("OrteDB/search/Sa", [] {
+            doNotOptimize(orteDB().search("Sa").size());
+        });
+    } else {
+        QTextStream(stderr) << "OrteDB: keine Daten gefunden - übersprungen\n";
+    }
+
+    //==========================================================================
+    // Fonts
+    //==========================================================================
+
+    astroFont().waitForDetection();
+    bench.run("AstroFontProvider/getPlanetSymbolFont", [] {
+        doNotOptimize(astroFont().getPlanetSymbolFont(12).pointSize());
+    });
+
+    //==========================================================================
+    // Textanalyse
+    //==========================================================================
+
+    AstroTextAnalyzer analyzer;
+    analyzer.setOrben(&auinit);
+    bench.run("AstroTextAnalyzer/analyzeRadix", [&] {
+        doNotOptimize(analyzer.analyzeRadix(radix).size());
+    });
+
+    const QVector<Radix> radixListe(100, radix);
+    bench.run("AstroTextAnalyzer/buildReports/100", [&] {
+        int fragmente = 0;
+        analyzer.buildReports(radixListe, [&](int, const AstroReport& report) {
+            fragmente += report.size();
+        });
+        doNotOptimize(fragmente);
+    });
+
+    if (!outFile.isEmpty()) {
+        QFile file(outFile);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            QTextStream(stderr) << "Cannot write file: " << outFile << "\n";
+            return 3;
+        }
+        file.write(bench.toJson().toJson(QJsonDocument::Indented));
+    }
+
+    return 0;
+}
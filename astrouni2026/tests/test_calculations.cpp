@@ -5,7 +5,9 @@
 
 #include <QtTest>
 #include "../src/core/calculations.h"
+#include "../src/core/calendar.h"
 #include "../src/core/constants.h"
+#include <cmath>
 
 using namespace astro;
 
@@ -14,8 +16,10 @@ class TestCalculations : public QObject {
     
 private slots:
     void testJulianDay();
+    void testCalendar();
     void testMod360();
     void testDegToGMS();
+    void testDecimalToTime();
     void testMinDist();
     void testGetZeichen();
     void testCheckAspekt();
@@ -31,6 +35,54 @@ void TestCalculations::testJulianDay() {
     QVERIFY(jd > 2450100 && jd < 2450200);
 }
 
+void TestCalculations::testCalendar() {
+    // Zur Übersetzungszeit auswertbar
+    static_assert(Calendar::toJD(2000, 1, 1, 12.0) == 2451545.0);
+    static_assert(Calendar::fromJD(2451545.0) == CalDateTime{ 2000, 1, 1, 12, 0, 0 });
+    static_assert(Calendar::dayNumber(1582, 10, 15) == Calendar::dayNumber(1582, 10, 4, false) + 1);
+
+    // Gleiche Werte wie der Legacy-Port, Rundreise über QDate
+    for (int jahr = 1600; jahr <= 2400; jahr += 7) {
+        for (int monat = 1; monat <= 12; ++monat) {
+            const int tag = Calendar::daysInMonth(jahr, monat);
+            const double jd = Calendar::toJD(jahr, monat, tag, 12.0);
+            QCOMPARE(jd, Calculations::julianDay(tag, monat, jahr, 12.0, true));
+            QCOMPARE(static_cast<qint64>(Calendar::dayNumber(jahr, monat, tag)),
+                     QDate(jahr, monat, tag).toJulianDay());
+
+            const CalDateTime dt = Calendar::fromJD(jd);
+            QCOMPARE(dt, (CalDateTime{ jahr, monat, tag, 12, 0, 0 }));
+        }
+    }
+
+    // Beliebige Uhrzeiten, auch vor Christus: höchstens 1 ulp Abweichung
+    for (int i = 0; i < 20000; ++i) {
+        const int jahr = -4700 + (i * 7919) % 9400;
+        const int monat = 1 + i % 12;
+        const int tag = 1 + (i * 13) % Calendar::daysInMonth(jahr, monat);
+        const double stunden = std::fmod(i * 0.7302967433402214, 24.0);
+        const double jd = Calendar::toJD(jahr, monat, tag, stunden);
+        const double legacy = Calculations::julianDay(tag, monat, jahr, stunden, true);
+        QVERIFY2(jd == legacy || std::nextafter(jd, legacy) == legacy,
+                 qPrintable(QString("%1-%2-%3 %4").arg(jahr).arg(monat).arg(tag).arg(stunden, 0, 'g', 17)));
+    }
+
+    // Minuten-Schritte über Mitternacht und den Schalttag
+    const double start = Calendar::toJD(2024, 2, 28, 23.5);
+    CalDateTime dt = Calendar::fromJD(start + 45 * Calendar::MINUTE);
+    QCOMPARE(dt, (CalDateTime{ 2024, 2, 29, 0, 15, 0 }));
+    dt = Calendar::fromJD(start + 1440 * Calendar::MINUTE);
+    QCOMPARE(dt, (CalDateTime{ 2024, 2, 29, 23, 30, 0 }));
+
+    // Monate: Tag auf Monatsende begrenzt
+    QCOMPARE(Calendar::addMonths({ 2023, 1, 31 }, 1), (CalDateTime{ 2023, 2, 28 }));
+    QCOMPARE(Calendar::addMonths({ 2024, 12, 15 }, 2), (CalDateTime{ 2025, 2, 15 }));
+
+    // Zeitzone
+    QCOMPARE(Calendar::localToUT(Calendar::toJD(2000, 1, 1, 13.0), 1.0),
+             Calendar::toJD(2000, 1, 1, 12.0));
+}
+
 void TestCalculations::testMod360() {
     QCOMPARE(Calculations::mod360(0.0), 0.0);
     QCOMPARE(Calculations::mod360(360.0), 0.0);
@@ -39,6 +91,28 @@ void TestCalculations::testMod360() {
     QCOMPARE(Calculations::mod360(450.0), 90.0);
 }
 
+void TestCalculations::testDecimalToTime() {
+    int16_t h, m;
+
+    Calculations::decimalToTime(14.5, h, m);
+    QCOMPARE(h, static_cast<int16_t>(14));
+    QCOMPARE(m, static_cast<int16_t>(30));
+
+    // Gerundet mit Übertrag: nie 12:60
+    Calculations::decimalToTime(12.9999, h, m);
+    QCOMPARE(h, static_cast<int16_t>(13));
+    QCOMPARE(m, static_cast<int16_t>(0));
+
+    // Jede Minute des Tages übersteht den Hin- und Rückweg
+    for (int16_t stunde = 0; stunde < 24; ++stunde) {
+        for (int16_t minute = 0; minute < 60; ++minute) {
+            Calculations::decimalToTime(Calculations::timeToDecimal(stunde, minute), h, m);
+            QCOMPARE(h, stunde);
+            QCOMPARE(m, minute);
+        }
+    }
+}
+
 void TestCalculations::testDegToGMS() {
     int16_t g, m, s;
     
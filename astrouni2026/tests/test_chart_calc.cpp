@@ -4,9 +4,28 @@
  */
 
 #include <QtTest>
+#include "../src/core/bulk_chart.h"
 #include "../src/core/chart_calc.h"
+#include "../src/core/chart_cache.h"
+#include "../src/core/chart_pipeline.h"
 #include "../src/core/calculations.h"
+#include "../src/core/ephe_context.h"
+#include "../src/core/ephe_memory.h"
 #include "../src/core/swiss_eph.h"
+#include "../src/core/transit_calc.h"
+#include "../src/core/transit_events.h"
+#include "../src/core/transit_table.h"
+#include "../src/core/sign_timeline.h"
+#include "../src/core/synastry.h"
+#include "../src/core/synastry_search.h"
+#include "../src/core/astro_text_store.h"
+#include "../src/core/astro_text_analyzer.h"
+#include "../src/core/astro_report.h"
+#include "../src/core/astro_font_provider.h"
+#include <QtConcurrent>
+#include <algorithm>
+#include <cmath>
+#include <tuple>
 
 using namespace astro;
 
@@ -21,6 +40,22 @@ private slots:
     void testCalcQualities();
     void testAllHouseSystemsSingleRadix();
     void testAllHouseSystemsMultipleRadix();
+    void testPipelineIncremental();
+    void testChartCache();
+    void testBulkChart();
+    void testEpheContext();
+    void testEpheMemory();
+    void testTransitStep();
+    void testKalenderGrenzen();
+    void testTransitSampler();
+    void testTransitEvents();
+    void testTransitTable();
+    void testRuecklauf();
+    void testSignTimeline();
+    void testTextVorlage();
+    void testAstroReport();
+    void testSynastrie();
+    void testSynastrieSuche();
     void cleanupTestCase();
 };
 
@@ -206,5 +241,1173 @@ void TestChartCalc::testAllHouseSystemsMultipleRadix() {
     }
 }
 
+// Test: Pipeline rechnet nur die von einer Änderung betroffenen Stufen neu
+void TestChartCalc::testPipelineIncremental() {
+    AuInit auinit;
+    Radix radix;
+    initSampleRadix(radix, 4, 4, 1918, 2.333333333, 16.3667, 48.2000, TYP_PLACIDUS);
+
+    ChartPipeline pipeline;
+    QCOMPARE(pipeline.run(radix, auinit), ERR_OK);
+    QCOMPARE(pipeline.lastStages(), ChartPipeline::STAGE_CHART | ChartPipeline::STAGE_ASPEKTE);
+
+    // Gleiche Eingaben: nichts zu tun
+    QCOMPARE(pipeline.run(radix, auinit), ERR_OK);
+    QCOMPARE(pipeline.lastStages(), 0);
+    QCOMPARE(ChartPipeline::stageNames(pipeline.lastStages()), QString("-"));
+
+    // Häusersystem: Planeten bleiben, Häuser und Aspekte neu
+    radix.hausSys = TYP_KOCH;
+    QCOMPARE(pipeline.run(radix, auinit), ERR_OK);
+    QCOMPARE(pipeline.lastStages(), ChartPipeline::STAGE_HAEUSER | ChartPipeline::STAGE_ASPEKTE);
+    QCOMPARE(ChartPipeline::stageNames(pipeline.lastStages()), QString("Häuser, Aspekte"));
+
+    Radix referenz;
+    initSampleRadix(referenz, 4, 4, 1918, 2.333333333, 16.3667, 48.2000, TYP_KOCH);
+    QCOMPARE(ChartCalc::calculate(referenz, nullptr, TYP_RADIX), ERR_OK);
+    for (int i = 0; i < MAX_HAUS; ++i) {
+        QCOMPARE(radix.haus[i], referenz.haus[i]);
+    }
+    for (int i = 0; i < radix.anzahlPlanet; ++i) {
+        QCOMPARE(radix.planet[i], referenz.planet[i]);
+        QCOMPARE(radix.inHaus[i], referenz.inHaus[i]);
+    }
+
+    // Orben: nur Aspekte
+    auinit.orbenPlanet[0] += 1.0f;
+    QCOMPARE(pipeline.run(radix, auinit), ERR_OK);
+    QCOMPARE(pipeline.lastStages(), static_cast<int>(ChartPipeline::STAGE_ASPEKTE));
+
+    // Zeit: alle Horoskop-Stufen neu
+    radix.rFix.zeit += 1.0;
+    QCOMPARE(pipeline.run(radix, auinit), ERR_OK);
+    QCOMPARE(pipeline.lastStages(), ChartPipeline::STAGE_CHART | ChartPipeline::STAGE_ASPEKTE);
+}
+
+// Test: Chart-Cache liefert dieselben Werte wie ChartCalc und übersteht save/load
+void TestChartCalc::testChartCache() {
+    ChartCache& cache = chartCache();
+    cache.clear();
+
+    Radix radix;
+    initSampleRadix(radix, 20, 7, 1984, 14.5, -74.0060, 40.7128, TYP_PLACIDUS);
+    QCOMPARE(cache.calculate(radix), ERR_OK);
+    QCOMPARE(cache.misses(), static_cast<qint64>(1));
+    QCOMPARE(cache.count(), 1);
+    QVERIFY(cache.memoryUsage() > 0);
+
+    // Gleiche Geburtsdaten, anderer Name: Treffer
+    Radix zweiter;
+    initSampleRadix(zweiter, 20, 7, 1984, 14.5, -74.0060, 40.7128, TYP_PLACIDUS);
+    zweiter.rFix.name = "Andere Person";
+    QCOMPARE(cache.calculate(zweiter), ERR_OK);
+    QCOMPARE(cache.hits(), static_cast<qint64>(1));
+    QCOMPARE(cache.hitRate(), 0.5);
+    QCOMPARE(zweiter.rFix.name, QString("Andere Person"));
+
+    Radix referenz;
+    initSampleRadix(referenz, 20, 7, 1984, 14.5, -74.0060, 40.7128, TYP_PLACIDUS);
+    QCOMPARE(ChartCalc::calculate(referenz, nullptr, TYP_RADIX), ERR_OK);
+    QCOMPARE(zweiter.asc, referenz.asc);
+    QCOMPARE(zweiter.mc, referenz.mc);
+    for (int i = 0; i < MAX_HAUS; ++i) {
+        QCOMPARE(zweiter.haus[i], referenz.haus[i]);
+    }
+    for (int i = 0; i < referenz.anzahlPlanet; ++i) {
+        QCOMPARE(zweiter.planet[i], referenz.planet[i]);
+        QCOMPARE(zweiter.inHaus[i], referenz.inHaus[i]);
+    }
+
+    // Anderes Häusersystem: eigener Eintrag
+    zweiter.hausSys = TYP_KOCH;
+    QCOMPARE(cache.calculate(zweiter), ERR_OK);
+    QCOMPARE(cache.count(), 2);
+
+    // Einträge halten keine Personendaten
+    auto eintrag = cache.find(ChartCache::makeKey(zweiter));
+    QVERIFY(eintrag);
+    QVERIFY(eintrag->rFix.name.isEmpty());
+    QCOMPARE(eintrag->rFix.jahr, static_cast<int16_t>(1984));
+
+    // Persistenz - ohne Namen in der Datei
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString datei = dir.filePath("cache.dat");
+    QCOMPARE(cache.save(datei), ERR_OK);
+    QFile gesichert(datei);
+    QVERIFY(gesichert.open(QIODevice::ReadOnly));
+    const QString name = "Andere Person";
+    const QByteArray nameUtf16(reinterpret_cast<const char*>(name.utf16()), name.size() * 2);
+    QVERIFY(!gesichert.readAll().contains(nameUtf16));
+    gesichert.close();
+
+    cache.clear();
+    QCOMPARE(cache.load(datei), ERR_OK);
+    QCOMPARE(cache.count(), 2);
+
+    Radix geladen;
+    initSampleRadix(geladen, 20, 7, 1984, 14.5, -74.0060, 40.7128, TYP_PLACIDUS);
+    geladen.rFix.vorname = "Eigene";
+    QCOMPARE(cache.calculate(geladen), ERR_OK);
+    QCOMPARE(cache.hits(), static_cast<qint64>(1));
+    QCOMPARE(geladen.rFix.vorname, QString("Eigene"));
+    QCOMPARE(geladen.asc, referenz.asc);
+    for (int i = 0; i < referenz.anzahlPlanet; ++i) {
+        QCOMPARE(geladen.planet[i], referenz.planet[i]);
+    }
+
+    // Schlüssel und Laden folgen dem übergebenen Kontext, nicht dem globalen
+    const EpheContext anderer(EpheConfig::create(dir.filePath("andere_ephe")));
+    QVERIFY(!(ChartCache::makeKey(geladen, TYP_RADIX, anderer) == ChartCache::makeKey(geladen)));
+    cache.clear();
+    QCOMPARE(cache.load(datei, anderer), ERR_OK);
+    QCOMPARE(cache.count(), 0);
+
+    cache.clear();
+}
+
+// Test: Massen-Berechnung entspricht ChartCalc, parallel wie sequentiell
+void TestChartCalc::testBulkChart() {
+    AuInit auinit;
+    QVector<RadixFix> personen;
+    const double zeiten[] = { 2.333333333, 14.5, 6.75, 23.9 };
+    for (double zeit : zeiten) {
+        Radix radix;
+        initSampleRadix(radix, 4, 4, 1918, zeit, 16.3667, 48.2000, TYP_PLACIDUS);
+        personen.append(radix.rFix);
+    }
+
+    const BulkChartResult seriell = BulkChart::calculate(personen, auinit, TYP_PLACIDUS, 1);
+    const BulkChartResult parallel = BulkChart::calculate(personen, auinit, TYP_PLACIDUS, 4);
+    QCOMPARE(seriell.rows.size(), personen.size());
+    QCOMPARE(parallel.rows.size(), personen.size());
+    QCOMPARE(seriell.fehler, 0);
+
+    for (int p = 0; p < personen.size(); ++p) {
+        Radix referenz;
+        referenz.rFix = personen[p];
+        referenz.hausSys = TYP_PLACIDUS;
+        QCOMPARE(ChartCalc::calculate(referenz, nullptr, TYP_RADIX), ERR_OK);
+        ChartCalc::calcAspects(referenz, auinit.orbenPlanet);
+
+        for (const BulkChartResult* r : { &seriell, &parallel }) {
+            const BulkChartRow& row = r->rows[p];
+            QCOMPARE(row.index, p);
+            QCOMPARE(row.asc, referenz.asc);
+            for (int i = 0; i < MAX_PLANET; ++i) {
+                QCOMPARE(row.planet[i], referenz.planet[i]);
+            }
+            for (int h = 0; h < MAX_HAUS; ++h) {
+                QCOMPARE(row.haus[h], referenz.haus[h]);
+            }
+            // Sonne-Mond Aspekt in der Maske wiederfinden
+            const int asp = referenz.aspPlanet[P_SONNE * referenz.anzahlPlanet + P_MOND];
+            for (int a = 0; a < ASPEKTE; ++a) {
+                const bool gesetzt = (row.aspekte[a][P_SONNE] & (1u << P_MOND)) != 0;
+                QCOMPARE(gesetzt, asp != KEIN_ASP && asp / 30 == a);
+            }
+        }
+    }
+
+    QCOMPARE(BulkChart::columns().size(), 10 + MAX_PLANET + MAX_HAUS + ASPEKTE * MAX_PLANET);
+}
+
+// Test: Ephemeriden-Kontext - Fehler als Rückgabewert, gleiche Werte in Worker-Threads
+void TestChartCalc::testEpheContext() {
+    const EpheContext ctx = EpheContext::current();
+    QCOMPARE(ctx.config().ephePath, swissEph().getEphePath());
+
+    // Fehler landen im Ergebnis, nicht im gemeinsamen Zustand
+    swissEph().clearError();
+    const PlanetPos falsch = ctx.calcPlanet(999, 2451545.0);
+    QVERIFY(!falsch.ok());
+    QCOMPARE(falsch.status.result, ERR_EPHEM);
+    QVERIFY(!falsch.status.error.isEmpty());
+    QVERIFY(!swissEph().hasError());
+
+    Radix referenz;
+    initSampleRadix(referenz, 4, 4, 1918, 2.333333333, 16.3667, 48.2000, TYP_KOCH);
+    QCOMPARE(ChartCalc::calculate(referenz, nullptr, TYP_RADIX, ctx), ERR_OK);
+
+    // Jeder Worker bindet sich beim ersten Aufruf selbst an die Konfiguration
+    QVector<int> laeufe(16);
+    const QVector<Radix> ergebnisse = QtConcurrent::blockingMapped(laeufe, [&ctx](int) {
+        Radix radix;
+        initSampleRadix(radix, 4, 4, 1918, 2.333333333, 16.3667, 48.2000, TYP_KOCH);
+        ChartCalc::calculate(radix, nullptr, TYP_RADIX, ctx);
+        return radix;
+    });
+    for (const Radix& radix : ergebnisse) {
+        QCOMPARE(radix.asc, referenz.asc);
+        for (int i = 0; i < referenz.anzahlPlanet; ++i) {
+            QCOMPARE(radix.planet[i], referenz.planet[i]);
+        }
+    }
+
+    // Neuer Pfad = neue Konfiguration; current() übernimmt sie
+    const quint64 alteId = ctx.config().id;
+    swissEph().setEphePath(ctx.config().ephePath);
+    QVERIFY(EpheContext::current().config().id != alteId);
+}
+
+// Test: Ephemeriden aus dem Speicher liefern dieselben Werte wie von der Platte
+void TestChartCalc::testEpheMemory() {
+    if (!EpheMemory::isSupported()) {
+        QSKIP("fmemopen nicht verfügbar");
+    }
+    const QString ephePath = swissEph().getEphePath();
+    if (QDir(ephePath).entryList({ "*.se1" }, QDir::Files).isEmpty()) {
+        QSKIP("Keine Ephemeriden-Dateien");
+    }
+
+    Radix platte;
+    initSampleRadix(platte, 4, 4, 1918, 2.333333333, 16.3667, 48.2000, TYP_KOCH);
+    QCOMPARE(ChartCalc::calculate(platte, nullptr, TYP_RADIX), ERR_OK);
+
+    QVERIFY(EpheMemory::addDirectory(ephePath, EpheMemory::Modus::Preload) > 0);
+    QVERIFY(EpheMemory::totalBytes() > 0);
+
+    // Neue Konfiguration schließt die offenen Dateien - Neuöffnen über den Hook
+    const int treffer = EpheMemory::hookHits();
+    swissEph().setEphePath(ephePath);
+    Radix speicher;
+    initSampleRadix(speicher, 4, 4, 1918, 2.333333333, 16.3667, 48.2000, TYP_KOCH);
+    QCOMPARE(ChartCalc::calculate(speicher, nullptr, TYP_RADIX), ERR_OK);
+    QVERIFY(EpheMemory::hookHits() > treffer);
+
+    QCOMPARE(speicher.asc, platte.asc);
+    for (int i = 0; i < platte.anzahlPlanet; ++i) {
+        QCOMPARE(speicher.planet[i], platte.planet[i]);
+    }
+
+    // Anderer Pfad: die registrierten Dateien gelten dort nicht
+    const QString leer = QDir::temp().filePath("astro_ephe_leer");
+    QVERIFY(QDir().mkpath(leer));
+    swissEph().setEphePath(leer);
+    const int vorher = EpheMemory::hookHits();
+    Radix ohne;
+    initSampleRadix(ohne, 4, 4, 1918, 2.333333333, 16.3667, 48.2000, TYP_KOCH);
+    ChartCalc::calculate(ohne, nullptr, TYP_RADIX);
+    QCOMPARE(EpheMemory::hookHits(), vorher);
+    swissEph().setEphePath(ephePath);
+}
+
+// Test: Multi-Transit mit eigener Schrittweite, Datumswechsel, Schrittzahl ohne Iteration
+void TestChartCalc::testTransitStep() {
+    Radix radix;
+    initSampleRadix(radix, 4, 4, 1918, 2.333333333, 16.3667, 48.2000, TYP_KOCH);
+    QCOMPARE(ChartCalc::calculate(radix, nullptr, TYP_RADIX), ERR_OK);
+
+    // 10 Minuten über Mitternacht
+    const QDate von(2024, 2, 28);
+    const QDate bis(2024, 2, 29);
+    const TransitStep zehnMinuten = TransitStep::minutes(10);
+    QVector<Radix> transits;
+    int anzahl = TransitCalc::calcMultiTransit(radix, von, QTime(23, 0), bis, QTime(1, 0),
+                                               zehnMinuten, &transits);
+    QCOMPARE(anzahl, 13);
+    QCOMPARE(transits.size(), 13);
+    QCOMPARE(TransitCalc::stepCount(von, QTime(23, 0), bis, QTime(1, 0), zehnMinuten), 13);
+    QCOMPARE(transits[6].rFix.tag, int16_t(29));
+    QCOMPARE(transits[6].rFix.zeit, 0.0);
+    QCOMPARE(transits[7].rFix.zeit, 10.0 / 60.0);
+
+    // Stunden schalten das Datum weiter
+    QDate datum(2024, 12, 31);
+    QTime zeit(23, 0);
+    QCOMPARE(TransitCalc::incDate(datum, zeit, INC_STUNDEN, 2), ERR_OK);
+    QCOMPARE(datum, QDate(2025, 1, 1));
+    QCOMPARE(zeit, QTime(1, 0));
+
+    // Schrittzahl wie die Iteration (auch Monatsende)
+    const QVector<QPair<TransitStep, int>> faelle = {
+        { TransitStep::fixed(INC_TAGE), 367 },
+        { TransitStep::fixed(INC_WOCHEN), 53 },
+        { TransitStep::fixed(INC_MONATE), 13 },
+        { TransitStep::fixed(INC_JAHRE), 2 },
+        { TransitStep::hours(6), 367 * 4 - 3 },
+    };
+    for (const auto& fall : faelle) {
+        QCOMPARE(TransitCalc::stepCount(QDate(2024, 1, 31), QTime(12, 0),
+                                        QDate(2025, 1, 31), QTime(12, 0), fall.first),
+                 fall.second);
+    }
+    QCOMPARE(TransitCalc::stepCount(bis, QTime(0, 0), von, QTime(0, 0), zehnMinuten), 0);
+
+    // Adaptiv: Mond bestimmt die Schrittweite, Pluto allein erlaubt große Schritte
+    const TransitStep mitMond = TransitStep::adaptive({ P_MOND, P_PLUTO }, 1.0);
+    const TransitStep nurPluto = TransitStep::adaptive({ P_PLUTO }, 1.0);
+    QVERIFY(mitMond.isValid() && nurPluto.isValid());
+    QVERIFY(mitMond.duration() < Calendar::STUNDE);
+    QVERIFY(nurPluto.duration() > 10.0);
+
+    QVERIFY(!TransitStep::days(-1.0).isValid());
+    QCOMPARE(TransitCalc::calcMultiTransit(radix, von, QTime(0, 0), bis, QTime(0, 0), 99), ERR_INC);
+}
+
+// Test: Aspekt-Suche über Stützstellen (Körper im eigenen Takt) trifft dieselben
+// Aspekte wie die volle Berechnung jedes Schritts
+// Test: Monatsende, 29. Februar und Daten vor 1582 (proleptisch gregorianisch wie QDate)
+void TestChartCalc::testKalenderGrenzen() {
+    // incDate wie QDate::addDays/addMonths/addYears
+    const QVector<QDate> starts = {
+        QDate(2023, 1, 31), QDate(2024, 1, 31), QDate(2024, 2, 28), QDate(2024, 2, 29),
+        QDate(2023, 2, 28), QDate(2024, 12, 31), QDate(1500, 2, 28), QDate(1582, 10, 4),
+        QDate(1400, 1, 31)
+    };
+    for (const QDate& start : starts) {
+        for (int n : { 1, 2, 13, 400 }) {
+            QDate datum = start;
+            QTime zeit(12, 0);
+            QCOMPARE(TransitCalc::incDate(datum, zeit, INC_TAGE, n), ERR_OK);
+            QCOMPARE(datum, start.addDays(n));
+
+            datum = start;
+            QCOMPARE(TransitCalc::incDate(datum, zeit, INC_MONATE, n), ERR_OK);
+            QCOMPARE(datum, start.addMonths(n));
+
+            datum = start;
+            QCOMPARE(TransitCalc::incDate(datum, zeit, INC_JAHRE, n), ERR_OK);
+            QCOMPARE(datum, start.addYears(n));
+            QCOMPARE(zeit, QTime(12, 0));
+        }
+    }
+
+    // Stunden über Mitternacht in den 29. Februar und den 1. März
+    QDate datum(2024, 2, 28);
+    QTime zeit(23, 0);
+    QCOMPARE(TransitCalc::incDate(datum, zeit, INC_STUNDEN, 2), ERR_OK);
+    QCOMPARE(datum, QDate(2024, 2, 29));
+    QCOMPARE(TransitCalc::incDate(datum, zeit, INC_STUNDEN, 23), ERR_OK);
+    QCOMPARE(datum, QDate(2024, 3, 1));
+    QCOMPARE(zeit, QTime(0, 0));
+
+    // Rückläufigkeit: Beginn ist der erste rückläufige Tag, Ende der erste
+    // direkte (jeweils 12 Uhr) - über Monatsende, 29. Februar und vor 1582
+    const EpheContext ctx = EpheContext::current();
+    struct Fall {
+        int planet;
+        QDate von;
+        QDate bis;
+    };
+    const QVector<Fall> faelle = {
+        { P_MARS, QDate(2011, 12, 1), QDate(2012, 6, 1) },      // 24.1.-14.4.2012
+        { P_VENUS, QDate(2025, 1, 1), QDate(2025, 12, 31) },    // 2.3.-13.4.2025
+        { P_MERKUR, QDate(1400, 1, 1), QDate(1401, 1, 1) },
+    };
+    auto mittag = [](const QDate& d) { return Calendar::toJD(d.year(), d.month(), d.day(), 12.0); };
+    for (const Fall& fall : faelle) {
+        QVector<QPair<QDate, QDate>> perioden;
+        QVERIFY(TransitCalc::calcRetrograde(fall.planet, fall.von, fall.bis, perioden, ctx) > 0);
+        for (const auto& p : perioden) {
+            QVERIFY(p.first > fall.von && p.second < fall.bis);
+            QVERIFY(ctx.isRetrograde(fall.planet, mittag(p.first)));
+            QVERIFY(!ctx.isRetrograde(fall.planet, mittag(p.first) - 1.0));
+            QVERIFY(!ctx.isRetrograde(fall.planet, mittag(p.second)));
+            QVERIFY(ctx.isRetrograde(fall.planet, mittag(p.second) - 1.0));
+        }
+    }
+    QVector<QPair<QDate, QDate>> venus;
+    TransitCalc::calcRetrograde(P_VENUS, QDate(2025, 1, 1), QDate(2025, 12, 31), venus, ctx);
+    QCOMPARE(venus.size(), 1);
+    QCOMPARE(venus[0].first, QDate(2025, 3, 2));
+    QCOMPARE(venus[0].second, QDate(2025, 4, 13));
+
+    // Aspekt-Suche: Zeitpunkte im Zeitraum und dort exakt (Sonne/Mond)
+    Radix radix;
+    initSampleRadix(radix, 4, 4, 1918, 2.333333333, 16.3667, 48.2000, TYP_KOCH);
+    QCOMPARE(ChartCalc::calculate(radix, nullptr, TYP_RADIX), ERR_OK);
+    radix.anzahlPlanet = 2;
+    const QVector<QPair<QDate, QDate>> zeitraeume = {
+        { QDate(2024, 2, 20), QDate(2024, 3, 10) },
+        { QDate(2023, 4, 20), QDate(2023, 5, 10) },
+        { QDate(1500, 2, 20), QDate(1500, 3, 10) },
+    };
+    for (const auto& z : zeitraeume) {
+        QVector<TransitAspekt> aspekte;
+        QVERIFY(TransitCalc::findAspectsInRange(radix, z.first, z.second, {}, aspekte, ctx) > 0);
+        for (const TransitAspekt& a : aspekte) {
+            const QDate d = a.zeitpunkt.date();
+            const QTime t = a.zeitpunkt.time();
+            QVERIFY(d >= z.first && d <= z.second);
+            const double jd = Calendar::toJD(d.year(), d.month(), d.day(),
+                                             t.hour() + t.minute() / 60.0);
+            const double abstand = std::fabs(Calculations::minDist(
+                ctx.calcPlanetLongitude(a.transitPlanet, jd), radix.planet[a.radixPlanet]));
+            QVERIFY(std::fabs(abstand - a.aspekt) < 0.01);
+        }
+    }
+}
+
+void TestChartCalc::testTransitSampler() {
+    Radix radix;
+    initSampleRadix(radix, 4, 4, 1918, 2.333333333, 16.3667, 48.2000, TYP_KOCH);
+    QCOMPARE(ChartCalc::calculate(radix, nullptr, TYP_RADIX), ERR_OK);
+
+    const QVector<float> orbenPlanet(ASPEKTE * MAX_PLANET, 2.0f);
+    const QVector<float> orbenHaus(ASPEKTE * MAX_HAUS, 1.0f);
+    static const int winkel[ASPEKTE] = { KONJUNKTION, HALBSEX, SEXTIL, QUADRATUR, TRIGON, QUINCUNX, OPOSITION };
+
+    // Erster Aspekt im Orbis, Orben-Index wie TransitCalc (aspekt * stride + planet)
+    auto suche = [&](double pos, double ziel, const QVector<float>& orben, int stride, int tp) {
+        for (int a = 0; a < ASPEKTE; ++a) {
+            const double orb = (orben.size() > a * stride + tp) ? orben[a * stride + tp] : 8.0;
+            double exakt;
+            if (Calculations::checkAspekt(pos, ziel, winkel[a], orb, exakt)) {
+                return winkel[a];
+            }
+        }
+        return static_cast<int>(KEIN_ASP);
+    };
+
+    // Ein Jahr in Tagen
+    const QDate von(2024, 1, 1);
+    const QDate bis(2025, 1, 1);
+    QVector<Radix> transits;
+    QVector<TransitAspekt> aspekte;
+    const int n = TransitCalc::calcMultiTransit(radix, von, QTime(0, 0), bis, QTime(0, 0),
+                                                TransitStep::fixed(INC_TAGE), &transits, &aspekte,
+                                                orbenPlanet, orbenHaus);
+    QCOMPARE(n, 7 * 24 + 1);
+    QCOMPARE(transits.size(), n);
+
+    // Referenz: jeder Schritt voll berechnet - Schritt, Transit-Planet, Ziel, Haus, Aspekt
+    using Treffer = std::tuple<int, int, int, bool, int>;
+    QVector<Treffer> erwartet;
+    for (int i = 0; i < n; ++i) {
+        Radix referenz;
+        QCOMPARE(TransitCalc::calcTransit(radix, referenz, von.addDays(i), QTime(0, 0)), ERR_OK);
+        QCOMPARE(transits[i].jd, referenz.jd);
+        QCOMPARE(transits[i].rFix.tag, referenz.rFix.tag);
+        if (transits[i].anzahlPlanet > 0) {
+            QCOMPARE(transits[i].planet, referenz.planet);
+        }
+        for (int tp = 0; tp < radix.anzahlPlanet; ++tp) {
+            for (int rp = 0; rp < radix.anzahlPlanet; ++rp) {
+                const int asp = suche(referenz.planet[tp], radix.planet[rp], orbenPlanet, MAX_PLANET, tp);
+                if (asp != KEIN_ASP) {
+                    erwartet.append({ i, tp, rp, false, asp });
+                }
+            }
+            for (int h = 0; h < MAX_HAUS; ++h) {
+                const int asp = suche(referenz.planet[tp], radix.haus[h], orbenHaus, MAX_HAUS, tp);
+                if (asp != KEIN_ASP) {
+                    erwartet.append({ i, tp, h, true, asp });
+                }
+            }
+        }
+    }
+
+    // Sequenzen in Treffer je Schritt auflösen; Beginn und Ende sind voll berechnet
+    QVector<Treffer> gefunden;
+    for (const TransitAspekt& ta : aspekte) {
+        QCOMPARE(transits[ta.startIndex].anzahlPlanet, radix.anzahlPlanet);
+        QCOMPARE(transits[ta.endIndex].anzahlPlanet, radix.anzahlPlanet);
+        for (int i = ta.startIndex; i <= ta.endIndex; ++i) {
+            gefunden.append({ i, ta.transitPlanet, ta.radixPlanet, ta.isHaus, ta.aspekt });
+        }
+    }
+    std::sort(erwartet.begin(), erwartet.end());
+    std::sort(gefunden.begin(), gefunden.end());
+    QVERIFY(!erwartet.isEmpty());
+    QCOMPARE(gefunden, erwartet);
+
+    // Mit und ohne Transit-Radixe dieselben Sequenzen (auch Stunden/Minuten)
+    auto sequenzen = [&](const QVector<TransitAspekt>& liste) {
+        QVector<std::tuple<int, int, int, bool, int, int, bool>> seq;
+        for (const TransitAspekt& ta : liste) {
+            seq.append({ ta.transitPlanet, ta.radixPlanet, ta.aspekt, ta.isHaus,
+                         ta.startIndex, ta.endIndex, ta.retrograde });
+        }
+        return seq;
+    };
+    const struct { QDate von; QDate bis; TransitStep schritt; } faelle[] = {
+        { QDate(2024, 3, 1), QDate(2024, 3, 8), TransitStep::fixed(INC_STUNDEN) },
+        { QDate(2024, 3, 1), QDate(2024, 3, 2), TransitStep::minutes(10) },
+    };
+    for (const auto& fall : faelle) {
+        QVector<Radix> mitRadix;
+        QVector<TransitAspekt> mit;
+        QVector<TransitAspekt> ohne;
+        const int n1 = TransitCalc::calcMultiTransit(radix, fall.von, QTime(0, 0), fall.bis, QTime(0, 0),
+                                                     fall.schritt, &mitRadix, &mit,
+                                                     orbenPlanet, orbenHaus);
+        const int n2 = TransitCalc::calcMultiTransit(radix, fall.von, QTime(0, 0), fall.bis, QTime(0, 0),
+                                                     fall.schritt, nullptr, &ohne,
+                                                     orbenPlanet, orbenHaus);
+        QCOMPARE(n2, n1);
+        QVERIFY(!mit.isEmpty());
+        QCOMPARE(sequenzen(ohne), sequenzen(mit));
+    }
+}
+
+// Test: Ereignis-Strom (Aspekte, Eintritte, Stationen) sortiert und an der Ephemeride geprüft
+void TestChartCalc::testTransitEvents() {
+    Radix radix;
+    initSampleRadix(radix, 4, 4, 1918, 2.333333333, 16.3667, 48.2000, TYP_KOCH);
+    QCOMPARE(ChartCalc::calculate(radix, nullptr, TYP_RADIX), ERR_OK);
+
+    const QVector<float> orbenPlanet(ASPEKTE * MAX_PLANET, 2.0f);
+    const QVector<float> orbenHaus(ASPEKTE * MAX_HAUS, 1.0f);
+    const double startJD = Calendar::toJD(2024, 1, 1, 0.0);
+    const double endJD = Calendar::toJD(2025, 1, 1, 0.0);
+    const EpheContext ctx = EpheContext::current();
+
+    QVector<TransitEvent> alle;
+    const int n = TransitEvents::calculate(radix, startJD, endJD, EV_ALLE, alle, orbenPlanet, orbenHaus);
+    QCOMPARE(n, alle.size());
+    QVERIFY(n > 0);
+
+    int exakt = 0;
+    int stationen = 0;
+    int zeichen = 0;
+    for (int i = 0; i < alle.size(); ++i) {
+        const TransitEvent& ev = alle[i];
+        QVERIFY(ev.jd >= startJD && ev.jd <= endJD);
+        if (i > 0) {
+            QVERIFY(alle[i - 1].jd <= ev.jd);
+        }
+
+        const PlanetPos pos = ctx.calcPlanet(ev.planet, ev.jd);
+        QVERIFY(pos.ok());
+        if (ev.typ == TransitEventTyp::AspektExakt && ev.art == EV_ASPEKT_RADIX) {
+            const double abstand = std::fabs(Calculations::minDist(pos.longitude, radix.planet[ev.ziel]));
+            QVERIFY(std::fabs(abstand - ev.aspekt) < 0.01);
+            ++exakt;
+        } else if (ev.typ == TransitEventTyp::AspektExakt && ev.art == EV_ASPEKT_TRANSIT) {
+            const double ziel = ctx.calcPlanet(ev.ziel, ev.jd).longitude;
+            QVERIFY(std::fabs(std::fabs(Calculations::minDist(pos.longitude, ziel)) - ev.aspekt) < 0.01);
+        } else if (ev.typ == TransitEventTyp::Station) {
+            QVERIFY(std::fabs(pos.speed) < 0.001);
+            ++stationen;
+        } else if (ev.art == EV_ZEICHEN) {
+            QCOMPARE(Calculations::getZeichen(pos.longitude + 0.01 * (ev.retrograde ? -1 : 1)),
+                     static_cast<int8_t>(ev.ziel));
+            ++zeichen;
+        }
+    }
+    QVERIFY(exakt > 0);
+    QVERIFY(stationen >= 6);    // u.a. Merkur dreimal rückläufig
+    QVERIFY(zeichen >= 12);     // Sonne durch alle Zeichen
+
+    // Auswahl: dieselben Ereignisse wie im Gesamtlauf
+    QVector<TransitEvent> nurZeichen;
+    TransitEvents::calculate(radix, startJD, endJD, EV_ZEICHEN, nurZeichen);
+    QCOMPARE(nurZeichen.size(), zeichen);
+    for (const TransitEvent& ev : nurZeichen) {
+        QCOMPARE(ev.art, static_cast<int8_t>(EV_ZEICHEN));
+    }
+
+    // Sonne: Widder-Eintritt um den 20.03.2024
+    auto widder = std::find_if(nurZeichen.begin(), nurZeichen.end(), [](const TransitEvent& ev) {
+        return ev.planet == P_SONNE && ev.ziel == iWIDDER;
+    });
+    QVERIFY(widder != nurZeichen.end());
+    const CalDateTime dt = Calendar::fromJD(widder->jd);
+    QCOMPARE(dt.monat, 3);
+    QCOMPARE(dt.tag, 20);
+}
+
+void TestChartCalc::testTransitTable() {
+    Radix radix;
+    initSampleRadix(radix, 4, 4, 1918, 2.333333333, 16.3667, 48.2000, TYP_KOCH);
+    QCOMPARE(ChartCalc::calculate(radix, nullptr, TYP_RADIX), ERR_OK);
+
+    const QVector<float> orbenPlanet(ASPEKTE * MAX_PLANET, 2.0f);
+    const QVector<float> orbenHaus(ASPEKTE * MAX_HAUS, 1.0f);
+    const double startJD = Calendar::toJD(2024, 1, 1, 0.0);
+    const double endJD = Calendar::toJD(2024, 7, 1, 0.0);
+    const EpheContext ctx = EpheContext::current();
+
+    TransitTable table;
+    const int n = table.build(radix, startJD, endJD, EV_ASPEKT_RADIX | EV_ASPEKT_HAUS,
+                              orbenPlanet, orbenHaus);
+    QCOMPARE(n, table.size());
+    QVERIFY(n > 0);
+    QCOMPARE(table.art.size(), n);
+    QCOMPARE(table.ende.size(), n);
+    QCOMPARE(table.flags.size(), n);
+
+    int offen = 0;
+    for (int i = 0; i < n; ++i) {
+        QVERIFY(table.beginn[i] >= startJD && table.beginn[i] <= table.ende[i]);
+        QVERIFY(table.ende[i] <= endJD);
+        if (table.exakt[i] != 0.0) {
+            QVERIFY(table.exakt[i] >= table.beginn[i] && table.exakt[i] <= table.ende[i]);
+        }
+        QCOMPARE(table.beginn[i] == startJD, (table.flags[i] & TT_OFFEN_BEGINN) != 0);
+        QCOMPARE(table.ende[i] == endJD, (table.flags[i] & TT_OFFEN_ENDE) != 0);
+        if (table.flags[i] & TT_OFFEN_BEGINN) {
+            ++offen;
+        }
+
+        // Zur Mitte der Periode im Orbis
+        if (table.art[i] == EV_ASPEKT_RADIX) {
+            const double mitte = table.exakt[i] != 0.0 ? table.exakt[i]
+                                                       : (table.beginn[i] + table.ende[i]) / 2.0;
+            const PlanetPos pos = ctx.calcPlanet(table.planet[i], mitte);
+            const double abstand = std::fabs(Calculations::minDist(pos.longitude, radix.planet[table.ziel[i]]));
+            QVERIFY(std::fabs(abstand - table.aspekt[i]) <= table.orb[i] + 0.01);
+        }
+    }
+    // Langsame Planeten stehen am Anfang schon im Orbis
+    QVERIFY(offen > 0);
+}
+
+void TestChartCalc::testRuecklauf() {
+    Radix radix;
+    initSampleRadix(radix, 4, 4, 1918, 2.333333333, 16.3667, 48.2000, TYP_KOCH);
+    QCOMPARE(ChartCalc::calculate(radix, nullptr, TYP_RADIX), ERR_OK);
+
+    const double startJD = Calendar::toJD(2024, 1, 1, 0.0);
+    const double endJD = Calendar::toJD(2025, 1, 1, 0.0);
+    const EpheContext ctx = EpheContext::current();
+
+    QVector<RuecklaufPeriode> perioden;
+    const int n = Ruecklauf::calculate(radix, startJD, endJD, perioden);
+    QCOMPARE(n, perioden.size());
+
+    int merkur = 0;
+    for (int i = 0; i < perioden.size(); ++i) {
+        const RuecklaufPeriode& p = perioden[i];
+        QVERIFY(p.beginn < p.ende);
+        if (i > 0) {
+            QVERIFY(perioden[i - 1].planet <= p.planet);
+        }
+        // Stationen: Geschwindigkeit null, dazwischen rückläufig
+        if (!(p.flags & TT_OFFEN_BEGINN)) {
+            QVERIFY(std::fabs(ctx.calcPlanet(p.planet, p.beginn).speed) < 0.001);
+        }
+        if (!(p.flags & TT_OFFEN_ENDE)) {
+            QVERIFY(std::fabs(ctx.calcPlanet(p.planet, p.ende).speed) < 0.001);
+        }
+        QVERIFY(ctx.calcPlanet(p.planet, (p.beginn + p.ende) / 2.0).speed < 0.0);
+        if (p.planet == P_MERKUR) {
+            ++merkur;
+        }
+    }
+    // Merkur 2024: April, August, November/Dezember
+    QCOMPARE(merkur, 3);
+    auto merkurApril = std::find_if(perioden.begin(), perioden.end(), [](const RuecklaufPeriode& p) {
+        return p.planet == P_MERKUR;
+    });
+    const CalDateTime r = Calendar::fromJD(merkurApril->beginn);
+    QCOMPARE(r.monat, 4);
+    QCOMPARE(r.tag, 1);
+
+    // Uranus seit August 2023 rückläufig: offener Beginn
+    auto uranus = std::find_if(perioden.begin(), perioden.end(), [](const RuecklaufPeriode& p) {
+        return p.planet == P_URANUS;
+    });
+    QVERIFY(uranus != perioden.end());
+    QVERIFY(uranus->flags & TT_OFFEN_BEGINN);
+    QCOMPARE(uranus->beginn, startJD);
+}
+
+void TestChartCalc::testSignTimeline() {
+    Radix radix;
+    initSampleRadix(radix, 4, 4, 1918, 2.333333333, 16.3667, 48.2000, TYP_KOCH);
+    QCOMPARE(ChartCalc::calculate(radix, nullptr, TYP_RADIX), ERR_OK);
+
+    const double startJD = Calendar::toJD(2024, 1, 1, 0.0);
+    const double endJD = Calendar::toJD(2025, 1, 1, 0.0);
+    const EpheContext ctx = EpheContext::current();
+
+    SignTimeline timeline;
+    QVERIFY(timeline.build(radix, startJD, endJD) > 0);
+    QCOMPARE(timeline.anzahlPlaneten(), static_cast<int>(radix.anzahlPlanet));
+
+    // Stichproben gegen die Ephemeride
+    for (double jd = startJD + 0.37; jd < endJD; jd += 7.3) {
+        for (int p = 0; p < timeline.anzahlPlaneten(); ++p) {
+            QCOMPARE(timeline.zeichen(p, jd), Calculations::getZeichen(ctx.calcPlanet(p, jd).longitude));
+        }
+    }
+
+    // Sonne: einmal durch den Tierkreis, Steinbock bis Steinbock
+    QVector<int8_t> folge;
+    QVERIFY(timeline.zeichen(P_SONNE, startJD, endJD, folge));
+    QCOMPARE(folge.size(), 13);
+    QCOMPARE(folge.first(), static_cast<int8_t>(iSTEINBOCK));
+    QCOMPARE(folge.last(), static_cast<int8_t>(iSTEINBOCK));
+
+    // Außerhalb des Zeitraums nicht abgedeckt
+    QVERIFY(!timeline.zeichen(P_SONNE, startJD - 10.0, endJD, folge));
+    QCOMPARE(timeline.zeichen(P_SONNE, endJD + 10.0), static_cast<int8_t>(-1));
+    QVERIFY(timeline.deckt(startJD, endJD));
+    QVERIFY(!timeline.deckt(startJD - 10.0, endJD));
+
+    // Sequenzen eines Multi-Transit-Laufs: nur Beginn/Ende sind voll berechnet
+    // (stündlich, damit auch der Mond Schritte ohne Aspektwechsel hat)
+    QVector<Radix> transits;
+    QVector<TransitAspekt> aspekte;
+    const int n = TransitCalc::calcMultiTransit(radix, QDate(2024, 1, 1), QTime(0, 0),
+                                                QDate(2024, 1, 8), QTime(0, 0),
+                                                TransitStep::fixed(INC_STUNDEN), &transits, &aspekte,
+                                                QVector<float>(ASPEKTE * MAX_PLANET, 2.0f),
+                                                QVector<float>(ASPEKTE * MAX_HAUS, 1.0f));
+    QCOMPARE(n, 7 * 24 + 1);
+    const Radix& erster = transits.first();
+    const Radix& letzter = transits.last();
+    QVERIFY(erster.anzahlPlanet > 0);
+    QVERIFY(letzter.anzahlPlanet > 0);
+    const auto leer = std::find_if(transits.cbegin(), transits.cend(),
+                                   [](const Radix& t) { return t.anzahlPlanet == 0; });
+    QVERIFY(leer != transits.cend());
+
+    QVERIFY(timeline.zeichen(P_SONNE, erster.jd, letzter.jd, folge));
+    QCOMPARE(timeline.folge(P_SONNE, erster, letzter), folge);
+    for (const TransitAspekt& ta : aspekte) {
+        const Radix& von = transits[ta.startIndex];
+        const Radix& bis = transits[ta.endIndex >= 0 ? ta.endIndex : ta.startIndex];
+        QVERIFY(von.anzahlPlanet > 0);
+        QVERIFY(bis.anzahlPlanet > 0);
+        QVERIFY(timeline.zeichen(ta.transitPlanet, von.jd, bis.jd, folge));
+        QCOMPARE(timeline.folge(ta.transitPlanet, von, bis), folge);
+    }
+
+    // Ohne Zeitleiste (abgebrochen oder leer): Zeichen von Beginn und Ende,
+    // nie die leeren Schritte dazwischen
+    SignTimeline abgebrochen;
+    bool abbruch = true;
+    QCOMPARE(abgebrochen.build(radix, startJD, endJD, &abbruch), 0);
+    QVERIFY(abgebrochen.isEmpty());
+    QVERIFY(!abgebrochen.deckt(erster.jd, letzter.jd));
+    QCOMPARE(abgebrochen.folge(P_SONNE, erster, letzter),
+             QVector<int8_t>({ erster.stzPlanet[P_SONNE] }));
+    QCOMPARE(abgebrochen.folge(P_SONNE, erster, *leer),
+             QVector<int8_t>({ erster.stzPlanet[P_SONNE] }));
+    int sequenzen = 0;
+    for (const TransitAspekt& ta : aspekte) {
+        if (ta.endIndex < 0) {
+            continue;
+        }
+        const Radix& von = transits[ta.startIndex];
+        const Radix& bis = transits[ta.endIndex];
+        QVector<int8_t> erwartet{ von.stzPlanet[ta.transitPlanet] };
+        if (bis.stzPlanet[ta.transitPlanet] != erwartet.first()) {
+            erwartet.append(bis.stzPlanet[ta.transitPlanet]);
+        }
+        QCOMPARE(abgebrochen.folge(ta.transitPlanet, von, bis), erwartet);
+        ++sequenzen;
+    }
+    QVERIFY(sequenzen > 0);
+}
+
+void TestChartCalc::testTextVorlage() {
+    // Zuordnung wie QString::arg: kleinste Nummer = erstes Argument
+    const TextVorlage v("%2 und %1, nochmal %2 (%3)");
+    QCOMPARE(v.anzahlPlatzhalter(), 3);
+    QCOMPARE(v.render({ u"A", u"B", u"C" }), QString("%2 und %1, nochmal %2 (%3)").arg("A", "B", "C"));
+
+    // Fehlende Argumente lassen Platzhalter stehen, Argumente werden nicht ersetzt
+    QCOMPARE(TextVorlage("%1 - %2").render({ u"%2" }), QString("%2 - %2"));
+    QCOMPARE(TextVorlage("100% %12%").render({ u"x" }), QString("100% x%"));
+    QCOMPARE(TextVorlage(QString()).render({ u"x" }), QString());
+
+    // Store: Vorlage bleibt bis zur Änderung, Standard-Text wird verglichen
+    AstroTextStore store;
+    store.setFilePath(QDir::temp().filePath("astrotext_test_nicht_vorhanden.dat"));
+    QVERIFY(store.load());
+    QCOMPARE(store.vorlage("de", "test.key", "Standard %1").render({ u"A" }), QString("Standard A"));
+    QCOMPARE(store.vorlage("de", "test.key", "Anders %1").render({ u"A" }), QString("Anders A"));
+    store.setOverride("de", "test.key", "Override %1");
+    QCOMPARE(store.vorlage("en", "test.key", "Anders %1").render({ u"A" }), QString("Override A"));
+    store.setOverride("de", "test.key", "Neu %1");
+    QCOMPARE(store.vorlage("en", "test.key", "Anders %1").render({ u"A" }), QString("Neu A"));
+    store.revertOverride("de", "test.key");
+    QCOMPARE(store.vorlage("de", "test.key", "Anders %1").render({ u"A" }), QString("Anders A"));
+
+    // ensureLoaded aus mehreren Threads: Datei wird genau einmal gelesen
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString datei = dir.filePath("astrotext.dat");
+    QFile f(datei);
+    QVERIFY(f.open(QIODevice::WriteOnly | QIODevice::Text));
+    f.write("[de]\ntest.key=Datei %1\n");
+    f.close();
+
+    AstroTextStore parallel;
+    parallel.setFilePath(datei);
+    const int vorher = parallel.revision();
+    const QVector<int> aufrufe(16);
+    const QList<QString> texte = QtConcurrent::blockingMapped(aufrufe, [&parallel](int) {
+        parallel.ensureLoaded();
+        return parallel.text("de", "test.key", "Standard");
+    });
+    QCOMPARE(parallel.revision(), vorher + 1);
+    for (const QString& text : texte) {
+        QCOMPARE(text, QString("Datei %1"));
+    }
+}
+
+// Radix-Analyse wie vor AstroReport: HTML direkt zusammengesetzt.
+// Einzige Abweichung: das Symbol vor "Wichtige Aspekte" (ASPEKT_SYMBOLS ist
+// nach Aspekt/30 indiziert, früher stand dort ASPEKT_SYMBOLS[SEXTIL]).
+static QString alteRadixAnalyse(const AstroTextAnalyzer& analyzer, const Radix& radix) {
+    astroTextStore().ensureLoaded();
+    const QString lang = AstroTextStore::systemLanguageCode();
+    const AstroTextStore& store = astroTextStore();
+
+    const QString signFont = astroFont().fontName();
+    const QString planetFont = astroFont().getPlanetSymbolFont().family();
+
+    QString html;
+    html += "<html><head><style>";
+    html += "body { font-family: Arial, sans-serif; font-size: 11pt; }";
+    html += "h1 { color: #2c3e50; font-size: 16pt; margin-top: 20px; }";
+    html += "h2 { color: #34495e; font-size: 14pt; margin-top: 15px; }";
+    html += "h3 { color: #7f8c8d; font-size: 12pt; margin-top: 10px; }";
+    html += "p { margin: 8px 0; line-height: 1.5; }";
+    html += QString(".planet-symbol { font-family: '%1'; font-size: 14pt; color: #e74c3c; }").arg(planetFont);
+    html += QString(".sign-symbol { font-family: '%1'; font-size: 17pt; color: #3498db; }").arg(signFont);
+    html += QString(".aspect-symbol { font-family: '%1'; font-size: 12pt; color: #9b59b6; }").arg(planetFont);
+    html += "</style></head><body>";
+
+    QString name = radix.rFix.vorname;
+    if (!radix.rFix.name.isEmpty()) {
+        if (!name.isEmpty())
+            name += " ";
+        name += radix.rFix.name;
+    }
+    if (name.isEmpty())
+        name = store.text(lang, "analysis.radix.default_name", "Radix");
+    html += QString("<h1>%1</h1>").arg(store.text(lang, "analysis.radix.title", "Horoskop-Analyse: %1").arg(name));
+
+    const int stunde = static_cast<int>(radix.rFix.zeit);
+    const int minute = static_cast<int>((radix.rFix.zeit - stunde) * 60);
+    const QString datumStr = QString("%1.%2.%3")
+                                 .arg(radix.rFix.tag, 2, 10, QChar('0'))
+                                 .arg(radix.rFix.monat, 2, 10, QChar('0'))
+                                 .arg(radix.rFix.jahr);
+    const QString zeitStr = QString("%1:%2")
+                                .arg(stunde, 2, 10, QChar('0'))
+                                .arg(minute, 2, 10, QChar('0'));
+    html += store.text(lang, "analysis.radix.born_line", "<p><i>Geboren am %1 um %2 Uhr in %3</i></p>")
+                .arg(datumStr).arg(zeitStr).arg(radix.rFix.ort);
+    html += "<hr>";
+
+    const int8_t sunSign = radix.stzPlanet[P_SONNE];
+    html += "<h2>" + QString(PLANET_SYMBOLS[P_SONNE]) + " " + store.text(lang, "analysis.label.sun_sign", "Sonnenzeichen")
+            + ": " + analyzer.getSignName(sunSign) + "</h2>";
+    html += QString("<p class='sign-symbol'>%1</p>").arg(astroFont().sternzeichenSymbol(sunSign));
+    html += analyzer.analyzeSunSign(sunSign);
+
+    const int8_t ascSign = radix.stzHaus[0];
+    html += "<h2>ASC " + store.text(lang, "analysis.label.ascendant", "Aszendent") + ": "
+            + analyzer.getSignName(ascSign) + "</h2>";
+    html += QString("<p class='sign-symbol'>%1</p>").arg(astroFont().sternzeichenSymbol(ascSign));
+    html += analyzer.analyzeAscendant(ascSign);
+
+    const int8_t moonSign = radix.stzPlanet[P_MOND];
+    html += "<h2>" + QString(PLANET_SYMBOLS[P_MOND]) + " " + store.text(lang, "analysis.label.moon_sign", "Mondzeichen")
+            + ": " + analyzer.getSignName(moonSign) + "</h2>";
+    html += QString("<p class='sign-symbol'>%1</p>").arg(astroFont().sternzeichenSymbol(moonSign));
+    html += analyzer.analyzeMoonSign(moonSign);
+
+    html += "<h2>" + QString(ASPEKT_SYMBOLS[SEXTIL / 30]) + " "
+            + store.text(lang, "analysis.label.important_aspects", "Wichtige Aspekte") + "</h2>";
+    html += store.text(lang, "analysis.radix.aspects_intro",
+                       "<p><i>Aspekte zeigen die Beziehungen zwischen den Planeten.</i></p>");
+    int aspectCount = 0;
+    const int numPlanets = radix.anzahlPlanet;
+    for (int i = 0; i < numPlanets; i++) {
+        for (int j = i + 1; j < numPlanets; j++) {
+            const int16_t aspect = radix.aspPlanet[i * numPlanets + j];
+            if (aspect == KEIN_ASP) {
+                continue;
+            }
+            html += QString("<h3><span class='planet-symbol'>%1</span> %2 <span "
+                            "class='aspect-symbol'>%3</span> <span "
+                            "class='planet-symbol'>%4</span> %5</h3>")
+                        .arg(PLANET_SYMBOLS[i])
+                        .arg(analyzer.getPlanetName(i))
+                        .arg(analyzer.getAspectName(aspect))
+                        .arg(PLANET_SYMBOLS[j])
+                        .arg(analyzer.getPlanetName(j));
+            html += analyzer.contextAspectText(i, radix.stzPlanet[i], j, radix.stzPlanet[j], aspect);
+            aspectCount++;
+        }
+    }
+    if (aspectCount == 0) {
+        html += store.text(lang, "analysis.radix.no_aspects", "<p><i>Keine signifikanten Aspekte gefunden.</i></p>");
+    }
+
+    static const int aspekte[] = { KONJUNKTION, HALBSEX, SEXTIL, QUADRATUR, TRIGON, QUINCUNX, OPOSITION };
+    static const double aspWinkel[] = { 0.0, 30.0, 60.0, 90.0, 120.0, 150.0, 180.0 };
+    for (int achse = 0; achse < 2; ++achse) {
+        const bool mc = (achse == 1);
+        const double achsePos = radix.haus[mc ? 9 : 0];
+        QString achseHtml;
+        for (int p = 0; p < numPlanets; p++) {
+            double diff = std::abs(radix.planet[p] - achsePos);
+            if (diff > 180.0) diff = 360.0 - diff;
+            for (int a = 0; a < ASPEKTE; ++a) {
+                if (std::abs(diff - aspWinkel[a]) <= 8.0) {
+                    const int16_t asp = aspekte[a];
+                    achseHtml += QString("<h3><span class='planet-symbol'>%1</span> %2 <span "
+                                         "class='aspect-symbol'>%3</span> %4</h3>")
+                                     .arg(PLANET_SYMBOLS[p])
+                                     .arg(analyzer.getPlanetName(p))
+                                     .arg(analyzer.getAspectName(asp))
+                                     .arg(mc ? "MC" : "ASC");
+                    achseHtml += "<p>" + (mc ? analyzer.getMcAspectText(p, asp) : analyzer.getAscAspectText(p, asp)) + "</p>";
+                    break;
+                }
+            }
+        }
+        if (!achseHtml.isEmpty()) {
+            html += QString("<h2>%1</h2>").arg(mc ? store.text(lang, "analysis.label.mc_aspects", "Aspekte zum MC")
+                                                  : store.text(lang, "analysis.label.asc_aspects", "Aspekte zum Aszendenten"));
+            html += achseHtml;
+        }
+    }
+
+    html += "</body></html>";
+    return html;
+}
+
+void TestChartCalc::testAstroReport() {
+    // HTML aus dem Puffer wie die frühere Radix-Analyse
+    const AuInit auinit;
+    QVector<Radix> charts(3);
+    initSampleRadix(charts[0], 4, 4, 1918, 2.333333333, 16.3667, 48.2000, TYP_KOCH);
+    initSampleRadix(charts[1], 20, 7, 1984, 14.5, -74.0060, 40.7128, TYP_KOCH);
+    initSampleRadix(charts[2], 1, 1, 2000, 0.0, 0.0, 51.4769, TYP_PLACIDUS);
+    charts[0].rFix.vorname = "Anna";
+    charts[0].rFix.name = "Beispiel";
+    charts[0].rFix.ort = "Wien";
+    for (Radix& radix : charts) {
+        QCOMPARE(ChartCalc::calculate(radix, nullptr, TYP_RADIX), ERR_OK);
+        ChartCalc::calcAspects(radix, auinit.orbenPlanet);
+    }
+
+    const AstroTextAnalyzer analyzer;
+    AstroReport report;
+    analyzer.buildReport(charts[0], report);
+    QVERIFY(!report.isEmpty());
+    const QString alt = alteRadixAnalyse(analyzer, charts[0]);
+    QCOMPARE(report.toHtml(), alt);
+    QCOMPARE(analyzer.analyzeRadix(charts[0]), alt);
+
+    // Mehrere Horoskope mit einem Puffer
+    QVector<int> reihenfolge;
+    const int anzahl = analyzer.buildReports(charts, [&](int i, const AstroReport& r) {
+        reihenfolge.append(i);
+        QCOMPARE(r.toHtml(), analyzer.analyzeRadix(charts[i]));
+    });
+    QCOMPARE(anzahl, 3);
+    QCOMPARE(reihenfolge, QVector<int>({ 0, 1, 2 }));
+
+    // Reiner Text: Überschriften, Stellung, Aspekte mit Rollen
+    const QString sonne = QString::fromUtf8(PLANET_SYMBOLS[P_SONNE]);
+    const QString mond = QString::fromUtf8(PLANET_SYMBOLS[P_MOND]);
+    AstroReport text;
+    ReportFragment f;
+    f.typ = ReportTyp::Titel;
+    f.text = u"Analyse";
+    text.fragment(f);
+    f = ReportFragment();
+    f.typ = ReportTyp::Stellung;
+    f.planet1 = P_SONNE;
+    f.zeichen = 0;
+    f.text = u"Sonnenzeichen";
+    f.name = u"Widder";
+    text.fragment(f);
+    f = ReportFragment();
+    f.typ = ReportTyp::Abschnitt;
+    f.text = u"Aspekte";
+    text.fragment(f);
+    f = ReportFragment();
+    f.typ = ReportTyp::Aspekt;
+    f.planet1 = P_SONNE;
+    f.planet2 = P_MOND;
+    f.aspekt = TRIGON;
+    f.rolle1 = 'T';
+    f.rolle2 = 'R';
+    f.text = u"Sonne";
+    f.name = u"Trigon";
+    f.zusatz = u"Mond";
+    text.fragment(f);
+    f.planet2 = -1;
+    f.rolle1 = 0;
+    f.zusatz = u"ASC";
+    text.fragment(f);
+    f = ReportFragment();
+    f.typ = ReportTyp::Trenner;
+    text.fragment(f);
+    QCOMPARE(text.toPlainText(),
+             "Analyse\n=======\n\n"
+             + sonne + " Sonnenzeichen: Widder " + QString::fromUtf8(STERNZEICHEN_SYMBOLS[0]) + "\n"
+             + "\nAspekte\n-------\n"
+             + "\n" + sonne + " Sonne (T) Trigon " + mond + " Mond (R)\n"
+             + "\n" + sonne + " Sonne Trigon ASC\n"
+             + "\n\n");
+
+    // Fließtext: Entities, Absatz-/Überschrift-Enden, offenes Tag am Ende
+    text.clear();
+    QVERIFY(text.isEmpty());
+    f = ReportFragment();
+    f.typ = ReportTyp::Text;
+    f.text = u"<p>A &amp; B&nbsp;&lt;C&gt; &quot;D&#39; &unbekannt;</p><h2>Titel</h2>Rest<br>Zeile<b";
+    text.fragment(f);
+    f.text = u"<p><i>Kursiv</i></p>";
+    text.fragment(f);
+    QCOMPARE(text.toPlainText(),
+             QString("A & B <C> \"D' &unbekannt;\nTitel\nRest\nZeile<b\nKursiv\n\n"));
+}
+
+void TestChartCalc::testSynastrie() {
+    Radix a;
+    Radix b;
+    initSampleRadix(a, 4, 4, 1918, 2.333333333, 16.3667, 48.2000, TYP_KOCH);
+    initSampleRadix(b, 20, 7, 1984, 14.5, -74.0060, 40.7128, TYP_KOCH);
+    QCOMPARE(ChartCalc::calculate(a, nullptr, TYP_RADIX), ERR_OK);
+    QCOMPARE(ChartCalc::calculate(b, nullptr, TYP_RADIX), ERR_OK);
+
+    const AuInit auinit;
+    const SynastrieErgebnis e = SynastrieCalc::calculate(a, b, auinit, TYP_SYNASTRIE);
+    QCOMPARE(e.anzahlA, static_cast<int>(a.anzahlPlanet));
+    QCOMPARE(e.anzahlB, static_cast<int>(b.anzahlPlanet));
+
+    // Matrix gegen direkte Suche mit den Synastrie-Orben
+    static const int aspekte[] = { KONJUNKTION, HALBSEX, SEXTIL, QUADRATUR, TRIGON, QUINCUNX, OPOSITION };
+    int anzahl = 0;
+    for (int pb = 0; pb < e.anzahlB; ++pb) {
+        for (int pa = 0; pa < e.anzahlA; ++pa) {
+            double diff = std::abs(a.planet[pa] - b.planet[pb]);
+            if (diff > 180.0) diff = 360.0 - diff;
+            int16_t erwartet = KEIN_ASP;
+            for (int k = 0; k < ASPEKTE; ++k) {
+                const float orb = auinit.orbenSPlanet[(pb * MAX_PLANET + pa) * ASPEKTE + k];
+                if (std::abs(diff - aspekte[k]) <= (orb > 0.0f ? orb : 8.0f)) {
+                    erwartet = static_cast<int16_t>(aspekte[k]);
+                    break;
+                }
+            }
+            QCOMPARE(e.planetAspekt(pa, pb), erwartet);
+            QVERIFY(std::abs(e.planetWinkel(pa, pb) - diff) < 1e-9);
+            if (erwartet != KEIN_ASP) {
+                ++anzahl;
+            }
+        }
+    }
+    QCOMPARE(e.aspekte.size(), anzahl);
+    for (int i = 1; i < e.aspekte.size(); ++i) {
+        const auto& v = e.aspekte[i - 1];
+        const auto& n = e.aspekte[i];
+        QVERIFY(std::tie(v.planetA, v.planetB) < std::tie(n.planetA, n.planetB));
+    }
+
+    // Composit: Halbsumme auf dem kürzeren Bogen
+    double sonne = std::abs(e.composit.planet[P_SONNE] - a.planet[P_SONNE]);
+    if (sonne > 180.0) sonne = 360.0 - sonne;
+    QVERIFY(std::abs(sonne - e.planetWinkel(P_SONNE, P_SONNE) / 2.0) < 1e-9);
+    QCOMPARE(e.composit.anzahlPlanet, a.anzahlPlanet);
+
+    // Davison: Radix für die zeitliche Mitte
+    QCOMPARE(e.davisonResult, ERR_OK);
+    QVERIFY(std::abs(e.davison.jd - (a.jd + b.jd) / 2.0) < 1e-4);
+    QVERIFY(std::abs(e.davison.rFix.breite - (a.rFix.breite + b.rFix.breite) / 2.0) < 1e-9);
+
+    // ChartCalc::calculate mit Partner (calcMissing): Standard-Orben, inkl. Davison
+    Radix c = a;
+    QCOMPARE(ChartCalc::calculate(c, &b, TYP_SYNASTRIE), ERR_OK);
+    QVERIFY(c.synastrieErgebnis);
+    QCOMPARE(c.synastrieErgebnis->umfang, static_cast<int>(SynastrieCalc::SYN_ALLE));
+    QCOMPARE(c.synastrieErgebnis->davisonResult, ERR_OK);
+    QVERIFY(std::abs(c.synastrieErgebnis->davison.jd - e.davison.jd) < 1e-9);
+
+    // calcMissing mit eingestellten Orben
+    AuInit eng = auinit;
+    eng.orbenSPlanet.fill(0.5f);
+    ChartCalc::calcMissing(c, &b, TYP_SYNASTRIE, eng);
+    QVERIFY(c.synastrieErgebnis->passtZu(c, b, TYP_SYNASTRIE, ChartPipeline::orbenHash(eng)));
+    QVERIFY(c.synastrieErgebnis->aspekte.size() < e.aspekte.size());
+
+    // Pipeline hängt nur die Kreuz-Aspekte an, ergebnis() übernimmt sie
+    ChartPipeline pipeline;
+    pipeline.calcAspects(a, auinit, TYP_SYNASTRIE, &b);
+    QVERIFY(a.synastrieErgebnis);
+    QVERIFY(a.synastrieErgebnis->passtZu(a, b, TYP_SYNASTRIE, ChartPipeline::orbenHash(auinit)));
+    QCOMPARE(a.synastrieErgebnis->umfang, static_cast<int>(SynastrieCalc::SYN_ASPEKTE));
+    QCOMPARE(SynastrieCalc::ergebnis(a, b, auinit).get(), a.synastrieErgebnis.get());
+    QVERIFY(SynastrieCalc::ergebnis(a, b, auinit, TYP_TRANSIT).get() != a.synastrieErgebnis.get());
+
+    // Composit und Davison auf Anfrage
+    const auto alle = SynastrieCalc::ergebnis(a, b, auinit, TYP_SYNASTRIE, SynastrieCalc::SYN_ALLE);
+    QVERIFY(alle.get() != a.synastrieErgebnis.get());
+    QCOMPARE(alle->umfang, static_cast<int>(SynastrieCalc::SYN_ALLE));
+    QCOMPARE(alle->davisonResult, ERR_OK);
+    QVERIFY(std::abs(alle->davison.jd - e.davison.jd) < 1e-9);
+    QCOMPARE(alle->aspekte.size(), a.synastrieErgebnis->aspekte.size());
+}
+
+void TestChartCalc::testSynastrieSuche() {
+    Radix anfrage;
+    initSampleRadix(anfrage, 4, 4, 1918, 2.333333333, 16.3667, 48.2000, TYP_KOCH);
+    QCOMPARE(ChartCalc::calculate(anfrage, nullptr, TYP_RADIX), ERR_OK);
+
+    // Künstliche Positionen über mehrere Blöcke, jede 7. Zeile fehlerhaft
+    const int anzahl = 2500;
+    BulkChartResult bulk;
+    bulk.rows.resize(anzahl);
+    for (int i = 0; i < anzahl; ++i) {
+        BulkChartRow& row = bulk.rows[i];
+        row.index = i;
+        row.result = (i % 7 == 3) ? ERR_CHART : ERR_OK;
+        for (int p = 0; p < MAX_PLANET; ++p) {
+            row.planet[p] = std::fmod(i * 37.7 + p * 101.3 + i * p * 0.61, 360.0);
+        }
+    }
+
+    SynastrieSuche suche;
+    QCOMPARE(suche.build(bulk), anzahl - (anzahl + 3) / 7);
+
+    // Referenz: Aspekte aus SynastrieCalc mit denselben Gewichten
+    const AuInit auinit;
+    const SynastrieGewichte gewichte;
+    auto punkte = [&](int i) {
+        Radix person;
+        person.allocate(MAX_PLANET);
+        for (int p = 0; p < MAX_PLANET; ++p) {
+            person.planet[p] = bulk.rows[i].planet[p];
+        }
+        const SynastrieErgebnis e = SynastrieCalc::calculate(anfrage, person, auinit, TYP_SYNASTRIE,
+                                                             SynastrieCalc::SYN_ASPEKTE);
+        double summe = 0.0;
+        for (const SynastrieAspekt& s : e.aspekte) {
+            const int k = s.aspekt / 30;
+            const float o = auinit.orbenSPlanet[(s.planetB * MAX_PLANET + s.planetA) * ASPEKTE + k];
+            const double gewicht = gewichte.planet[s.planetA] * gewichte.planet[s.planetB]
+                                 * gewichte.aspekt[k];
+            summe += gewicht * (1.0 - s.orb / (o > 0.0f ? o : 8.0f));
+        }
+        return summe;
+    };
+
+    const QVector<SynastrieTreffer> seriell = suche.rangliste(anfrage, auinit, gewichte, 0, -1, 1);
+    QCOMPARE(seriell.size(), suche.size());
+    for (int i = 0; i < seriell.size(); ++i) {
+        QVERIFY(bulk.rows[seriell[i].index].result == ERR_OK);
+        if (i > 0) {
+            QVERIFY(seriell[i - 1].punkte >= seriell[i].punkte);
+        }
+        if (i < 20 || i % 97 == 0) {
+            QVERIFY(std::abs(seriell[i].punkte - punkte(seriell[i].index)) < 1e-9);
+        }
+    }
+
+    // Parallel und gekürzt: dieselbe Spitze, ohne die ausgeschlossene Person
+    const int erster = seriell.first().index;
+    const QVector<SynastrieTreffer> top = suche.rangliste(anfrage, auinit, gewichte, 10, erster, 4);
+    QCOMPARE(top.size(), 10);
+    for (int i = 0; i < top.size(); ++i) {
+        QCOMPARE(top[i].index, seriell[i + 1].index);
+        QCOMPARE(top[i].punkte, seriell[i + 1].punkte);
+        QCOMPARE(top[i].anzahlAspekte, seriell[i + 1].anzahlAspekte);
+    }
+}
+
 QTEST_MAIN(TestChartCalc)
 #include "test_chart_calc.moc"
@@ -0,0 +1,797 @@
+/**
+ * @file test_golden.cpp
+ * @brief Golden-Output-Regression für ChartCalc/TransitCalc
+ *
+ * Vergleicht die aktuellen Ergebnisse mit Referenzdaten, die einmal mit
+ * einem bekannt guten Stand erzeugt wurden (tests/golden/*.tsv). Der Korpus
+ * besteht aus einigen tausend Horoskopen (alle Häusersysteme, 1800-2199,
+ * beide Hemisphären), Multi-Transit-Läufen und Rückläufigkeits-Perioden.
+ *
+ * Positionen werden mit Toleranz verglichen (Winkelabstand in Grad),
+ * diskrete Ergebnisse (Aspekte, Sequenzen, Perioden) exakt bzw. mit
+ * --step-tolerance Schritten Spielraum an den Sequenzgrenzen. Ausgegeben
+ * werden der größte Winkelfehler und die Laufzeit je Fall.
+ *
+ * Aufruf:
+ *   test_golden [--update] [--tolerance=GRAD] [--step-tolerance=N]
+ *               [--report=datei.json] [--golden=VERZ] [--ephe=VERZ]
+ *
+ * --update schreibt die Referenzdaten neu - nur mit einem Stand ausführen,
+ * dessen Ergebnisse als richtig gelten, und die Dateien mit einchecken:
+ *   test_golden --update --golden=<quellverzeichnis>/tests/golden
+ * Fehlen die Referenzdaten oder sind sie ungültig, schlägt der Test fehl.
+ */
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <QTextStream>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <tuple>
+
+#include "../src/core/calculations.h"
+#include "../src/core/chart_calc.h"
+#include "../src/core/swiss_eph.h"
+#include "../src/core/transit_calc.h"
+
+#ifndef ASTRO_GOLDEN_DIR
+#define ASTRO_GOLDEN_DIR "golden"
+#endif
+#ifndef ASTRO_EPHE_DIR
+#define ASTRO_EPHE_DIR "../swisseph/ephe"
+#endif
+
+using namespace astro;
+
+namespace {
+
+constexpr int GOLDEN_VERSION = 1;
+constexpr quint32 GOLDEN_SEED = 20260101;
+
+constexpr int ANZAHL_CHARTS = 3024;         // 216 je Häusersystem
+constexpr int ANZAHL_TRANSITE = 240;        // je 80 Tage-, Stunden-, Minuten-Läufe
+constexpr int ANZAHL_RUECKLAUF = 64;
+
+const int HAUS_SYSTEME[] = {
+    TYP_KOCH, TYP_PLACIDUS, TYP_EQUAL, TYP_EQUALMID, TYP_WHOLE, TYP_TOPOZEN,
+    TYP_CAMPANUS, TYP_MERIDIAN, TYP_REGIOMONTANUS, TYP_PORPHYRY, TYP_PORPHYRYN,
+    TYP_MORINUS, TYP_ALCABIT, TYP_NULL,
+};
+constexpr int ANZAHL_HAUS_SYSTEME = sizeof(HAUS_SYSTEME) / sizeof(HAUS_SYSTEME[0]);
+
+//==============================================================================
+// Hilfsfunktionen
+//==============================================================================
+
+QString zahl(double wert) {
+    return QString::number(wert, 'g', 17);
+}
+
+// Kleinster Winkelabstand in Grad (berücksichtigt den 0/360-Übergang)
+double winkelFehler(double a, double b) {
+    double d = std::fmod(std::fabs(a - b), 360.0);
+    return d > 180.0 ? 360.0 - d : d;
+}
+
+/**
+ * @brief Gleichverteilte Werte aus mt19937 (Ausgabe ist standardisiert,
+ *        die std::*_distribution-Klassen sind es nicht)
+ */
+class Zufall {
+public:
+    explicit Zufall(quint32 seed) : m_gen(seed) {}
+
+    double real(double von, double bis) {
+        return von + (bis - von) * (m_gen() / 4294967296.0);
+    }
+
+    int ganz(int von, int bis) {
+        return von + static_cast<int>(m_gen() % static_cast<quint32>(bis - von + 1));
+    }
+
+private:
+    std::mt19937 m_gen;
+};
+
+//==============================================================================
+// Fälle
+//==============================================================================
+
+struct Eingabe {
+    int tag = 1;
+    int monat = 1;
+    int jahr = 2000;
+    double zeit = 0.0;
+    double zone = 0.0;
+    double sommerzeit = 0.0;
+    double laenge = 0.0;
+    double breite = 0.0;
+    int hausSys = TYP_PLACIDUS;
+
+    QStringList felder() const {
+        return { QString::number(tag), QString::number(monat), QString::number(jahr),
+                 zahl(zeit), zahl(zone), zahl(sommerzeit), zahl(laenge), zahl(breite),
+                 QString::number(hausSys) };
+    }
+
+    static constexpr int ANZAHL_FELDER = 9;
+
+    static Eingabe aus(const QStringList& f, int pos) {
+        Eingabe e;
+        e.tag = f[pos].toInt();
+        e.monat = f[pos + 1].toInt();
+        e.jahr = f[pos + 2].toInt();
+        e.zeit = f[pos + 3].toDouble();
+        e.zone = f[pos + 4].toDouble();
+        e.sommerzeit = f[pos + 5].toDouble();
+        e.laenge = f[pos + 6].toDouble();
+        e.breite = f[pos + 7].toDouble();
+        e.hausSys = f[pos + 8].toInt();
+        return e;
+    }
+
+    void nach(Radix& radix) const {
+        radix.clear();
+        radix.hausSys = static_cast<int8_t>(hausSys);
+        radix.rFix.tag = static_cast<int16_t>(tag);
+        radix.rFix.monat = static_cast<int16_t>(monat);
+        radix.rFix.jahr = static_cast<int16_t>(jahr);
+        radix.rFix.zeit = zeit;
+        radix.rFix.zone = static_cast<float>(zone);
+        radix.rFix.sommerzeit = sommerzeit;
+        radix.rFix.laenge = laenge;
+        radix.rFix.breite = breite;
+    }
+
+    static Eingabe zufall(Zufall& z, int vonJahr, int bisJahr, int hausSys) {
+        Eingabe e;
+        e.jahr = z.ganz(vonJahr, bisJahr);
+        e.monat = z.ganz(1, 12);
+        e.tag = z.ganz(1, QDate(e.jahr, e.monat, 1).daysInMonth());
+        e.zeit = z.ganz(0, 24 * 60 - 1) / 60.0;
+        e.zone = z.ganz(-24, 24) * 0.5;
+        e.sommerzeit = z.ganz(0, 3) == 0 ? 1.0 : 0.0;
+        e.laenge = z.real(-180.0, 180.0);
+        // Polarkreis meiden - dort sind die Quadrantensysteme nicht definiert
+        e.breite = z.real(-66.0, 66.0);
+        e.hausSys = hausSys;
+        return e;
+    }
+};
+
+struct Ergebnis {
+    QString id;
+    QString art;
+    qint64 ns = 0;
+    double maxFehler = 0.0;
+    QStringList abweichungen;
+};
+
+//==============================================================================
+// Horoskope
+//==============================================================================
+
+struct ChartRef {
+    int result = ERR_OK;
+    double jd = 0.0;
+    double asc = 0.0;
+    double mc = 0.0;
+    QVector<double> planet;
+    QVector<double> haus;
+    QString aspekte;    // "i,j,a;..." für i < j
+};
+
+ChartRef rechneChart(const Eingabe& e, const AuInit& auinit) {
+    Radix radix;
+    e.nach(radix);
+
+    ChartRef ref;
+    ref.result = ChartCalc::calculate(radix, nullptr, TYP_RADIX);
+    if (ref.result != ERR_OK) {
+        return ref;
+    }
+    ChartCalc::calcAspects(radix, auinit.orbenPlanet);
+
+    ref.jd = radix.jd;
+    ref.asc = radix.asc;
+    ref.mc = radix.mc;
+    ref.planet = radix.planet.mid(0, radix.anzahlPlanet);
+    ref.haus = radix.haus.mid(0, MAX_HAUS);
+
+    QStringList asp;
+    const int n = radix.anzahlPlanet;
+    for (int i = 0; i < n; ++i) {
+        for (int j = i + 1; j < n; ++j) {
+            const int16_t a = radix.aspPlanet[i * n + j];
+            if (a != KEIN_ASP) {
+                asp << QString("%1,%2,%3").arg(i).arg(j).arg(a);
+            }
+        }
+    }
+    ref.aspekte = asp.isEmpty() ? QStringLiteral("-") : asp.join(';');
+    return ref;
+}
+
+QStringList chartFelder(const ChartRef& ref) {
+    QStringList f { QString::number(ref.result) };
+    if (ref.result != ERR_OK) {
+        return f;
+    }
+    f << zahl(ref.jd) << zahl(ref.asc) << zahl(ref.mc)
+      << QString::number(ref.planet.size()) << QString::number(ref.haus.size());
+    for (double p : ref.planet) {
+        f << zahl(p);
+    }
+    for (double h : ref.haus) {
+        f << zahl(h);
+    }
+    f << ref.aspekte;
+    return f;
+}
+
+void vergleicheChart(const QStringList& f, int pos, const ChartRef& ist,
+                     double toleranz, Ergebnis& erg) {
+    const int result = f[pos].toInt();
+    if (result != ist.result) {
+        erg.abweichungen << QString("result %1 statt %2").arg(ist.result).arg(result);
+        return;
+    }
+    if (result != ERR_OK) {
+        return;
+    }
+    if (f.size() < pos + 6 || f.size() < pos + 7 + f[pos + 4].toInt() + f[pos + 5].toInt()) {
+        erg.abweichungen << QStringLiteral("Zeile unvollständig");
+        return;
+    }
+
+    auto pruefe = [&](const QString& name, double soll, double wert) {
+        const double fehler = winkelFehler(soll, wert);
+        erg.maxFehler = qMax(erg.maxFehler, fehler);
+        if (fehler > toleranz) {
+            erg.abweichungen << QString("%1: %2 statt %3 (%4°)")
+                .arg(name, zahl(wert), zahl(soll)).arg(fehler, 0, 'g', 3);
+        }
+    };
+
+    // JD ist kein Winkel - absolut vergleichen (Toleranz in Tagen ~ Grad/360)
+    const double jdSoll = f[pos + 1].toDouble();
+    if (std::fabs(jdSoll - ist.jd) > toleranz / 360.0) {
+        erg.abweichungen << QString("jd: %1 statt %2").arg(zahl(ist.jd), zahl(jdSoll));
+    }
+    pruefe("asc", f[pos + 2].toDouble(), ist.asc);
+    pruefe("mc", f[pos + 3].toDouble(), ist.mc);
+
+    const int np = f[pos + 4].toInt();
+    const int nh = f[pos + 5].toInt();
+    if (np != ist.planet.size() || nh != ist.haus.size()) {
+        erg.abweichungen << QString("Anzahl Planeten/Häuser %1/%2 statt %3/%4")
+            .arg(ist.planet.size()).arg(ist.haus.size()).arg(np).arg(nh);
+        return;
+    }
+    int k = pos + 6;
+    for (int i = 0; i < np; ++i) {
+        pruefe(QString("planet[%1]").arg(i), f[k++].toDouble(), ist.planet[i]);
+    }
+    for (int i = 0; i < nh; ++i) {
+        pruefe(QString("haus[%1]").arg(i), f[k++].toDouble(), ist.haus[i]);
+    }
+    if (f[k] != ist.aspekte) {
+        erg.abweichungen << QString("aspekte: %1 statt %2").arg(ist.aspekte, f[k]);
+    }
+}
+
+//==============================================================================
+// Transite
+//==============================================================================
+
+struct TransitFall {
+    Eingabe radix;
+    QDate vonDatum;
+    QTime vonZeit;
+    QDate bisDatum;
+    QTime bisZeit;
+    int inkrement = INC_TAGE;
+};
+
+struct Sequenz {
+    int tp, rp, aspekt, isHaus, start, ende, retro;
+};
+
+QVector<Sequenz> rechneTransit(const TransitFall& fall, const AuInit& auinit, int& result) {
+    Radix radix;
+    fall.radix.nach(radix);
+    QVector<Sequenz> seq;
+
+    result = ChartCalc::calculate(radix, nullptr, TYP_RADIX);
+    if (result != ERR_OK) {
+        return seq;
+    }
+
+    QVector<TransitAspekt> aspekte;
+    result = TransitCalc::calcMultiTransit(radix, fall.vonDatum, fall.vonZeit,
+                                           fall.bisDatum, fall.bisZeit, fall.inkrement,
+                                           nullptr, &aspekte,
+                                           auinit.orbenTPlanet, auinit.orbenTHaus);
+    for (const TransitAspekt& ta : aspekte) {
+        seq.append({ ta.transitPlanet, ta.radixPlanet, ta.aspekt, ta.isHaus ? 1 : 0,
+                     ta.startIndex, ta.endIndex, ta.retrograde ? 1 : 0 });
+    }
+    // Reihenfolge ist kein Teil des Vertrags - sortiert vergleichen
+    std::sort(seq.begin(), seq.end(), [](const Sequenz& a, const Sequenz& b) {
+        return std::tie(a.isHaus, a.tp, a.rp, a.start, a.aspekt)
+             < std::tie(b.isHaus, b.tp, b.rp, b.start, b.aspekt);
+    });
+    return seq;
+}
+
+QString sequenzText(const QVector<Sequenz>& seq) {
+    if (seq.isEmpty()) {
+        return QStringLiteral("-");
+    }
+    QStringList teile;
+    for (const Sequenz& s : seq) {
+        teile << QString("%1,%2,%3,%4,%5,%6,%7")
+            .arg(s.tp).arg(s.rp).arg(s.aspekt).arg(s.isHaus).arg(s.start).arg(s.ende).arg(s.retro);
+    }
+    return teile.join(';');
+}
+
+QVector<Sequenz> sequenzAus(const QString& text) {
+    QVector<Sequenz> seq;
+    if (text == "-") {
+        return seq;
+    }
+    for (const QString& teil : text.split(';')) {
+        const QStringList v = teil.split(',');
+        if (v.size() == 7) {
+            seq.append({ v[0].toInt(), v[1].toInt(), v[2].toInt(), v[3].toInt(),
+                         v[4].toInt(), v[5].toInt(), v[6].toInt() });
+        }
+    }
+    return seq;
+}
+
+void vergleicheTransit(const QVector<Sequenz>& soll, const QVector<Sequenz>& ist,
+                       int schrittToleranz, Ergebnis& erg) {
+    if (soll.size() != ist.size()) {
+        erg.abweichungen << QString("%1 Sequenzen statt %2").arg(ist.size()).arg(soll.size());
+        return;
+    }
+    for (int i = 0; i < soll.size(); ++i) {
+        const Sequenz& a = soll[i];
+        const Sequenz& b = ist[i];
+        const bool gleich = a.tp == b.tp && a.rp == b.rp && a.aspekt == b.aspekt
+            && a.isHaus == b.isHaus && a.retro == b.retro
+            && std::abs(a.start - b.start) <= schrittToleranz
+            && std::abs(a.ende - b.ende) <= schrittToleranz;
+        if (!gleich) {
+            erg.abweichungen << QString("Sequenz %1: %2 statt %3")
+                .arg(i).arg(sequenzText({ b }), sequenzText({ a }));
+            return;
+        }
+    }
+}
+
+//==============================================================================
+// Rückläufigkeit
+//==============================================================================
+
+QString rueckText(const QVector<QPair<QDate, QDate>>& perioden) {
+    if (perioden.isEmpty()) {
+        return QStringLiteral("-");
+    }
+    QStringList teile;
+    for (const auto& p : perioden) {
+        teile << p.first.toString(Qt::ISODate) + ',' + p.second.toString(Qt::ISODate);
+    }
+    return teile.join(';');
+}
+
+//==============================================================================
+// Referenzdateien
+//==============================================================================
+
+QString kopf(const QString& art, const QString& spalten) {
+    return QString("# astrouni golden %1 v%2\n# %3\n").arg(art).arg(GOLDEN_VERSION).arg(spalten);
+}
+
+int schreibe(const QString& filepath, const QString& inhalt) {
+    QSaveFile file(filepath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        return ERR_FILE;
+    }
+    file.write(inhalt.toUtf8());
+    return file.commit() ? ERR_OK : ERR_FILE;
+}
+
+// Liefert die Datenzeilen; leer + ok=false wenn Datei/Version nicht passt
+QVector<QStringList> lese(const QString& filepath, const QString& art, bool& ok) {
+    QVector<QStringList> zeilen;
+    ok = false;
+
+    QFile file(filepath);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        return zeilen;
+    }
+    QTextStream in(&file);
+    in.setEncoding(QStringConverter::Utf8);
+
+    const QString erwartet = QString("# astrouni golden %1 v%2").arg(art).arg(GOLDEN_VERSION);
+    if (in.readLine() != erwartet) {
+        QTextStream(stderr) << filepath << ": falsches Format/Version (erwartet \""
+                            << erwartet << "\")\n";
+        return zeilen;
+    }
+    while (!in.atEnd()) {
+        const QString line = in.readLine();
+        if (line.isEmpty() || line.startsWith('#')) {
+            continue;
+        }
+        zeilen.append(line.split('\t'));
+    }
+    ok = true;
+    return zeilen;
+}
+
+//==============================================================================
+// Korpus erzeugen
+//==============================================================================
+
+int erzeuge(const QString& dir, const AuInit& auinit) {
+    QDir().mkpath(dir);
+    Zufall z(GOLDEN_SEED);
+    QTextStream out(stdout);
+
+    // Horoskope
+    QString charts = kopf("charts", "id tag monat jahr zeit zone sommerzeit laenge breite hausSys"
+                                    " | result jd asc mc nPlanet nHaus planet[] haus[] aspekte");
+    for (int i = 0; i < ANZAHL_CHARTS; ++i) {
+        const Eingabe e = Eingabe::zufall(z, 1800, 2199, HAUS_SYSTEME[i % ANZAHL_HAUS_SYSTEME]);
+        QStringList f { QString("C%1").arg(i, 4, 10, QChar('0')) };
+        f << e.felder() << chartFelder(rechneChart(e, auinit));
+        charts += f.join('\t') + '\n';
+    }
+    if (schreibe(dir + "/charts.tsv", charts) != ERR_OK) {
+        return ERR_FILE;
+    }
+    out << "charts.tsv: " << ANZAHL_CHARTS << " Fälle\n";
+    out.flush();
+
+    // Multi-Transite: ein Jahr tageweise, ein Tag stündlich, drei Stunden minütlich.
+    // Stunden/Minuten bleiben innerhalb eines Tages (Referenzen stammen aus der
+    // Zeit, als incDate dort das Datum nicht weiterschaltete).
+    QString transite = kopf("transits", "id radix[9] vonDatum vonZeit bisDatum bisZeit inkrement"
+                                        " | result sequenzen(tp,rp,asp,haus,start,ende,retro)");
+    for (int i = 0; i < ANZAHL_TRANSITE; ++i) {
+        TransitFall fall;
+        fall.radix = Eingabe::zufall(z, 1900, 2050, HAUS_SYSTEME[i % ANZAHL_HAUS_SYSTEME]);
+        fall.vonDatum = QDate(z.ganz(1950, 2099), z.ganz(1, 12), z.ganz(1, 28));
+        switch (i % 3) {
+            case 0:
+                fall.inkrement = INC_TAGE;
+                fall.vonZeit = QTime(12, 0);
+                fall.bisDatum = fall.vonDatum.addYears(1);
+                fall.bisZeit = fall.vonZeit;
+                break;
+            case 1:
+                fall.inkrement = INC_STUNDEN;
+                fall.vonZeit = QTime(0, 0);
+                fall.bisDatum = fall.vonDatum;
+                fall.bisZeit = QTime(22, 0);
+                break;
+            default:
+                fall.inkrement = INC_MINUTEN;
+                fall.vonZeit = QTime(z.ganz(0, 20), 0);
+                fall.bisDatum = fall.vonDatum;
+                fall.bisZeit = fall.vonZeit.addSecs(3 * 3600);
+                break;
+        }
+
+        int result = ERR_OK;
+        const QVector<Sequenz> seq = rechneTransit(fall, auinit, result);
+
+        QStringList f { QString("T%1").arg(i, 4, 10, QChar('0')) };
+        f << fall.radix.felder()
+          << fall.vonDatum.toString(Qt::ISODate) << fall.vonZeit.toString("HH:mm")
+          << fall.bisDatum.toString(Qt::ISODate) << fall.bisZeit.toString("HH:mm")
+          << QString::number(fall.inkrement)
+          << QString::number(result) << sequenzText(seq);
+        transite += f.join('\t') + '\n';
+    }
+    if (schreibe(dir + "/transits.tsv", transite) != ERR_OK) {
+        return ERR_FILE;
+    }
+    out << "transits.tsv: " << ANZAHL_TRANSITE << " Fälle\n";
+    out.flush();
+
+    // Rückläufigkeit: Merkur bis Pluto, je zwei Jahre
+    QString rueck = kopf("retrograde", "id planet vonDatum bisDatum | perioden(von,bis)");
+    for (int i = 0; i < ANZAHL_RUECKLAUF; ++i) {
+        const int planet = P_MERKUR + i % (P_PLUTO - P_MERKUR + 1);
+        const QDate von(z.ganz(1900, 2098), z.ganz(1, 12), z.ganz(1, 28));
+        const QDate bis = von.addYears(2);
+
+        QVector<QPair<QDate, QDate>> perioden;
+        TransitCalc::calcRetrograde(planet, von, bis, perioden);
+
+        QStringList f { QString("R%1").arg(i, 4, 10, QChar('0')) };
+        f << QString::number(planet) << von.toString(Qt::ISODate) << bis.toString(Qt::ISODate)
+          << rueckText(perioden);
+        rueck += f.join('\t') + '\n';
+    }
+    if (schreibe(dir + "/retrograde.tsv", rueck) != ERR_OK) {
+        return ERR_FILE;
+    }
+    out << "retrograde.tsv: " << ANZAHL_RUECKLAUF << " Fälle\n";
+    return ERR_OK;
+}
+
+//==============================================================================
+// Korpus prüfen
+//==============================================================================
+
+void pruefeCharts(const QVector<QStringList>& zeilen, const AuInit& auinit,
+                  double toleranz, QVector<Ergebnis>& ergebnisse) {
+    for (const QStringList& f : zeilen) {
+        Ergebnis erg;
+        erg.id = f.value(0);
+        erg.art = QStringLiteral("chart");
+        if (f.size() < 1 + Eingabe::ANZAHL_FELDER + 1) {
+            erg.abweichungen << QStringLiteral("Zeile unvollständig");
+            ergebnisse.append(erg);
+            continue;
+        }
+        const Eingabe e = Eingabe::aus(f, 1);
+
+        QElapsedTimer timer;
+        timer.start();
+        const ChartRef ist = rechneChart(e, auinit);
+        erg.ns = timer.nsecsElapsed();
+
+        vergleicheChart(f, 1 + Eingabe::ANZAHL_FELDER, ist, toleranz, erg);
+        ergebnisse.append(erg);
+    }
+}
+
+void pruefeTransite(const QVector<QStringList>& zeilen, const AuInit& auinit,
+                    int schrittToleranz, QVector<Ergebnis>& ergebnisse) {
+    constexpr int FELDER = 1 + Eingabe::ANZAHL_FELDER + 5 + 2;
+    for (const QStringList& f : zeilen) {
+        Ergebnis erg;
+        erg.id = f.value(0);
+        erg.art = QStringLiteral("transit");
+        if (f.size() < FELDER) {
+            erg.abweichungen << QStringLiteral("Zeile unvollständig");
+            ergebnisse.append(erg);
+            continue;
+        }
+
+        TransitFall fall;
+        int k = 1;
+        fall.radix = Eingabe::aus(f, k);
+        k += Eingabe::ANZAHL_FELDER;
+        fall.vonDatum = QDate::fromString(f[k++], Qt::ISODate);
+        fall.vonZeit = QTime::fromString(f[k++], "HH:mm");
+        fall.bisDatum = QDate::fromString(f[k++], Qt::ISODate);
+        fall.bisZeit = QTime::fromString(f[k++], "HH:mm");
+        fall.inkrement = f[k++].toInt();
+        const int resultSoll = f[k++].toInt();
+        const QVector<Sequenz> soll = sequenzAus(f[k]);
+
+        int result = ERR_OK;
+        QElapsedTimer timer;
+        timer.start();
+        const QVector<Sequenz> ist = rechneTransit(fall, auinit, result);
+        erg.ns = timer.nsecsElapsed();
+
+        if (result != resultSoll) {
+            erg.abweichungen << QString("result %1 statt %2").arg(result).arg(resultSoll);
+        } else {
+            vergleicheTransit(soll, ist, schrittToleranz, erg);
+        }
+        ergebnisse.append(erg);
+    }
+}
+
+void pruefeRuecklauf(const QVector<QStringList>& zeilen, QVector<Ergebnis>& ergebnisse) {
+    for (const QStringList& f : zeilen) {
+        Ergebnis erg;
+        erg.id = f.value(0);
+        erg.art = QStringLiteral("retrograde");
+        if (f.size() < 5) {
+            erg.abweichungen << QStringLiteral("Zeile unvollständig");
+            ergebnisse.append(erg);
+            continue;
+        }
+
+        QVector<QPair<QDate, QDate>> perioden;
+        QElapsedTimer timer;
+        timer.start();
+        TransitCalc::calcRetrograde(f[1].toInt(), QDate::fromString(f[2], Qt::ISODate),
+                                    QDate::fromString(f[3], Qt::ISODate), perioden);
+        erg.ns = timer.nsecsElapsed();
+
+        const QString ist = rueckText(perioden);
+        if (ist != f[4]) {
+            erg.abweichungen << QString("perioden: %1 statt %2").arg(ist, f[4]);
+        }
+        ergebnisse.append(erg);
+    }
+}
+
+//==============================================================================
+// Bericht
+//==============================================================================
+
+void zusammenfassung(const QVector<Ergebnis>& ergebnisse) {
+    QTextStream out(stdout);
+    out << qSetFieldWidth(12) << Qt::left << "Art"
+        << qSetFieldWidth(8) << Qt::right << "Fälle" << "Fehler"
+        << qSetFieldWidth(14) << "Gesamt ms" << "Mittel us" << "p95 us" << "Max us"
+        << qSetFieldWidth(16) << "Max Winkel °" << qSetFieldWidth(0) << "  Langsamster\n";
+
+    for (const QString& art : { QStringLiteral("chart"), QStringLiteral("transit"),
+                                QStringLiteral("retrograde") }) {
+        QVector<const Ergebnis*> teil;
+        for (const Ergebnis& e : ergebnisse) {
+            if (e.art == art) {
+                teil.append(&e);
+            }
+        }
+        if (teil.isEmpty()) {
+            continue;
+        }
+
+        std::sort(teil.begin(), teil.end(), [](const Ergebnis* a, const Ergebnis* b) {
+            return a->ns < b->ns;
+        });
+        qint64 gesamt = 0;
+        int fehler = 0;
+        double maxWinkel = 0.0;
+        for (const Ergebnis* e : teil) {
+            gesamt += e->ns;
+            fehler += e->abweichungen.isEmpty() ? 0 : 1;
+            maxWinkel = qMax(maxWinkel, e->maxFehler);
+        }
+        const qint64 p95 = teil[qMin(teil.size() - 1, teil.size() * 95 / 100)]->ns;
+
+        out << qSetFieldWidth(12) << Qt::left << art
+            << qSetFieldWidth(8) << Qt::right << teil.size() << fehler
+            << qSetFieldWidth(14) << QString::number(gesamt / 1e6, 'f', 1)
+            << QString::number(gesamt / 1e3 / teil.size(), 'f', 1)
+            << QString::number(p95 / 1e3, 'f', 1)
+            << QString::number(teil.last()->ns / 1e3, 'f', 1)
+            << qSetFieldWidth(16) << QString::number(maxWinkel, 'g', 3)
+            << qSetFieldWidth(0) << "  " << teil.last()->id << "\n";
+    }
+}
+
+QJsonDocument bericht(const QVector<Ergebnis>& ergebnisse, double toleranz) {
+    QJsonArray faelle;
+    double maxWinkel = 0.0;
+    int fehler = 0;
+    for (const Ergebnis& e : ergebnisse) {
+        QJsonObject o;
+        o["id"] = e.id;
+        o["kind"] = e.art;
+        o["time_ns"] = e.ns;
+        o["max_angular_error"] = e.maxFehler;
+        o["ok"] = e.abweichungen.isEmpty();
+        if (!e.abweichungen.isEmpty()) {
+            o["diffs"] = QJsonArray::fromStringList(e.abweichungen);
+            ++fehler;
+        }
+        faelle.append(o);
+        maxWinkel = qMax(maxWinkel, e.maxFehler);
+    }
+
+    QJsonObject root;
+    root["version"] = GOLDEN_VERSION;
+    root["tolerance_deg"] = toleranz;
+    root["cases"] = ergebnisse.size();
+    root["failures"] = fehler;
+    root["max_angular_error"] = maxWinkel;
+    root["results"] = faelle;
+    return QJsonDocument(root);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    QCoreApplication app(argc, argv);
+
+    bool update = false;
+    double toleranz = 1e-6;     // Grad (~0.004")
+    int schrittToleranz = 0;
+    QString reportFile;
+    QString goldenDir = QStringLiteral(ASTRO_GOLDEN_DIR);
+    QString epheDir = QStringLiteral(ASTRO_EPHE_DIR);
+
+    for (const QString& arg : app.arguments().mid(1)) {
+        if (arg == "--update") {
+            update = true;
+        } else if (arg.startsWith("--tolerance=")) {
+            toleranz = arg.section('=', 1).toDouble();
+        } else if (arg.startsWith("--step-tolerance=")) {
+            schrittToleranz = arg.section('=', 1).toInt();
+        } else if (arg.startsWith("--report=")) {
+            reportFile = arg.section('=', 1);
+        } else if (arg.startsWith("--golden=")) {
+            goldenDir = arg.section('=', 1);
+        } else if (arg.startsWith("--ephe=")) {
+            epheDir = arg.section('=', 1);
+        } else {
+            QTextStream(stderr) << "Unknown argument: " << arg << "\n";
+            return 2;
+        }
+    }
+
+    // Nur die mitgelieferten Ephemeriden - kein Netz, keine Systempfade
+    if (!QFile::exists(epheDir + "/sepl_18.se1")) {
+        QTextStream(stderr) << "Ephemeriden nicht gefunden: " << epheDir << "\n";
+        return 1;
+    }
+    swissEph().setEphePath(epheDir);
+
+    AuInit auinit;
+
+    if (update) {
+        if (erzeuge(goldenDir, auinit) != ERR_OK) {
+            QTextStream(stderr) << "Cannot write golden files in: " << goldenDir << "\n";
+            return 3;
+        }
+        return 0;
+    }
+
+    bool okCharts = false;
+    bool okTransite = false;
+    bool okRueck = false;
+    const auto charts = lese(goldenDir + "/charts.tsv", "charts", okCharts);
+    const auto transite = lese(goldenDir + "/transits.tsv", "transits", okTransite);
+    const auto rueck = lese(goldenDir + "/retrograde.tsv", "retrograde", okRueck);
+    if (!okCharts || !okTransite || !okRueck) {
+        QTextStream(stderr) << "Keine gültigen Referenzdaten in " << goldenDir
+                            << " - mit --update erzeugen\n";
+        return 1;
+    }
+
+    QVector<Ergebnis> ergebnisse;
+    ergebnisse.reserve(charts.size() + transite.size() + rueck.size());
+    pruefeCharts(charts, auinit, toleranz, ergebnisse);
+    pruefeTransite(transite, auinit, schrittToleranz, ergebnisse);
+    pruefeRuecklauf(rueck, ergebnisse);
+
+    zusammenfassung(ergebnisse);
+
+    int fehler = 0;
+    QTextStream err(stderr);
+    for (const Ergebnis& e : ergebnisse) {
+        if (e.abweichungen.isEmpty()) {
+            continue;
+        }
+        if (++fehler <= 20) {
+            err << "FAIL " << e.id << ": " << e.abweichungen.join("; ") << "\n";
+        }
+    }
+    if (fehler > 20) {
+        err << "... " << fehler - 20 << " weitere\n";
+    }
+
+    if (!reportFile.isEmpty()) {
+        QFile file(reportFile);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            err << "Cannot write file: " << reportFile << "\n";
+            return 3;
+        }
+        file.write(bericht(ergebnisse, toleranz).toJson(QJsonDocument::Indented));
+    }
+
+    return fehler == 0 ? 0 : 1;
+}
@@ -0,0 +1,203 @@
+/**
+ * @file test_legacy_io.cpp
+ * @brief Unit Tests für die Einstellungsdateien (astroset.dat, astroini.dat)
+ */
+
+#include <QtTest>
+#include "../src/data/legacy_io.h"
+#include "../src/core/constants.h"
+#include <QtEndian>
+
+using namespace astro;
+
+class TestLegacyIO : public QObject {
+    Q_OBJECT
+
+private slots:
+    void testSettingsRoundTrip();
+    void testSettingsChecksum();
+    void testLegacyIniMigration();
+};
+
+namespace {
+
+constexpr int SET_HEADER_SIZE = 32;  // Kopf von astroset.dat (Version 1)
+
+// Orben mit unterscheidbaren Werten je Array und Index
+void fuelleOrben(AuInit& auinit) {
+    QVector<float>* arrays[] = {
+        &auinit.orbenPlanet, &auinit.orbenHaus, &auinit.orbenTPlanet,
+        &auinit.orbenTHaus, &auinit.orbenSPlanet, &auinit.orbenSHaus
+    };
+    for (int a = 0; a < 6; ++a) {
+        QVector<float>& orben = *arrays[a];
+        for (int i = 0; i < orben.size(); ++i) {
+            orben[i] = a * 10.0f + (i % 40) * 0.25f;
+        }
+    }
+}
+
+void vergleiche(const AuInit& ist, const AuInit& soll) {
+    QCOMPARE(ist.sSelHaus, soll.sSelHaus);
+    QCOMPARE(ist.sSelHoro, soll.sSelHoro);
+    QCOMPARE(ist.sRotRadix, soll.sRotRadix);
+    QCOMPARE(ist.sAspekte, soll.sAspekte);
+    QCOMPARE(ist.sTeilung, soll.sTeilung);
+    QCOMPARE(ist.sOptionen, soll.sOptionen);
+    QCOMPARE(ist.orbenPlanet, soll.orbenPlanet);
+    QCOMPARE(ist.orbenHaus, soll.orbenHaus);
+    QCOMPARE(ist.orbenTPlanet, soll.orbenTPlanet);
+    QCOMPARE(ist.orbenTHaus, soll.orbenTHaus);
+    QCOMPARE(ist.orbenSPlanet, soll.orbenSPlanet);
+    QCOMPARE(ist.orbenSHaus, soll.orbenSHaus);
+}
+
+} // namespace
+
+void TestLegacyIO::testSettingsRoundTrip() {
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    LegacyIO io;
+    io.setDataPath(dir.path());
+
+    AuInit geschrieben;
+    geschrieben.sSelHaus = TYP_KOCH;
+    geschrieben.sSelHoro = TYP_TRANSIT;
+    geschrieben.sRotRadix = 1;
+    geschrieben.sAspekte = S_KON | S_TRI;
+    geschrieben.sTeilung = 3;
+    geschrieben.sOptionen = 1;
+    fuelleOrben(geschrieben);
+    QCOMPARE(io.writeSettings(geschrieben), ERR_OK);
+    QVERIFY(QFile::exists(dir.filePath(SETDAT)));
+
+    AuInit gelesen;
+    QCOMPARE(io.readSettings(gelesen), ERR_OK);
+    vergleiche(gelesen, geschrieben);
+
+    // readIni nimmt astroset.dat, ohne astroini.dat anzufassen
+    AuInit ini;
+    QCOMPARE(io.readIni(ini), ERR_OK);
+    vergleiche(ini, geschrieben);
+    QVERIFY(!QFile::exists(dir.filePath(INIDAT)));
+
+    // Falsch dimensionierte Orben werden nicht gespeichert
+    AuInit falsch = geschrieben;
+    falsch.orbenHaus.resize(10);
+    QCOMPARE(io.writeSettings(falsch), ERR_ORBEN);
+    QCOMPARE(io.readSettings(gelesen), ERR_OK);
+    vergleiche(gelesen, geschrieben);
+}
+
+void TestLegacyIO::testSettingsChecksum() {
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    LegacyIO io;
+    io.setDataPath(dir.path());
+
+    AuInit geschrieben;
+    fuelleOrben(geschrieben);
+    QCOMPARE(io.writeSettings(geschrieben), ERR_OK);
+
+    QFile datei(dir.filePath(SETDAT));
+    QVERIFY(datei.open(QIODevice::ReadOnly));
+    const QByteArray original = datei.readAll();
+    datei.close();
+    QVERIFY(original.size() > SET_HEADER_SIZE + 1000);
+
+    auto schreibe = [&datei](const QByteArray& inhalt) {
+        QVERIFY(datei.open(QIODevice::WriteOnly | QIODevice::Truncate));
+        QCOMPARE(datei.write(inhalt), qint64(inhalt.size()));
+        datei.close();
+    };
+
+    // Ein Byte in den Nutzdaten gekippt: Prüfsumme schlägt an, Ziel bleibt unverändert
+    for (int offset : { SET_HEADER_SIZE, SET_HEADER_SIZE + 1000, int(original.size()) - 1 }) {
+        QByteArray kaputt = original;
+        kaputt[offset] = char(kaputt[offset] ^ 0x01);
+        schreibe(kaputt);
+
+        AuInit ziel;
+        const AuInit vorher = ziel;
+        QCOMPARE(io.readSettings(ziel), ERR_ORBEN);
+        vergleiche(ziel, vorher);
+    }
+
+    // Kennung, Version und Länge
+    QByteArray kaputt = original;
+    kaputt[0] = 'X';
+    schreibe(kaputt);
+    AuInit ziel;
+    QCOMPARE(io.readSettings(ziel), ERR_ORBEN);
+
+    kaputt = original;
+    qToLittleEndian<quint16>(2, kaputt.data() + 4);
+    schreibe(kaputt);
+    QCOMPARE(io.readSettings(ziel), ERR_ORBEN);
+
+    schreibe(original.left(original.size() - 4));
+    QCOMPARE(io.readSettings(ziel), ERR_ORBEN);
+
+    schreibe(original);
+    QCOMPARE(io.readSettings(ziel), ERR_OK);
+    vergleiche(ziel, geschrieben);
+
+    QVERIFY(QFile::remove(dir.filePath(SETDAT)));
+    QCOMPARE(io.readSettings(ziel), ERR_FILE);
+}
+
+void TestLegacyIO::testLegacyIniMigration() {
+    // Mitgeliefertes astroini.dat im alten Format
+    const QString quelle = QStringLiteral(ASTRO_DATA_DIR "/") + INIDAT;
+    QFile alt(quelle);
+    QVERIFY(alt.open(QIODevice::ReadOnly));
+    const QByteArray rohdaten = alt.readAll();
+    alt.close();
+
+    // 20 Byte Kopf (Version, sSelHaus, sSelHoro, sRotRadix, sAspekte, sTeilung), dann die Orben
+    const int anzahlPlanet = MAX_PLANET * MAX_PLANET * ASPEKTE;
+    const int anzahlHaus = MAX_PLANET * MAX_HAUS * ASPEKTE;
+    QCOMPARE(int(rohdaten.size()), 20 + 3 * (anzahlPlanet + anzahlHaus) * int(sizeof(float)));
+    const uchar* roh = reinterpret_cast<const uchar*>(rohdaten.constData());
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    QVERIFY(QFile::copy(quelle, dir.filePath(INIDAT)));
+    LegacyIO io;
+    io.setDataPath(dir.path());
+
+    // Nur lesen: gleiche Werte, aber kein astroset.dat
+    AuInit gelesen;
+    QCOMPARE(io.readIni(gelesen, false), ERR_OK);
+    QVERIFY(!QFile::exists(dir.filePath(SETDAT)));
+
+    AuInit migriert;
+    QCOMPARE(io.readIni(migriert), ERR_OK);
+    vergleiche(gelesen, migriert);
+    QCOMPARE(migriert.sSelHaus, qFromLittleEndian<qint16>(roh + 2));
+    QCOMPARE(migriert.sSelHoro, qFromLittleEndian<qint16>(roh + 4));
+    QCOMPARE(migriert.sRotRadix, qFromLittleEndian<qint16>(roh + 6));
+    QCOMPARE(migriert.sAspekte, qFromLittleEndian<qint16>(roh + 8));
+    QCOMPARE(migriert.sTeilung, qFromLittleEndian<qint16>(roh + 10));
+
+    QVector<float> orbenPlanet(anzahlPlanet);
+    QVector<float> orbenSHaus(anzahlHaus);
+    qFromLittleEndian<float>(roh + 20, anzahlPlanet, orbenPlanet.data());
+    qFromLittleEndian<float>(roh + rohdaten.size() - anzahlHaus * sizeof(float), anzahlHaus, orbenSHaus.data());
+    QCOMPARE(migriert.orbenPlanet, orbenPlanet);
+    QCOMPARE(migriert.orbenSHaus, orbenSHaus);
+    QCOMPARE(int(migriert.orbenHaus.size()), anzahlHaus);
+    QCOMPARE(int(migriert.orbenTPlanet.size()), anzahlPlanet);
+    QCOMPARE(int(migriert.orbenTHaus.size()), anzahlHaus);
+    QCOMPARE(int(migriert.orbenSPlanet.size()), anzahlPlanet);
+
+    // Migration hat astroset.dat geschrieben; ohne astroini.dat wird es gelesen
+    QVERIFY(QFile::exists(dir.filePath(SETDAT)));
+    QVERIFY(QFile::remove(dir.filePath(INIDAT)));
+    AuInit neu;
+    QCOMPARE(io.readIni(neu), ERR_OK);
+    vergleiche(neu, migriert);
+}
+
+QTEST_MAIN(TestLegacyIO)
+#include "test_legacy_io.moc"
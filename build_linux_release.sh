@@ -256,13 +256,13 @@ elif (command -v qtpaths6 &>/dev/null || command -v qtpaths &>/dev/null) && comm
     done < <(ldd "$target" 2>/dev/null | awk '/=>/ {print $(NF-1)}' | grep -E '^/' || true)
   }
 
-  # Qt-abhängige libs des Binaries kopieren (Qt6::Core/Gui/Widgets/PrintSupport)
+  # Qt-abhängige libs des Binaries kopieren (Qt6::Core/Gui/Widgets/PrintSupport/Concurrent)
   for lib in $(ldd "$DIST_DIR/astrouni2026" | awk '/Qt6/ {print $3}'); do
     [ -e "$lib" ] && copy_lib "$lib"
   done
 
   # Fallback: Qt-Kernmodule explizit aus Qt-Lib-Verzeichnis kopieren
-  for base in libQt6Core.so libQt6Gui.so libQt6Widgets.so libQt6PrintSupport.so; do
+  for base in libQt6Core.so libQt6Gui.so libQt6Widgets.so libQt6PrintSupport.so libQt6Concurrent.so; do
     if [ -e "$QT_LIB_DIR/$base" ]; then
       copy_lib "$QT_LIB_DIR/$base"
     fi
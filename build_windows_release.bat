@@ -200,7 +200,7 @@ set "QT_BIN=%QT_PREFIX%\bin"
 if exist "%QT_BIN%\Qt6Core.dll" (
   echo Kopiere Qt6 Runtime-DLLs...
   rem Nur die wirklich benoetigten Qt-DLLs kopieren
-  for %%D in (Qt6Core.dll Qt6Gui.dll Qt6Widgets.dll Qt6PrintSupport.dll) do (
+  for %%D in (Qt6Core.dll Qt6Gui.dll Qt6Widgets.dll Qt6PrintSupport.dll Qt6Concurrent.dll) do (
     if exist "%QT_BIN%\%%D" copy /Y "%QT_BIN%\%%D" "%DIST_DIR%" >NUL
   )
   rem MinGW Runtime-DLLs (libgcc, libstdc++, libwinpthread)